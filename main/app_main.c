@@ -57,7 +57,13 @@
 
 #include "tft_console.h"
 #include "bus_manager.h"
+#include "app_manifest.h"
 #include "runtime_dispatch.h"
+#include "mpy_runtime.h"
+#include "runtime_api.h"
+#include "rt_events.h"
+#include "rt_kv.h"
+#include "kv_log.h"
 
 #define BASALT_PROMPT "basalt> "
 #define BASALT_INPUT_MAX 128
@@ -486,18 +492,6 @@ static int basalt_uart_printf(const char *fmt, ...) {
     return n;
 }
 
-static void basalt_tft_print(const char *fmt, ...) {
-    if (!tft_console_is_ready()) return;
-    char buf[256];
-    va_list ap;
-    va_start(ap, fmt);
-    vsnprintf(buf, sizeof(buf), fmt, ap);
-    va_end(ap);
-#if BASALT_TFT_LOGS
-    tft_console_write(buf);
-#endif
-}
-
 #if BASALT_ENABLE_SHELL
 
 typedef struct {
@@ -523,11 +517,12 @@ static const bsh_cmd_help_t k_bsh_help[] = {
     {"led_test", "led_test [pin]", "Blink/test LED pins (helps identify working LED pin)"},
     {"devcheck", "devcheck [full]", "Quick sanity checks for LED, UI, and filesystems"},
     {"drivers", "drivers", "Show configured driver status and implementation level"},
-    {"tft", "tft [status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>]", "TFT diagnostics and forced draw primitives"},
+    {"tft", "tft [status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>|scroll <up|down|top|end> [pages]|find <text>|grep <text>]", "TFT diagnostics and forced draw primitives"},
 #if BASALT_SHELL_LEVEL >= 3
     {"edit", "edit <file>", "Simple line editor (.save/.quit)"},
 #endif
     {"run", "run <app|script>", "Run an app or script"},
+    {"gc", "gc", "GC telemetry of the running or last Python app"},
     {"run_dev", "run_dev <app|script>", "Run a dev app from /apps_dev"},
     {"stop", "stop", "Stop the running app"},
     {"kill", "kill", "Force stop the running app"},
@@ -536,6 +531,12 @@ static const bsh_cmd_help_t k_bsh_help[] = {
     {"install", "install <src> [name]", "Install app from folder or zip"},
     {"remove", "remove <app>", "Remove installed app"},
     {"logs", "logs", "Show runtime diagnostics and last app error"},
+    {"kv", "kv [stats|sync]", "Key/value store cache and flash-write counters, or write a pending commit now"},
+#if BASALT_HAS_EVENT_BENCH
+    {"events", "events [stats|bench [events] [producers] [subscribers]]", "Event bus subscriber counters, or a throughput/latency benchmark"},
+#else
+    {"events", "events [stats]", "Event bus subscriber counters"},
+#endif
     {"imu", "imu [status|read|whoami|stream [hz] [samples]]", "IMU probe/read over configured I2C pins"},
     {"dht22", "dht22 [status|read [pin] [auto|dht22|dht11]]", "DHT22/DHT11-compatible single-wire probe and read"},
     {"bme280", "bme280 [status|probe|read]", "BME280 probe/status/raw-read over configured I2C pins"},
@@ -592,7 +593,7 @@ static bool bsh_help_cmd_hidden_tiny(const char *name) {
         "ls", "cat", "cd", "mkdir", "cp", "mv", "rm",
         "apps_dev", "led_test", "devcheck", "edit",
         "run_dev", "kill", "applet",
-        "install", "remove", "logs", "imu", "dht22", "bme280", "ads1115", "i2c", "uart", "pwm", "i2s", "mic", "mcp23017", "tp4056", "mcp2544fd", "mcp2515", "uln2003", "l298n", "rmt", "wifi", "bluetooth", "can"
+        "install", "remove", "logs", "kv", "events", "imu", "dht22", "bme280", "ads1115", "i2c", "uart", "pwm", "i2s", "mic", "mcp23017", "tp4056", "mcp2544fd", "mcp2515", "uln2003", "l298n", "rmt", "wifi", "bluetooth", "can"
     };
     for (size_t i = 0; i < sizeof(k_hidden) / sizeof(k_hidden[0]); ++i) {
         if (strcmp(name, k_hidden[i]) == 0) return true;
@@ -705,56 +706,13 @@ static bool resolve_dev_app_in_dir(const char *dir, const char *name, char *out,
     return found;
 }
 
-static void trim_ws(char *s) {
-    if (!s) return;
-    size_t len = strlen(s);
-    while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t' || s[len - 1] == '\r' || s[len - 1] == '\n')) {
-        s[--len] = '\0';
-    }
-    char *p = s;
-    while (*p == ' ' || *p == '\t') p++;
-    if (p != s) memmove(s, p, strlen(p) + 1);
-}
-
-static bool toml_get_value(const char *toml_path, const char *key, char *out, size_t out_len) {
-    FILE *f = fopen(toml_path, "r");
-    if (!f) return false;
-    char line[128];
-    bool found = false;
-    while (fgets(line, sizeof(line), f)) {
-        trim_ws(line);
-        if (line[0] == '\0' || line[0] == '#' || line[0] == ';' || line[0] == '[') {
-            continue;
-        }
-        size_t key_len = strlen(key);
-        if (strncmp(line, key, key_len) != 0) {
-            continue;
-        }
-        char *eq = strchr(line, '=');
-        if (!eq) continue;
-        char *val = eq + 1;
-        trim_ws(val);
-        if (val[0] == '\"') {
-            val++;
-            char *endq = strchr(val, '\"');
-            if (endq) *endq = '\0';
-        }
-        if (val[0] == '\0') continue;
-        snprintf(out, out_len, "%s", val);
-        found = true;
-        break;
-    }
-    fclose(f);
-    return found;
-}
-
 static bool parse_entry_from_toml(const char *toml_path, char *out, size_t out_len) {
-    return toml_get_value(toml_path, "entry", out, out_len);
+    return app_manifest_get(toml_path, "entry", out, out_len);
 }
 
 static basalt_runtime_kind_t parse_runtime_from_toml(const char *toml_path) {
     char runtime[32] = {0};
-    if (!toml_get_value(toml_path, "runtime", runtime, sizeof(runtime))) return BASALT_RUNTIME_PYTHON;
+    if (!app_manifest_get(toml_path, "runtime", runtime, sizeof(runtime))) return BASALT_RUNTIME_PYTHON;
     basalt_runtime_kind_t kind = runtime_kind_from_string(runtime);
     return (kind == BASALT_RUNTIME_UNKNOWN) ? BASALT_RUNTIME_PYTHON : kind;
 }
@@ -1284,8 +1242,7 @@ static void bsh_cmd_edit(const char *path) {
         if (!fgets(line, sizeof(line), stdin)) {
             continue;
         }
-        basalt_uart_printf("%s", line);
-        basalt_tft_print("%s", line);
+        basalt_printf("%s", line);
         if (strcmp(line, ".save\n") == 0 || strcmp(line, ".save\r\n") == 0) {
             fclose(f);
             basalt_printf("saved %s\n", path);
@@ -1623,8 +1580,8 @@ static void bsh_cmd_apps(void) {
         snprintf(toml, sizeof(toml), BASALT_APPS_ROOT "/%s/app.toml", seen[i]);
         char name[64] = {0};
         char version[32] = {0};
-        toml_get_value(toml, "name", name, sizeof(name));
-        toml_get_value(toml, "version", version, sizeof(version));
+        app_manifest_get(toml, "name", name, sizeof(name));
+        app_manifest_get(toml, "version", version, sizeof(version));
         if (name[0] && version[0]) {
             basalt_printf("%s (%s v%s)\n", seen[i], name, version);
         } else if (name[0]) {
@@ -1777,11 +1734,70 @@ static void bsh_cmd_tft(char *arg) {
     }
     char *op = strtok(arg, " \t\r\n");
     if (!op) {
-        basalt_printf("usage: tft status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>\n");
+        basalt_printf("usage: tft status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>|scroll <up|down|top|end> [pages]|find <text>|grep <text>\n");
         return;
     }
     if (strcmp(op, "status") == 0) {
         basalt_printf("tft: %s\n", tft_console_is_ready() ? "ready" : "not-ready");
+        basalt_printf("tft.canvas: %s\n", tft_console_canvas_mode());
+        basalt_printf("tft.scrollback: %d/%d lines view=-%d\n", tft_console_scrollback_lines(),
+                      tft_console_scrollback_capacity(), tft_console_view_offset());
+        return;
+    }
+    if (strcmp(op, "scroll") == 0) {
+        char *dir = strtok(NULL, " \t\r\n");
+        char *count = strtok(NULL, " \t\r\n");
+        int pages = (count && bsh_is_number(count)) ? (int)strtol(count, NULL, 10) : 1;
+        if (!dir) {
+            basalt_printf("usage: tft scroll <up|down|top|end> [pages]\n");
+            return;
+        }
+        if (strcmp(dir, "up") == 0) {
+            tft_console_view_page(pages);
+        } else if (strcmp(dir, "down") == 0) {
+            tft_console_view_page(-pages);
+        } else if (strcmp(dir, "top") == 0) {
+            tft_console_view_line(0);
+        } else if (strcmp(dir, "end") == 0) {
+            tft_console_view_live();
+        } else {
+            basalt_printf("usage: tft scroll <up|down|top|end> [pages]\n");
+            return;
+        }
+        basalt_uart_printf("tft.view: line %d (-%d)\n", tft_console_view_top(), tft_console_view_offset());
+        return;
+    }
+    if (strcmp(op, "find") == 0 || strcmp(op, "grep") == 0) {
+        char *needle = strtok(NULL, "");
+        while (needle && (*needle == ' ' || *needle == '\t')) needle++;
+        if (needle) needle[strcspn(needle, "\r\n")] = '\0';
+        if (!needle || !needle[0]) {
+            basalt_printf("usage: tft %s <text>\n", op);
+            return;
+        }
+        // Results go to the UART only so searching does not grow the history.
+        char text[128];
+        if (strcmp(op, "find") == 0) {
+            // Repeated finds step further back from the current view.
+            int before = tft_console_view_offset() > 0 ? tft_console_view_top() : -1;
+            int hit = tft_console_scrollback_find(needle, before);
+            if (hit < 0) {
+                basalt_uart_printf("tft.find: no match\n");
+                return;
+            }
+            tft_console_view_line(hit);
+            tft_console_scrollback_get(hit, text, sizeof(text));
+            basalt_uart_printf("tft.find: %d: %s\n", hit, text);
+            return;
+        }
+        int shown = 0;
+        for (int hit = tft_console_scrollback_find(needle, -1); hit >= 0 && shown < 64;
+             hit = tft_console_scrollback_find(needle, hit), ++shown) {
+            tft_console_scrollback_get(hit, text, sizeof(text));
+            basalt_uart_printf("%6d: %s\n", hit, text);
+        }
+        basalt_uart_printf("tft.grep: %d match%s%s\n", shown, shown == 1 ? "" : "es",
+                           shown == 64 ? " (newest 64)" : "");
         return;
     }
     if (strcmp(op, "clear") == 0) {
@@ -1819,7 +1835,7 @@ static void bsh_cmd_tft(char *arg) {
         basalt_printf("ok: tft text\n");
         return;
     }
-    basalt_printf("usage: tft status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>\n");
+    basalt_printf("usage: tft status|clear|fill <black|white|red|green|blue>|text <x> <y> <text>|scroll <up|down|top|end> [pages]|find <text>|grep <text>\n");
 #else
     (void)arg;
     basalt_printf("tft: unavailable (enable tft driver)\n");
@@ -5002,6 +5018,24 @@ static void bsh_cmd_rmt(const char *sub, const char *arg1, const char *arg2, con
 }
 #endif
 
+// Compile the entry script once at install time so launches load bytecode.
+static void bsh_install_done(const char *app_name) {
+    basalt_printf("installed %s\n", app_name);
+    char script[256];
+    basalt_runtime_kind_t kind = BASALT_RUNTIME_PYTHON;
+    if (!resolve_named_app_script(app_name, script, sizeof(script), &kind) || !has_suffix(script, ".py")) {
+        return;
+    }
+    if (runtime_dispatch_is_running()) {
+        basalt_printf("install: app running, %s compiles on first run\n", path_basename(script));
+        return;
+    }
+    char err[128];
+    if (!runtime_dispatch_precompile(kind, script, err, sizeof(err))) {
+        basalt_printf("install: precompile failed: %s\n", err);
+    }
+}
+
 static void bsh_cmd_install(const char *src, const char *name) {
     if (!src || !src[0]) {
         basalt_printf("install: missing source path\n");
@@ -5027,7 +5061,7 @@ static void bsh_cmd_install(const char *src, const char *name) {
             basalt_printf("install: %s\n", err);
             return;
         }
-        basalt_printf("installed %s\n", app_name);
+        bsh_install_done(app_name);
         return;
     }
     if (path_is_dir(src_real)) {
@@ -5037,7 +5071,7 @@ static void bsh_cmd_install(const char *src, const char *name) {
             basalt_printf("install: failed to copy %s\n", app_name);
             return;
         }
-        basalt_printf("installed %s\n", app_name);
+        bsh_install_done(app_name);
         return;
     }
     if (!path_is_file(src_real)) {
@@ -5050,7 +5084,7 @@ static void bsh_cmd_install(const char *src, const char *name) {
         basalt_printf("install: failed to copy %s\n", app_name);
         return;
     }
-    basalt_printf("installed %s\n", app_name);
+    bsh_install_done(app_name);
 }
 
 static void bsh_cmd_remove(const char *target) {
@@ -6037,13 +6071,111 @@ static void bsh_cmd_applet_run(const char *name) {
     }
 }
 
+// `gc`: GC telemetry of the running Python app (heap figures as of its last
+// collection), else of the last one to exit.
+static void bsh_cmd_gc(void) {
+    mp_embed_gc_stats_t gc;
+    bool live = false;
+    const char *app = NULL;
+    if (!mpy_runtime_gc_stats(&gc, &live, &app)) {
+        basalt_printf("gc: no Python app has run yet\n");
+        return;
+    }
+    char hist[96];
+    mpy_runtime_format_gc_hist(&gc, hist, sizeof(hist));
+    basalt_printf("gc.app: %s (%s)\n", app, live ? "running" : "exited");
+    basalt_printf("gc.elapsed_ms: %u\n", (unsigned)gc.elapsed_ms);
+    basalt_printf("gc.collections: %u\n", (unsigned)gc.collections);
+    basalt_printf("gc.pause_us: last %u max %u avg %u\n", (unsigned)gc.last_pause_us, (unsigned)gc.max_pause_us,
+                  gc.collections ? (unsigned)(gc.total_pause_us / gc.collections) : 0u);
+    basalt_printf("gc.pause_hist: %s\n", hist);
+    basalt_printf("gc.heap: total %u used %u peak %u largest_free %u areas %u\n", (unsigned)gc.heap_total,
+                  (unsigned)gc.heap_used, (unsigned)gc.heap_peak, (unsigned)gc.heap_max_free, (unsigned)gc.areas);
+    basalt_printf("gc.alloc: %u bytes, %u bytes/s\n", (unsigned)gc.alloc_bytes,
+                  gc.elapsed_ms ? (unsigned)(gc.alloc_bytes * 1000 / gc.elapsed_ms) : 0u);
+}
+
+#if BASALT_SHELL_LEVEL >= 3
+static void bsh_cmd_kv(const char *sub) {
+    if (sub && strcmp(sub, "sync") == 0) {
+        int rc = rt_kv_sync();
+        if (rc != RUNTIME_OK) basalt_printf("kv sync: failed (%d)\n", rc);
+        return;
+    }
+    if (sub && strcmp(sub, "stats") != 0) {
+        bsh_print_unknown_subcommand("kv", sub);
+        return;
+    }
+    rt_kv_stats_t st;
+    rt_kv_get_stats(&st);
+    basalt_printf("kv.backend: %s\n", st.backend ? st.backend : "none");
+    basalt_printf("kv.ops: gets %u (cache hits %u) sets %u (unchanged %u) dels %u\n", (unsigned)st.gets,
+                  (unsigned)st.cache_hits, (unsigned)st.sets, (unsigned)st.sets_unchanged, (unsigned)st.dels);
+    basalt_printf("kv.commits: %u requested, %u flash writes (%u keys, %u bytes)%s\n", (unsigned)st.commits,
+                  (unsigned)st.flash_commits, (unsigned)st.flash_ops, (unsigned)st.bytes_written,
+                  st.commit_pending ? ", one pending" : "");
+    basalt_printf("kv.cache: %u entries, %u dirty\n", (unsigned)st.cached, (unsigned)st.dirty);
+    if (st.backend && strcmp(st.backend, "kvlog") == 0) {
+        kv_log_stats_t ls;
+        kv_log_get_stats(&ls);
+        basalt_printf("kv.log: %u keys, %u live bytes, %u/%u sectors free, %u GC runs, %u erases\n",
+                      (unsigned)ls.keys, (unsigned)ls.live_bytes, (unsigned)ls.free_sectors, (unsigned)ls.sectors,
+                      (unsigned)ls.gc_runs, (unsigned)ls.erases);
+        basalt_printf("kv.log: worst op %u erase(s) / %u bytes, %u torn at mount\n", (unsigned)ls.max_op_erases,
+                      (unsigned)ls.max_op_bytes, (unsigned)ls.torn);
+    }
+}
+
+static void bsh_cmd_events(const char *sub, const char *arg1, const char *arg2, const char *arg3) {
+    if (!sub || strcmp(sub, "stats") == 0) {
+        for (int i = 0; i < RT_EVENT_MAX_SUBSCRIBERS; ++i) {
+            rt_event_sub_stats_t st;
+            if (rt_event_sub_stats(i, &st) != RUNTIME_OK || !st.active) continue;
+            basalt_printf("events.sub%d: types 0x%02X delivered %u dropped %u depth %u\n", i, (unsigned)st.types,
+                          (unsigned)st.delivered, (unsigned)st.dropped, (unsigned)st.depth);
+        }
+        return;
+    }
+    if (strcmp(sub, "bench") != 0) {
+        bsh_print_unknown_subcommand("events", sub);
+        return;
+    }
+#if !BASALT_HAS_EVENT_BENCH
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+    basalt_printf("events bench: not built in (idf.py -DBASALT_EVENT_BENCH=ON)\n");
+#else
+    rt_event_bench_cfg_t cfg = {.events = 20000, .producers = 2, .subscribers = 2};
+    if (arg1 && arg1[0]) cfg.events = (uint32_t)strtoul(arg1, NULL, 10);
+    if (arg2 && arg2[0]) cfg.producers = (int)strtol(arg2, NULL, 10);
+    if (arg3 && arg3[0]) cfg.subscribers = (int)strtol(arg3, NULL, 10);
+    basalt_printf("events bench: %u events, %d producers, %d subscribers\n", (unsigned)cfg.events, cfg.producers,
+                  cfg.subscribers);
+    rt_event_bench_result_t r;
+    int rc = rt_event_bench_run(&cfg, &r);
+    if (rc != RUNTIME_OK) {
+        basalt_printf("events bench: failed (%d)\n", rc);
+        return;
+    }
+    uint64_t rate = r.elapsed_us ? (uint64_t)r.received * 1000000u / r.elapsed_us : 0;
+    basalt_printf("events.posted: %u\n", (unsigned)r.posted);
+    basalt_printf("events.received: %u (%u/s)\n", (unsigned)r.received, (unsigned)rate);
+    basalt_printf("events.dropped: %u lost %u misordered %u\n", (unsigned)r.dropped, (unsigned)r.lost,
+                  (unsigned)r.misordered);
+    basalt_printf("events.latency_us: p50 %u p99 %u max %u\n", (unsigned)r.lat_p50_us, (unsigned)r.lat_p99_us,
+                  (unsigned)r.lat_max_us);
+#endif
+}
+#endif
+
 #if BASALT_SHELL_LEVEL == 1
 static bool bsh_tiny_is_blocked(const char *cmd) {
     static const char *k_blocked[] = {
         "ls", "cat", "cd", "mkdir", "cp", "mv", "rm",
         "apps_dev", "led_test", "devcheck", "edit",
         "run_dev", "kill", "applet", "applets",
-        "install", "remove", "logs", "imu", "dht22", "ads1115", "i2c", "uart", "pwm", "i2s", "mic", "mcp23017", "tp4056", "mcp2544fd", "uln2003", "l298n", "rmt", "wifi", "bluetooth", "bt", "can"
+        "install", "remove", "logs", "kv", "events", "imu", "dht22", "ads1115", "i2c", "uart", "pwm", "i2s", "mic", "mcp23017", "tp4056", "mcp2544fd", "uln2003", "l298n", "rmt", "wifi", "bluetooth", "bt", "can"
     };
     for (size_t i = 0; i < sizeof(k_blocked) / sizeof(k_blocked[0]); ++i) {
         if (strcmp(cmd, k_blocked[i]) == 0) return true;
@@ -6159,6 +6291,8 @@ static void bsh_handle_line(char *line) {
 #else
         basalt_printf("edit: disabled in this shell level\n");
 #endif
+    } else if (strcmp(cmd, "gc") == 0) {
+        bsh_cmd_gc();
     } else if (strcmp(cmd, "run") == 0) {
         char *arg = strtok(NULL, " \t\r\n");
         if (!arg) {
@@ -6331,6 +6465,23 @@ static void bsh_handle_line(char *line) {
         bsh_cmd_remove(name);
 #else
         basalt_printf("remove: disabled in this shell level\n");
+#endif
+    } else if (strcmp(cmd, "kv") == 0) {
+#if BASALT_SHELL_LEVEL >= 3
+        char *sub = strtok(NULL, " \t\r\n");
+        bsh_cmd_kv(sub);
+#else
+        basalt_printf("kv: disabled in this shell level\n");
+#endif
+    } else if (strcmp(cmd, "events") == 0) {
+#if BASALT_SHELL_LEVEL >= 3
+        char *sub = strtok(NULL, " \t\r\n");
+        char *arg1 = strtok(NULL, " \t\r\n");
+        char *arg2 = strtok(NULL, " \t\r\n");
+        char *arg3 = strtok(NULL, " \t\r\n");
+        bsh_cmd_events(sub, arg1, arg2, arg3);
+#else
+        basalt_printf("events: disabled in this shell level\n");
 #endif
     } else if (strcmp(cmd, "logs") == 0) {
 #if BASALT_SHELL_LEVEL >= 3
@@ -6589,6 +6740,7 @@ static void bsh_handle_line(char *line) {
     } else if (strcmp(cmd, "reboot") == 0) {
         basalt_printf("rebooting...\n");
         fflush(stdout);
+        rt_kv_sync();
         esp_restart();
     } else {
         bsh_print_unknown_command(cmd);
@@ -6637,22 +6789,21 @@ static void bsh_task(void *arg) {
     char line[BASALT_INPUT_MAX];
 
     while (true) {
-        basalt_uart_printf(BASALT_PROMPT_COLOR BASALT_PROMPT BASALT_COLOR_RESET);
-#if BASALT_TFT_LOGS
-        tft_console_set_color(0x001F);
-        basalt_tft_print(BASALT_PROMPT);
-        tft_console_set_color(0xFFFF);
-#endif
+        // The TFT console parses the SGR colour itself, so one write feeds both sinks.
+        basalt_printf(BASALT_PROMPT_COLOR BASALT_PROMPT BASALT_COLOR_RESET);
         int got = basalt_uart_readline(line, sizeof(line));
         if (got <= 0) {
             vTaskDelay(pdMS_TO_TICKS(10));
             continue;
         }
-        // Echo user input to UART (TFT echo can be enabled via BASALT_TFT_LOGS).
-        basalt_uart_printf("%s", line);
-#if BASALT_TFT_LOGS
-        basalt_tft_print("%s", line);
+#if BASALT_ENABLE_TFT
+        // Any command other than tft paging/search returns the panel to live output.
+        if (strncmp(line, "tft ", 4) != 0) {
+            tft_console_view_live();
+        }
 #endif
+        // Echo user input to UART (TFT echo can be enabled via BASALT_TFT_LOGS).
+        basalt_printf("%s", line);
         bsh_handle_line(line);
     }
 }
@@ -6858,10 +7009,14 @@ void app_main(void) {
         ESP_ERROR_CHECK(nvs_flash_init());
     }
 
+    if (rt_kv_init() != RUNTIME_OK) ESP_LOGW(TAG, "kv store unavailable");
+
     basalt_board_bootstrap();
     basalt_console_init();
     basalt_fs_init();
     basalt_sd_init();
+    // Before the touch task starts posting into it.
+    if (rt_event_init() != RUNTIME_OK) ESP_LOGW(TAG, "event queue unavailable");
 #if BASALT_ENABLE_TFT
     tft_console_init();
 #else
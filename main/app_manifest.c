@@ -0,0 +1,68 @@
+#include "app_manifest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void trim_ws(char *s) {
+    if (!s) return;
+    size_t len = strlen(s);
+    while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t' || s[len - 1] == '\r' || s[len - 1] == '\n')) {
+        s[--len] = '\0';
+    }
+    char *p = s;
+    while (*p == ' ' || *p == '\t') p++;
+    if (p != s) memmove(s, p, strlen(p) + 1);
+}
+
+bool app_manifest_get(const char *toml_path, const char *key, char *out, size_t out_len) {
+    FILE *f = fopen(toml_path, "r");
+    if (!f) return false;
+    char line[128];
+    bool found = false;
+    size_t key_len = strlen(key);
+    while (fgets(line, sizeof(line), f)) {
+        trim_ws(line);
+        if (line[0] == '\0' || line[0] == '#' || line[0] == ';' || line[0] == '[') {
+            continue;
+        }
+        if (strncmp(line, key, key_len) != 0) {
+            continue;
+        }
+        // Whole key only: "heap_kb" must not match "heap_kb_max".
+        char c = line[key_len];
+        if (c != '=' && c != ' ' && c != '\t') continue;
+        char *eq = strchr(line, '=');
+        if (!eq) continue;
+        char *val = eq + 1;
+        trim_ws(val);
+        if (val[0] == '\"') {
+            val++;
+            char *endq = strchr(val, '\"');
+            if (endq) *endq = '\0';
+        }
+        if (val[0] == '\0') continue;
+        snprintf(out, out_len, "%s", val);
+        found = true;
+        break;
+    }
+    fclose(f);
+    return found;
+}
+
+unsigned app_manifest_get_uint(const char *toml_path, const char *key, unsigned def) {
+    char val[24];
+    if (!app_manifest_get(toml_path, key, val, sizeof(val))) return def;
+    char *end = NULL;
+    unsigned long v = strtoul(val, &end, 10);
+    if (end == val || (*end != '\0' && *end != ' ' && *end != '#')) return def;
+    return (unsigned)v;
+}
+
+bool app_manifest_path_for_script(const char *script, char *out, size_t out_len) {
+    if (!script) return false;
+    const char *slash = strrchr(script, '/');
+    if (!slash) return false;
+    int n = snprintf(out, out_len, "%.*s/app.toml", (int)(slash - script), script);
+    return n > 0 && (size_t)n < out_len;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Reads `key = value` from a flat app.toml; quotes around the value are dropped.
+bool app_manifest_get(const char *toml_path, const char *key, char *out, size_t out_len);
+// Unsigned integer field; returns `def` when missing or malformed.
+unsigned app_manifest_get_uint(const char *toml_path, const char *key, unsigned def);
+// Path of the app.toml next to an app's entry script.
+bool app_manifest_path_for_script(const char *script, char *out, size_t out_len);
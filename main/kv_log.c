@@ -0,0 +1,643 @@
+// Append-only key/value log on a raw flash partition.
+//
+// Each sector starts with a header (magic, sequence number, CRC). After it
+// come entries: type, key length, value length, CRC, then key and value,
+// padded to 4 bytes. Puts and deletes are staged. A commit record makes the
+// staged entries visible together. At mount the sectors are replayed in
+// sequence order. The replay keeps only committed entries and stops at the
+// first entry whose CRC fails, so a power cut mid-write loses only the batch
+// that was in flight.
+//
+// A RAM index (open addressing on FNV-1a, key compared on flash) points each
+// key at its latest entry. Per-sector live byte counts pick GC victims. Once
+// fewer than two erased sectors remain, the next batch first compacts the
+// sector with the least live data: it copies the live entries forward,
+// commits them and erases the sector. Writes are capped at 75% of the
+// usable space, so that single relocation is enough. A put, delete or commit
+// therefore costs at most one sector of copying and one erase.
+
+#include "kv_log.h"
+
+#include <string.h>
+
+#ifndef BASALT_KV_LOG_MAX_SECTORS
+#define BASALT_KV_LOG_MAX_SECTORS 64
+#endif
+// Power of two; at most 3/4 of the slots hold keys (tombstones included).
+#ifndef BASALT_KV_LOG_INDEX_SLOTS
+#define BASALT_KV_LOG_INDEX_SLOTS 256
+#endif
+
+#define KV_LOG_MAGIC 0x4C564B42u // "BKVL"
+#define KV_LOG_SECTOR_HDR 16
+#define KV_LOG_ENTRY_HDR 8
+#define KV_LOG_ENTRY_MAX (KV_LOG_ENTRY_HDR + RT_KV_KEY_MAX + BASALT_KV_VALUE_MAX + 3)
+#define KV_LOG_BATCH_MAX 64
+#define KV_LOG_FILL_PCT 75
+#define KV_LOG_GC_PASSES 2
+#define KV_LOG_NONE 0xFFFFFFFFu
+
+enum { ENT_VALUE = 1, ENT_TOMB, ENT_COMMIT, ENT_ABORT };
+enum { READ_OK = 0, READ_BLANK, READ_TORN };
+enum { SLOT_EMPTY = 0, SLOT_USED, SLOT_REMOVED };
+
+typedef struct {
+    uint32_t seq; // 0: erased
+    uint32_t live;
+} kv_log_sector_t;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t off;
+    uint16_t size;
+    uint8_t state;
+    bool tomb;
+} kv_log_slot_t;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t off;
+    uint16_t size;
+    uint8_t type;
+    char key[RT_KV_KEY_MAX + 1];
+} kv_log_pending_t;
+
+static const kv_log_flash_t *s_flash;
+static uint32_t s_nsec;
+static uint32_t s_ss;
+static kv_log_sector_t s_sec[BASALT_KV_LOG_MAX_SECTORS];
+static uint32_t s_active = KV_LOG_NONE;
+static uint32_t s_wr; // append offset within the active sector
+static uint32_t s_max_seq;
+static kv_log_slot_t s_index[BASALT_KV_LOG_INDEX_SLOTS];
+static uint32_t s_used_slots;
+static uint32_t s_keys;
+static uint32_t s_live;
+static kv_log_pending_t s_pending[KV_LOG_BATCH_MAX];
+static uint32_t s_npending;
+static uint32_t s_batch_bytes;
+static uint8_t s_buf[KV_LOG_ENTRY_MAX + 1];
+static kv_log_stats_t s_stats;
+static uint32_t s_op_erases;
+static uint32_t s_op_bytes;
+
+static uint32_t kv_crc32(uint32_t crc, const uint8_t *p, size_t n) {
+    static const uint32_t k_tab[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ k_tab[crc & 15];
+        crc = (crc >> 4) ^ k_tab[crc & 15];
+    }
+    return ~crc;
+}
+
+static uint32_t kv_hash(const char *key) {
+    uint32_t h = 2166136261u;
+    while (*key) {
+        h ^= (uint8_t)*key++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void kv_put32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t kv_get32(const uint8_t *p) {
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint32_t kv_align(uint32_t n) {
+    return (n + 3u) & ~3u;
+}
+
+static uint32_t kv_usable(void) {
+    return s_ss - KV_LOG_SECTOR_HDR;
+}
+
+static uint32_t kv_free_sectors(void) {
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < s_nsec; ++i) {
+        if (s_sec[i].seq == 0) n++;
+    }
+    return n;
+}
+
+static int kv_write(uint32_t off, const void *buf, size_t len) {
+    int rc = s_flash->write(off, buf, len);
+    if (rc == RUNTIME_OK) {
+        s_stats.bytes_written += len;
+        s_op_bytes += len;
+    }
+    return rc;
+}
+
+static int kv_erase(uint32_t sec) {
+    int rc = s_flash->erase(sec * s_ss);
+    if (rc == RUNTIME_OK) {
+        s_stats.erases++;
+        s_op_erases++;
+    }
+    return rc;
+}
+
+static void kv_op_begin(void) {
+    s_op_erases = 0;
+    s_op_bytes = 0;
+}
+
+static void kv_op_end(void) {
+    if (s_op_erases > s_stats.max_op_erases) s_stats.max_op_erases = s_op_erases;
+    if (s_op_bytes > s_stats.max_op_bytes) s_stats.max_op_bytes = s_op_bytes;
+}
+
+static int kv_blank(uint32_t off, uint32_t end, bool *blank) {
+    uint8_t chunk[64];
+    *blank = true;
+    while (off < end) {
+        size_t n = end - off < sizeof(chunk) ? end - off : sizeof(chunk);
+        int rc = s_flash->read(off, chunk, n);
+        if (rc != RUNTIME_OK) return rc;
+        for (size_t i = 0; i < n; ++i) {
+            if (chunk[i] != 0xFF) {
+                *blank = false;
+                return RUNTIME_OK;
+            }
+        }
+        off += n;
+    }
+    return RUNTIME_OK;
+}
+
+// Reads the entry at off into s_buf. READ_BLANK: nothing was ever written
+// from here to the end of the sector. READ_TORN: anything else that doesn't
+// check out, which the caller treats as the end of usable data.
+static int kv_read_entry(uint32_t off, uint32_t end, uint32_t *size) {
+    bool blank;
+    if (off + KV_LOG_ENTRY_HDR > end) {
+        int rc = kv_blank(off, end, &blank);
+        return rc != RUNTIME_OK ? rc : blank ? READ_BLANK : READ_TORN;
+    }
+    int rc = s_flash->read(off, s_buf, KV_LOG_ENTRY_HDR);
+    if (rc != RUNTIME_OK) return rc;
+    static const uint8_t k_erased[KV_LOG_ENTRY_HDR] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    if (memcmp(s_buf, k_erased, KV_LOG_ENTRY_HDR) == 0) {
+        rc = kv_blank(off, end, &blank);
+        return rc != RUNTIME_OK ? rc : blank ? READ_BLANK : READ_TORN;
+    }
+    uint8_t type = s_buf[0];
+    uint32_t klen = s_buf[1];
+    uint32_t vlen = s_buf[2] | (uint32_t)s_buf[3] << 8;
+    if (type == ENT_VALUE || type == ENT_TOMB) {
+        if (klen == 0 || klen > RT_KV_KEY_MAX || vlen > BASALT_KV_VALUE_MAX) return READ_TORN;
+        if (type == ENT_TOMB && vlen != 0) return READ_TORN;
+    } else if (type == ENT_COMMIT || type == ENT_ABORT) {
+        if (klen != 0 || vlen != 0) return READ_TORN;
+    } else {
+        return READ_TORN;
+    }
+    *size = kv_align(KV_LOG_ENTRY_HDR + klen + vlen);
+    if (off + *size > end) return READ_TORN;
+    if (klen + vlen > 0) {
+        rc = s_flash->read(off + KV_LOG_ENTRY_HDR, s_buf + KV_LOG_ENTRY_HDR, klen + vlen);
+        if (rc != RUNTIME_OK) return rc;
+    }
+    uint32_t crc = kv_crc32(kv_crc32(0, s_buf, 4), s_buf + KV_LOG_ENTRY_HDR, klen + vlen);
+    return crc == kv_get32(s_buf + 4) ? READ_OK : READ_TORN;
+}
+
+static int kv_index_find(const char *key, uint32_t hash, kv_log_slot_t **out) {
+    uint8_t tmp[KV_LOG_ENTRY_HDR + RT_KV_KEY_MAX];
+    size_t klen = strlen(key);
+    uint32_t mask = BASALT_KV_LOG_INDEX_SLOTS - 1;
+    *out = NULL;
+    for (uint32_t i = 0, pos = hash & mask; i < BASALT_KV_LOG_INDEX_SLOTS; ++i, pos = (pos + 1) & mask) {
+        kv_log_slot_t *slot = &s_index[pos];
+        if (slot->state == SLOT_EMPTY) break;
+        if (slot->state != SLOT_USED || slot->hash != hash) continue;
+        // Same 32-bit hash; confirm against the key stored on flash.
+        int rc = s_flash->read(slot->off, tmp, KV_LOG_ENTRY_HDR + klen);
+        if (rc != RUNTIME_OK) return rc;
+        if (tmp[1] == klen && memcmp(tmp + KV_LOG_ENTRY_HDR, key, klen) == 0) {
+            *out = slot;
+            break;
+        }
+    }
+    return RUNTIME_OK;
+}
+
+static kv_log_slot_t *kv_index_new(uint32_t hash) {
+    uint32_t mask = BASALT_KV_LOG_INDEX_SLOTS - 1;
+    for (uint32_t i = 0, pos = hash & mask; i < BASALT_KV_LOG_INDEX_SLOTS; ++i, pos = (pos + 1) & mask) {
+        kv_log_slot_t *slot = &s_index[pos];
+        if (slot->state == SLOT_USED) continue;
+        slot->state = SLOT_USED;
+        slot->hash = hash;
+        s_used_slots++;
+        return slot;
+    }
+    return NULL;
+}
+
+static void kv_index_unlink(kv_log_slot_t *slot) {
+    s_sec[slot->off / s_ss].live -= slot->size;
+    s_live -= slot->size;
+    if (!slot->tomb) s_keys--;
+}
+
+static void kv_index_link(kv_log_slot_t *slot, uint32_t off, uint32_t size, bool tomb) {
+    slot->off = off;
+    slot->size = (uint16_t)size;
+    slot->tomb = tomb;
+    s_sec[off / s_ss].live += size;
+    s_live += size;
+    if (!tomb) s_keys++;
+}
+
+static int kv_apply(const kv_log_pending_t *p) {
+    kv_log_slot_t *slot;
+    int rc = kv_index_find(p->key, p->hash, &slot);
+    if (rc != RUNTIME_OK) return rc;
+    if (slot) {
+        kv_index_unlink(slot);
+    } else if (p->type == ENT_TOMB) {
+        return RUNTIME_OK; // no older value left to hide
+    } else {
+        slot = kv_index_new(p->hash);
+        if (!slot) return RUNTIME_ENOMEM;
+    }
+    kv_index_link(slot, p->off, p->size, p->type == ENT_TOMB);
+    return RUNTIME_OK;
+}
+
+static void kv_pending_add(const char *key, size_t klen, uint32_t off, uint32_t size, uint8_t type) {
+    kv_log_pending_t *p = &s_pending[s_npending++];
+    memcpy(p->key, key, klen);
+    p->key[klen] = '\0';
+    p->hash = kv_hash(p->key);
+    p->off = off;
+    p->size = (uint16_t)size;
+    p->type = type;
+}
+
+// Rotates to the next erased sector after the active one, spreading wear.
+static int kv_sector_open(void) {
+    uint32_t start = s_active == KV_LOG_NONE ? 0 : s_active + 1;
+    for (uint32_t i = 0; i < s_nsec; ++i) {
+        uint32_t sec = (start + i) % s_nsec;
+        if (s_sec[sec].seq != 0) continue;
+        uint8_t hdr[KV_LOG_SECTOR_HDR];
+        memset(hdr, 0xFF, sizeof(hdr));
+        kv_put32(hdr, KV_LOG_MAGIC);
+        kv_put32(hdr + 4, ++s_max_seq);
+        kv_put32(hdr + 8, kv_crc32(0, hdr, 8));
+        s_sec[sec].seq = s_max_seq;
+        s_sec[sec].live = 0;
+        s_active = sec;
+        s_wr = KV_LOG_SECTOR_HDR;
+        return kv_write(sec * s_ss, hdr, sizeof(hdr));
+    }
+    return RUNTIME_ENOMEM;
+}
+
+// Appends one entry, leaving at least `reserve` erased sectors for GC.
+static int kv_append(const void *data, uint32_t size, uint32_t reserve, uint32_t *off_out) {
+    if (s_active == KV_LOG_NONE || s_wr + size > s_ss) {
+        if (kv_free_sectors() <= reserve) return RUNTIME_ENOMEM;
+        int rc = kv_sector_open();
+        if (rc != RUNTIME_OK) return rc;
+    }
+    uint32_t off = s_active * s_ss + s_wr;
+    // A failed write may still have programmed part of the range; skip it.
+    s_wr += size;
+    int rc = kv_write(off, data, size);
+    if (rc == RUNTIME_OK && off_out) *off_out = off;
+    return rc;
+}
+
+static int kv_write_marker(uint8_t type, uint32_t reserve) {
+    uint8_t m[KV_LOG_ENTRY_HDR] = {type, 0, 0, 0};
+    kv_put32(m + 4, kv_crc32(0, m, 4));
+    return kv_append(m, sizeof(m), reserve, NULL);
+}
+
+static int kv_commit_pending(uint32_t reserve) {
+    if (s_npending == 0) return RUNTIME_OK;
+    int rc = kv_write_marker(ENT_COMMIT, reserve);
+    if (rc != RUNTIME_OK) return rc;
+    for (uint32_t i = 0; i < s_npending && rc == RUNTIME_OK; ++i) {
+        rc = kv_apply(&s_pending[i]);
+    }
+    s_npending = 0;
+    s_batch_bytes = 0;
+    return rc;
+}
+
+// Compacts the sector with the least live data. Live entries are copied
+// forward and committed before the erase, so a power cut at any point
+// leaves either the old copy or both.
+static int kv_gc_one(void) {
+    uint32_t victim = KV_LOG_NONE, oldest = 0;
+    for (uint32_t i = 0; i < s_nsec; ++i) {
+        if (s_sec[i].seq == 0) continue;
+        if (oldest == 0 || s_sec[i].seq < oldest) oldest = s_sec[i].seq;
+        if (i == s_active) continue;
+        if (victim == KV_LOG_NONE || s_sec[i].live < s_sec[victim].live ||
+            (s_sec[i].live == s_sec[victim].live && s_sec[i].seq < s_sec[victim].seq)) {
+            victim = i;
+        }
+    }
+    if (victim == KV_LOG_NONE) return RUNTIME_ENOMEM;
+    // Nothing older can hold a value a tombstone here still has to hide.
+    bool drop_tombs = s_sec[victim].seq == oldest;
+    uint32_t base = victim * s_ss, off = KV_LOG_SECTOR_HDR;
+    while (off < s_ss && s_sec[victim].live > 0) {
+        uint32_t size;
+        int r = kv_read_entry(base + off, base + s_ss, &size);
+        if (r < 0) return r;
+        if (r != READ_OK) break;
+        uint8_t type = s_buf[0];
+        if (type == ENT_VALUE || type == ENT_TOMB) {
+            char key[RT_KV_KEY_MAX + 1];
+            size_t klen = s_buf[1];
+            memcpy(key, s_buf + KV_LOG_ENTRY_HDR, klen);
+            key[klen] = '\0';
+            kv_log_slot_t *slot;
+            int rc = kv_index_find(key, kv_hash(key), &slot);
+            if (rc != RUNTIME_OK) return rc;
+            if (slot && slot->off == base + off) {
+                if (type == ENT_TOMB && drop_tombs) {
+                    kv_index_unlink(slot);
+                    slot->state = SLOT_REMOVED;
+                    s_used_slots--;
+                } else {
+                    if (s_npending == KV_LOG_BATCH_MAX) {
+                        rc = kv_commit_pending(0);
+                        if (rc != RUNTIME_OK) return rc;
+                        // The marker overwrote nothing, but re-read the entry.
+                        r = kv_read_entry(base + off, base + s_ss, &size);
+                        if (r != READ_OK) return r < 0 ? r : RUNTIME_EIO;
+                    }
+                    uint32_t noff;
+                    rc = kv_append(s_buf, size, 0, &noff);
+                    if (rc != RUNTIME_OK) return rc;
+                    kv_pending_add(key, klen, noff, size, type);
+                }
+            }
+        }
+        off += size;
+    }
+    int rc = kv_commit_pending(0);
+    if (rc != RUNTIME_OK) return rc;
+    rc = kv_erase(victim);
+    s_live -= s_sec[victim].live;
+    s_sec[victim].seq = 0;
+    s_sec[victim].live = 0;
+    s_stats.gc_runs++;
+    return rc;
+}
+
+// A batch may use one fresh sector and must leave one for GC to copy into,
+// so it starts with at least two erased.
+static int kv_batch_begin(void) {
+    if (s_npending) return RUNTIME_OK;
+    for (int pass = 0; pass < KV_LOG_GC_PASSES && kv_free_sectors() < 2; ++pass) {
+        int rc = kv_gc_one();
+        if (rc != RUNTIME_OK) return rc;
+    }
+    return RUNTIME_OK;
+}
+
+static bool kv_key_ok(const char *key, size_t *klen) {
+    *klen = key ? strlen(key) : 0;
+    return *klen > 0 && *klen <= RT_KV_KEY_MAX;
+}
+
+static int kv_stage(uint8_t type, const char *key, size_t klen, const void *val, size_t len) {
+    uint32_t size = kv_align(KV_LOG_ENTRY_HDR + klen + len);
+    // A batch larger than a sector is committed in parts; each part is atomic.
+    if (s_npending == KV_LOG_BATCH_MAX || s_batch_bytes + size + KV_LOG_ENTRY_HDR > kv_usable()) {
+        int rc = kv_commit_pending(1);
+        if (rc != RUNTIME_OK) return rc;
+    }
+    int rc = kv_batch_begin();
+    if (rc != RUNTIME_OK) return rc;
+
+    kv_log_slot_t *slot;
+    uint32_t hash = kv_hash(key);
+    rc = kv_index_find(key, hash, &slot);
+    if (rc != RUNTIME_OK) return rc;
+    bool staged = false;
+    for (uint32_t i = 0; i < s_npending && !staged; ++i) {
+        staged = s_pending[i].hash == hash && strcmp(s_pending[i].key, key) == 0;
+    }
+    if (type == ENT_TOMB && (!slot || slot->tomb) && !staged) return RUNTIME_OK;
+    uint32_t limit = (s_nsec - 2) * kv_usable() / 100 * KV_LOG_FILL_PCT;
+    uint32_t freed = slot ? slot->size : 0;
+    if (s_live + s_batch_bytes + size > limit + freed) return RUNTIME_ENOMEM;
+    if (!slot && s_used_slots + s_npending >= BASALT_KV_LOG_INDEX_SLOTS / 4 * 3) return RUNTIME_ENOMEM;
+
+    memset(s_buf, 0xFF, size);
+    s_buf[0] = type;
+    s_buf[1] = (uint8_t)klen;
+    s_buf[2] = (uint8_t)len;
+    s_buf[3] = (uint8_t)(len >> 8);
+    memcpy(s_buf + KV_LOG_ENTRY_HDR, key, klen);
+    if (len) memcpy(s_buf + KV_LOG_ENTRY_HDR + klen, val, len);
+    kv_put32(s_buf + 4, kv_crc32(kv_crc32(0, s_buf, 4), s_buf + KV_LOG_ENTRY_HDR, klen + len));
+    uint32_t off;
+    rc = kv_append(s_buf, size, 1, &off);
+    if (rc != RUNTIME_OK) return rc;
+    kv_pending_add(key, klen, off, size, type);
+    s_batch_bytes += size;
+    return RUNTIME_OK;
+}
+
+int kv_log_put(const char *key, const void *buf, size_t len) {
+    size_t klen;
+    if (!kv_key_ok(key, &klen) || (!buf && len) || len > BASALT_KV_VALUE_MAX) return RUNTIME_EINVAL;
+    if (!s_flash) return RUNTIME_ENOSYS;
+    kv_op_begin();
+    int rc = kv_stage(ENT_VALUE, key, klen, buf, len);
+    kv_op_end();
+    return rc;
+}
+
+int kv_log_del(const char *key) {
+    size_t klen;
+    if (!kv_key_ok(key, &klen)) return RUNTIME_EINVAL;
+    if (!s_flash) return RUNTIME_ENOSYS;
+    kv_op_begin();
+    int rc = kv_stage(ENT_TOMB, key, klen, NULL, 0);
+    kv_op_end();
+    return rc;
+}
+
+int kv_log_commit(void) {
+    if (!s_flash) return RUNTIME_ENOSYS;
+    kv_op_begin();
+    int rc = kv_commit_pending(1);
+    kv_op_end();
+    return rc;
+}
+
+int kv_log_get(const char *key, void *buf, size_t *len_inout) {
+    size_t klen;
+    if (!kv_key_ok(key, &klen) || !len_inout) return RUNTIME_EINVAL;
+    if (!s_flash) return RUNTIME_ENOSYS;
+    kv_log_slot_t *slot;
+    int rc = kv_index_find(key, kv_hash(key), &slot);
+    if (rc != RUNTIME_OK) return rc;
+    if (!slot || slot->tomb) return RUNTIME_ENOENT;
+    uint8_t hdr[KV_LOG_ENTRY_HDR];
+    rc = s_flash->read(slot->off, hdr, sizeof(hdr));
+    if (rc != RUNTIME_OK) return rc;
+    size_t vlen = hdr[2] | (size_t)hdr[3] << 8;
+    if (buf) {
+        if (*len_inout < vlen) {
+            *len_inout = vlen;
+            return RUNTIME_EINVAL;
+        }
+        rc = s_flash->read(slot->off + KV_LOG_ENTRY_HDR + klen, buf, vlen);
+        if (rc != RUNTIME_OK) return rc;
+    }
+    *len_inout = vlen;
+    return RUNTIME_OK;
+}
+
+int kv_log_mount(const kv_log_flash_t *flash) {
+    if (!flash || flash->sector_size < KV_LOG_SECTOR_HDR + 2 * KV_LOG_ENTRY_MAX || flash->size % flash->sector_size) {
+        return RUNTIME_EINVAL;
+    }
+    uint32_t nsec = flash->size / flash->sector_size;
+    if (nsec < 4 || nsec > BASALT_KV_LOG_MAX_SECTORS) return RUNTIME_EINVAL;
+    s_flash = NULL;
+    memset(s_sec, 0, sizeof(s_sec));
+    memset(s_index, 0, sizeof(s_index));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_nsec = nsec;
+    s_ss = flash->sector_size;
+    s_active = KV_LOG_NONE;
+    s_wr = 0;
+    s_max_seq = 0;
+    s_used_slots = s_keys = s_live = 0;
+    s_npending = s_batch_bytes = 0;
+    s_flash = flash;
+
+    // Sector headers: valid, erased, or damaged by a cut during a header
+    // write or an erase. Damaged sectors are erased now.
+    uint32_t order[BASALT_KV_LOG_MAX_SECTORS];
+    uint32_t used = 0;
+    int rc = RUNTIME_OK;
+    for (uint32_t i = 0; i < nsec && rc == RUNTIME_OK; ++i) {
+        uint8_t hdr[KV_LOG_SECTOR_HDR];
+        rc = flash->read(i * s_ss, hdr, sizeof(hdr));
+        if (rc != RUNTIME_OK) break;
+        uint32_t seq = kv_get32(hdr + 4);
+        if (kv_get32(hdr) == KV_LOG_MAGIC && seq != 0 && seq != KV_LOG_NONE &&
+            kv_get32(hdr + 8) == kv_crc32(0, hdr, 8)) {
+            s_sec[i].seq = seq;
+            if (seq > s_max_seq) s_max_seq = seq;
+            // Insertion sort by sequence: the replay order.
+            uint32_t j = used++;
+            while (j > 0 && s_sec[order[j - 1]].seq > seq) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = i;
+            continue;
+        }
+        bool blank;
+        rc = kv_blank(i * s_ss, (i + 1) * s_ss, &blank);
+        if (rc == RUNTIME_OK && !blank) {
+            s_stats.torn++;
+            rc = kv_erase(i);
+        }
+    }
+
+    for (uint32_t k = 0; k < used && rc == RUNTIME_OK; ++k) {
+        uint32_t sec = order[k], base = sec * s_ss, off = KV_LOG_SECTOR_HDR;
+        while (off < s_ss) {
+            uint32_t size;
+            int r = kv_read_entry(base + off, base + s_ss, &size);
+            if (r < 0) {
+                rc = r;
+                break;
+            }
+            if (r == READ_BLANK) break;
+            if (r == READ_TORN) {
+                // Cut mid-write: this sector takes no more appends, and the
+                // batch it belonged to never committed.
+                s_stats.torn++;
+                s_npending = 0;
+                off = s_ss;
+                break;
+            }
+            uint8_t type = s_buf[0];
+            if (type == ENT_COMMIT) {
+                for (uint32_t i = 0; i < s_npending && rc == RUNTIME_OK; ++i) {
+                    rc = kv_apply(&s_pending[i]);
+                }
+                s_npending = 0;
+            } else if (type == ENT_ABORT) {
+                s_npending = 0;
+            } else if (s_npending < KV_LOG_BATCH_MAX) {
+                kv_pending_add((const char *)s_buf + KV_LOG_ENTRY_HDR, s_buf[1], base + off, size, type);
+            }
+            off += size;
+        }
+        s_active = sec;
+        s_wr = off;
+    }
+    if (rc == RUNTIME_OK && s_npending) {
+        // Entries of a batch whose commit never landed; fence them off so
+        // the next commit record doesn't adopt them.
+        s_stats.torn++;
+        s_npending = 0;
+        rc = kv_write_marker(ENT_ABORT, 0);
+    }
+    if (rc != RUNTIME_OK) {
+        s_flash = NULL;
+        return rc;
+    }
+    s_stats.max_op_erases = 0;
+    s_stats.max_op_bytes = 0;
+    return RUNTIME_OK;
+}
+
+void kv_log_get_stats(kv_log_stats_t *out) {
+    if (!out) return;
+    *out = s_stats;
+    out->sectors = s_nsec;
+    out->free_sectors = s_flash ? kv_free_sectors() : 0;
+    out->keys = s_keys;
+    out->live_bytes = s_live;
+}
+
+static int kv_log_backend_open(void) {
+    const kv_log_flash_t *flash = kv_log_partition_flash();
+    return flash ? kv_log_mount(flash) : RUNTIME_ENOSYS;
+}
+
+static const rt_kv_backend_t s_kv_log_backend = {
+    .name = "kvlog",
+    .open = kv_log_backend_open,
+    .load = kv_log_get,
+    .store = kv_log_put,
+    .erase = kv_log_del,
+    .flush = kv_log_commit,
+    // Appends are cheap and spread over the partition; coalesce less.
+    .commit_window_ms = 100,
+};
+
+const rt_kv_backend_t *rt_kv_log_backend(void) {
+    return &s_kv_log_backend;
+}
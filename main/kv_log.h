@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rt_kv.h"
+
+// Log-structured key/value store on a raw flash partition (main/kv_log.c).
+// Entries are appended with a CRC and become visible at the next commit
+// record, so a power cut loses at most the batch in flight. A RAM index maps
+// key hash to the latest entry; a full log is compacted one sector at a time.
+
+// Raw flash the log lives on. Offsets are partition-relative; size is a
+// multiple of sector_size. Calls return RUNTIME_OK or RUNTIME_EIO.
+typedef struct {
+    uint32_t size;
+    uint32_t sector_size;
+    int (*read)(uint32_t off, void *buf, size_t len);
+    int (*write)(uint32_t off, const void *buf, size_t len); // onto erased bytes only
+    int (*erase)(uint32_t off);                               // one sector
+} kv_log_flash_t;
+
+// The "kvlog" data partition (main/kv_log_partition.c), or NULL if the
+// partition table has none. Host tests provide a simulated one.
+const kv_log_flash_t *kv_log_partition_flash(void);
+
+int kv_log_mount(const kv_log_flash_t *flash);
+int kv_log_get(const char *key, void *buf, size_t *len_inout);
+// put/del are staged; kv_log_commit makes the batch visible atomically.
+int kv_log_put(const char *key, const void *buf, size_t len);
+int kv_log_del(const char *key);
+int kv_log_commit(void);
+
+typedef struct {
+    uint32_t sectors;
+    uint32_t free_sectors;
+    uint32_t keys;
+    uint32_t live_bytes;
+    uint32_t gc_runs;
+    uint32_t erases;
+    uint32_t bytes_written;
+    uint32_t torn;          // incomplete entries or batches dropped at mount
+    uint32_t max_op_erases; // worst single put/del/commit, the latency bound
+    uint32_t max_op_bytes;
+} kv_log_stats_t;
+
+void kv_log_get_stats(kv_log_stats_t *out);
+
+// rt_kv storage over kv_log_partition_flash().
+const rt_kv_backend_t *rt_kv_log_backend(void);
@@ -0,0 +1,39 @@
+// The "kvlog" data partition as kv_log flash. esp_partition bounds-checks
+// every call against the partition, so a bad offset can't reach other data.
+
+#include "kv_log.h"
+
+#include "esp_partition.h"
+
+#define KV_LOG_PARTITION_LABEL "kvlog"
+#define KV_LOG_SECTOR_SIZE 4096
+
+static const esp_partition_t *s_part;
+
+static int kv_part_read(uint32_t off, void *buf, size_t len) {
+    return esp_partition_read(s_part, off, buf, len) == ESP_OK ? RUNTIME_OK : RUNTIME_EIO;
+}
+
+static int kv_part_write(uint32_t off, const void *buf, size_t len) {
+    return esp_partition_write(s_part, off, buf, len) == ESP_OK ? RUNTIME_OK : RUNTIME_EIO;
+}
+
+static int kv_part_erase(uint32_t off) {
+    return esp_partition_erase_range(s_part, off, KV_LOG_SECTOR_SIZE) == ESP_OK ? RUNTIME_OK : RUNTIME_EIO;
+}
+
+static kv_log_flash_t s_flash = {
+    .sector_size = KV_LOG_SECTOR_SIZE,
+    .read = kv_part_read,
+    .write = kv_part_write,
+    .erase = kv_part_erase,
+};
+
+const kv_log_flash_t *kv_log_partition_flash(void) {
+    if (!s_part) {
+        s_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, KV_LOG_PARTITION_LABEL);
+        if (!s_part) return NULL;
+        s_flash.size = s_part->size - s_part->size % KV_LOG_SECTOR_SIZE;
+    }
+    return &s_flash;
+}
@@ -11,18 +11,95 @@
 #include "esp_system.h"
 #include "esp_cpu.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+
+#include "app_manifest.h"
+#include "basalt_config.h"
+#include "rt_kv.h"
+#include "tft_console.h"
+
+// VM heap layout. Without PSRAM the primary GC area is the whole default heap
+// in internal RAM. With PSRAM the primary area is a fixed internal block and
+// the rest of the heap is added from PSRAM; the allocator searches the primary
+// area first after every collection, so the short-lived objects of a hot loop
+// land in fast RAM and large buffers spill to PSRAM. Boards set the default
+// with "mpy_heap_kb" in board.json; apps override it with app.toml heap_kb,
+// and heap_max_kb caps on-demand growth.
+#ifndef BASALT_MPY_HEAP_INTERNAL_KB
+#define BASALT_MPY_HEAP_INTERNAL_KB 32
+#endif
+#ifndef BASALT_MPY_HEAP_GROW_FACTOR
+#define BASALT_MPY_HEAP_GROW_FACTOR 2
+#endif
+#ifndef BASALT_MPY_HEAP_PSRAM_GROW_FACTOR
+#define BASALT_MPY_HEAP_PSRAM_GROW_FACTOR 4
+#endif
+// Internal RAM the heap never grows into (WiFi, drivers, task stacks).
+#ifndef BASALT_MPY_SYS_RESERVE_KB
+#define BASALT_MPY_SYS_RESERVE_KB 48
+#endif
+// Added areas carry their size in front, for the growth accounting.
+#define MPY_AREA_HEADER_LEN 16
+
+// App task scheduling; apps override it with app.toml core (0, 1 or "any"),
+// priority and stack_kb. On dual-core chips apps default to the second core,
+// leaving the first to the shell, TFT flush, touch and sampler tasks, which
+// then keep their latency while an app saturates its core.
+#ifndef BASALT_MPY_APP_CORE
+#if portNUM_PROCESSORS > 1
+#define BASALT_MPY_APP_CORE 1
+#else
+#define BASALT_MPY_APP_CORE -1
+#endif
+#endif
+#ifndef BASALT_MPY_APP_PRIO
+#define BASALT_MPY_APP_PRIO 5
+#endif
+// Kept below the basalt.stream sampler (10) so an app can't starve it.
+#ifndef BASALT_MPY_APP_PRIO_MAX
+#define BASALT_MPY_APP_PRIO_MAX 9
+#endif
+#ifndef BASALT_MPY_APP_STACK_KB
+#define BASALT_MPY_APP_STACK_KB 8
+#endif
+#define MPY_APP_STACK_KB_MIN 4
+#define MPY_APP_STACK_KB_MAX 64
 
 static bool s_ready = false;
-static uint8_t *s_heap = NULL;
-static size_t s_heap_size = 64 * 1024;
+static bool s_vm_used = false; // an app has run since the last (re)start
+static uint8_t *s_heap = NULL; // primary GC area, resident from first use
+static size_t s_heap_size = 0;
+static bool s_heap_psram = false; // added areas come from PSRAM
+static size_t s_heap_added = 0;   // bytes in areas added on top of s_heap
+static size_t s_heap_max = 0;     // growth cap for the current app
+// One long-lived task runs every app, so launches don't allocate and free a
+// stack each time. It is only re-created after a hard kill.
 static TaskHandle_t s_app_task = NULL;
+static int s_app_task_core = 0;         // affinity and stack the task was
+static unsigned s_app_task_stack_kb = 0; // created with; priority is changed live
+static volatile bool s_app_running = false;
 static char s_app_path[128] = {0};
 static char s_last_error[128] = {0};
 static char s_last_result[128] = "never-run";
+// GC telemetry of the last app to exit, for `gc`.
+static mp_embed_gc_stats_t s_last_gc;
+static char s_last_gc_app[128] = {0};
 static const char *TAG = "mpy_runtime";
 
+// Bytecode cache kept next to each script as "<stem>.mpc": "BMC1", the source
+// length and its FNV-1a hash (both u32 LE), then a standard .mpy image.
+#define MPY_CACHE_MAGIC "BMC1"
+#define MPY_CACHE_HEADER_LEN 12
+
+// Grace period for a cooperative stop before the app task is deleted: half
+// for KeyboardInterrupt, half for the uncatchable VM abort.
+#ifndef BASALT_MPY_STOP_GRACE_MS
+#define BASALT_MPY_STOP_GRACE_MS 600
+#endif
+
 // MicroPython embed port API
 #include "port/micropython_embed.h"
+#include "port/basalt_res.h"
 void basalt_module_init(void);
 #include "esp_heap_caps.h"
 
@@ -62,10 +139,79 @@ static bool fail_with(char *err_buf, size_t err_len, const char *fmt, ...) {
     return false;
 }
 
+static unsigned mpy_heap_default_kb(void) {
+#ifdef BASALT_MPY_HEAP_KB
+    return BASALT_MPY_HEAP_KB;
+#else
+    return s_heap_psram ? 256 : 64;
+#endif
+}
+
+static uint32_t mpy_heap_caps(void) {
+    return s_heap_psram ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void *mp_embed_heap_alloc(size_t size) {
+    uint8_t *p = heap_caps_malloc(size + MPY_AREA_HEADER_LEN, mpy_heap_caps());
+    if (!p) return NULL;
+    memcpy(p, &size, sizeof(size));
+    s_heap_added += size;
+    return p + MPY_AREA_HEADER_LEN;
+}
+
+void mp_embed_heap_free(void *ptr) {
+    uint8_t *p = (uint8_t *)ptr - MPY_AREA_HEADER_LEN;
+    size_t size;
+    memcpy(&size, p, sizeof(size));
+    s_heap_added -= size;
+    heap_caps_free(p);
+}
+
+// Upper bound for the next area the GC adds when an allocation fails.
+size_t gc_get_max_new_split(void) {
+    size_t have = s_heap_size + s_heap_added;
+    if (have >= s_heap_max) return 0;
+    size_t avail = heap_caps_get_largest_free_block(mpy_heap_caps());
+    if (!s_heap_psram) {
+        size_t free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        size_t reserve = (size_t)BASALT_MPY_SYS_RESERVE_KB * 1024;
+        size_t spare = free_internal > reserve ? free_internal - reserve : 0;
+        if (spare < avail) avail = spare;
+    }
+    avail = avail > MPY_AREA_HEADER_LEN ? avail - MPY_AREA_HEADER_LEN : 0;
+    size_t room = s_heap_max - have;
+    return avail < room ? avail : room;
+}
+
+// Sizes the heap for the app about to run from `script`. Call on a freshly
+// (re)started VM: only the primary area is resident at that point.
+static void mpy_heap_layout(const char *script) {
+    char toml[160];
+    unsigned heap_kb = mpy_heap_default_kb();
+    unsigned max_kb = 0;
+    if (app_manifest_path_for_script(script, toml, sizeof(toml))) {
+        heap_kb = app_manifest_get_uint(toml, "heap_kb", heap_kb);
+        max_kb = app_manifest_get_uint(toml, "heap_max_kb", 0);
+    }
+    size_t want = (size_t)heap_kb * 1024;
+    size_t grow = s_heap_psram ? BASALT_MPY_HEAP_PSRAM_GROW_FACTOR : BASALT_MPY_HEAP_GROW_FACTOR;
+    s_heap_max = max_kb ? (size_t)max_kb * 1024 : want * grow;
+    if (s_heap_max < want) s_heap_max = want;
+
+    size_t have = s_heap_size + s_heap_added;
+    if (want > have && !mp_embed_add_heap(want - have)) {
+        // Growth on demand may still find room in smaller pieces.
+        ESP_LOGW(TAG, "heap_kb=%u: could not add %u KB up front", heap_kb, (unsigned)((want - have) / 1024));
+    }
+}
+
 void mpy_runtime_init(void) {
     if (s_ready) return;
 
-    s_heap = heap_caps_malloc(s_heap_size, MALLOC_CAP_8BIT);
+    s_heap_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM) > 0;
+    s_heap_size = (size_t)(s_heap_psram ? BASALT_MPY_HEAP_INTERNAL_KB : mpy_heap_default_kb()) * 1024;
+    s_heap_max = s_heap_size;
+    s_heap = heap_caps_malloc(s_heap_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     if (!s_heap) {
         set_last_error("MicroPython heap allocation failed");
         s_ready = false;
@@ -79,14 +225,15 @@ void mpy_runtime_init(void) {
     s_ready = true;
 }
 
-static void mpy_runtime_deinit(void) {
-    if (!s_ready) return;
-    mp_embed_deinit();
-    if (s_heap) {
-        free(s_heap);
-        s_heap = NULL;
-    }
-    s_ready = false;
+// Gives the next app a clean VM without releasing the heap: the region stays
+// allocated from first use, so later launches skip the allocation (which can
+// fail on a fragmented heap) and the full bring-up.
+static void mpy_runtime_soft_reset(void) {
+    int64_t t0 = esp_timer_get_time();
+    mp_embed_soft_reset((void *)esp_cpu_get_sp());
+    basalt_module_init();
+    s_vm_used = false;
+    ESP_LOGI(TAG, "VM soft reset in %lld us", (long long)(esp_timer_get_time() - t0));
 }
 
 bool mpy_runtime_is_ready(void) {
@@ -94,11 +241,11 @@ bool mpy_runtime_is_ready(void) {
 }
 
 bool mpy_runtime_is_running(void) {
-    return s_app_task != NULL;
+    return s_app_running;
 }
 
 const char *mpy_runtime_current_app(void) {
-    return s_app_task ? s_app_path : NULL;
+    return s_app_running ? s_app_path : NULL;
 }
 
 const char *mpy_runtime_last_error(void) {
@@ -109,6 +256,149 @@ const char *mpy_runtime_last_result(void) {
     return s_last_result;
 }
 
+static bool has_suffix(const char *str, const char *suffix) {
+    size_t n = strlen(str);
+    size_t m = strlen(suffix);
+    return n >= m && strcmp(str + n - m, suffix) == 0;
+}
+
+static bool mpy_cache_path(const char *script, char *out, size_t out_len) {
+    if (!has_suffix(script, ".py")) return false;
+    int n = snprintf(out, out_len, "%.*s.mpc", (int)(strlen(script) - 3), script);
+    return n > 0 && (size_t)n < out_len;
+}
+
+static uint32_t fnv1a_update(uint32_t h, const uint8_t *p, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Functions decorated with these compile to machine code in executable RAM,
+// which a .mpy save can't capture, so such scripts bypass the cache.
+static const char *const MPY_NATIVE_MARKERS[] = {
+    "@micropython.native",
+    "@micropython.viper",
+    "@micropython.asm_",
+};
+#define MPY_NATIVE_MARKER_MAX 19 // strlen("@micropython.native")
+
+static bool mpy_has_native_marker(const uint8_t *p, size_t n) {
+    for (size_t m = 0; m < sizeof(MPY_NATIVE_MARKERS) / sizeof(MPY_NATIVE_MARKERS[0]); ++m) {
+        size_t len = strlen(MPY_NATIVE_MARKERS[m]);
+        for (size_t i = 0; i + len <= n; ++i) {
+            if (p[i] == '@' && memcmp(p + i, MPY_NATIVE_MARKERS[m], len) == 0) return true;
+        }
+    }
+    return false;
+}
+
+// Streams the source through the hash so a cache hit never buffers it. The
+// tail of each chunk is carried over so markers split across reads are seen.
+static bool mpy_source_digest(const char *path, uint32_t *len, uint32_t *hash, bool *native) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t buf[MPY_NATIVE_MARKER_MAX - 1 + 256];
+    uint32_t h = 2166136261u;
+    uint32_t total = 0;
+    size_t keep = 0;
+    size_t n;
+    *native = false;
+    while ((n = fread(buf + keep, 1, sizeof(buf) - keep, f)) > 0) {
+        h = fnv1a_update(h, buf + keep, n);
+        total += (uint32_t)n;
+        size_t have = keep + n;
+        if (!*native) *native = mpy_has_native_marker(buf, have);
+        keep = have < MPY_NATIVE_MARKER_MAX - 1 ? have : MPY_NATIVE_MARKER_MAX - 1;
+        memmove(buf, buf + have - keep, keep);
+    }
+    fclose(f);
+    *len = total;
+    *hash = h;
+    return true;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void mpy_cache_header(uint8_t *hdr, uint32_t len, uint32_t hash) {
+    memcpy(hdr, MPY_CACHE_MAGIC, 4);
+    put_u32(hdr + 4, len);
+    put_u32(hdr + 8, hash);
+}
+
+static bool mpy_cache_valid(const char *cache, uint32_t len, uint32_t hash) {
+    FILE *f = fopen(cache, "rb");
+    if (!f) return false;
+    uint8_t have[MPY_CACHE_HEADER_LEN];
+    uint8_t want[MPY_CACHE_HEADER_LEN];
+    bool ok = fread(have, 1, sizeof(have), f) == sizeof(have);
+    fclose(f);
+    mpy_cache_header(want, len, hash);
+    return ok && memcmp(have, want, sizeof(want)) == 0;
+}
+
+typedef struct {
+    FILE *f;
+    bool ok;
+} mpy_cache_writer_t;
+
+static void mpy_cache_write(void *ctx, const char *data, size_t len) {
+    mpy_cache_writer_t *w = ctx;
+    if (w->ok && fwrite(data, 1, len, w->f) != len) {
+        w->ok = false;
+    }
+}
+
+// Compiles `path` into its bytecode cache when the directory is writable.
+// With `run` set the module is then executed: from the fresh cache if one was
+// written, otherwise straight from the compiler output. The source streams
+// through the lexer, so script size is bounded by the VM heap, not by a
+// contiguous load buffer.
+static bool mpy_compile_file(const char *path, uint32_t src_len, uint32_t src_hash, bool run,
+                             char *err_buf, size_t err_len) {
+    char cache[160];
+    mpy_cache_writer_t w = { NULL, false };
+    if (mpy_cache_path(path, cache, sizeof(cache))) {
+        w.f = fopen(cache, "wb");
+    }
+    uint8_t hdr[MPY_CACHE_HEADER_LEN] = {0};
+    if (w.f) {
+        // The real header goes in last, so a torn write never looks valid.
+        w.ok = fwrite(hdr, 1, sizeof(hdr), w.f) == sizeof(hdr);
+    }
+
+    bool compiled = mp_embed_compile_file(path, w.f ? mpy_cache_write : NULL, &w, run && !w.f);
+    if (w.f) {
+        if (compiled && w.ok) {
+            mpy_cache_header(hdr, src_len, src_hash);
+            w.ok = fseek(w.f, 0, SEEK_SET) == 0 && fwrite(hdr, 1, sizeof(hdr), w.f) == sizeof(hdr);
+        }
+        if (fclose(w.f) != 0) w.ok = false;
+        if (!compiled || !w.ok) {
+            remove(cache);
+        }
+    }
+    if (!compiled) {
+        return fail_with(err_buf, err_len, "compile failed: %s", path);
+    }
+    if (run && w.f) {
+        if (w.ok && mp_embed_exec_mpy_file(cache, MPY_CACHE_HEADER_LEN)) {
+            return true;
+        }
+        // Cache write failed: compile again and run without saving.
+        if (!mp_embed_compile_file(path, NULL, NULL, true)) {
+            return fail_with(err_buf, err_len, "compile failed: %s", path);
+        }
+    }
+    return true;
+}
+
 bool mpy_runtime_run_file(const char *path, char *err_buf, size_t err_len) {
     if (!path || !path[0]) {
         return fail_with(err_buf, err_len, "missing script path");
@@ -120,92 +410,277 @@ bool mpy_runtime_run_file(const char *path, char *err_buf, size_t err_len) {
     if (!s_ready) {
         return fail_with(err_buf, err_len, "MicroPython VM init failed");
     }
+    if (s_vm_used) {
+        mpy_runtime_soft_reset();
+    } else {
+        // The VM may have been brought up from another task (e.g. install).
+        mp_embed_set_stack_top((void *)esp_cpu_get_sp());
+    }
+    s_vm_used = true;
+    mpy_heap_layout(path);
+    // Telemetry covers this app only, not an install's precompile before it.
+    mp_embed_gc_stats_reset();
 
-    FILE *f = fopen(path, "rb");
-    if (!f) {
+    if (has_suffix(path, ".mpy")) {
+        if (!mp_embed_exec_mpy_file(path, 0)) {
+            return fail_with(err_buf, err_len, "cannot load bytecode %s", path);
+        }
+    } else {
+        uint32_t src_len = 0;
+        uint32_t src_hash = 0;
+        bool native = false;
+        if (!mpy_source_digest(path, &src_len, &src_hash, &native)) {
+            return fail_with(err_buf, err_len, "cannot open %s", path);
+        }
+        char cache[160];
+        const char *frozen = mp_embed_frozen_app(src_len, src_hash);
+        if (frozen) {
+            // Byte-identical to a script frozen into flash: run the ROM copy.
+            if (!mp_embed_exec_frozen(frozen)) {
+                return fail_with(err_buf, err_len, "cannot load frozen %s", frozen);
+            }
+        } else if (native) {
+            if (!mp_embed_compile_file(path, NULL, NULL, true)) {
+                return fail_with(err_buf, err_len, "compile failed: %s", path);
+            }
+        } else {
+            bool hit = mpy_cache_path(path, cache, sizeof(cache)) &&
+                       mpy_cache_valid(cache, src_len, src_hash) &&
+                       mp_embed_exec_mpy_file(cache, MPY_CACHE_HEADER_LEN);
+            if (!hit && !mpy_compile_file(path, src_len, src_hash, true, err_buf, err_len)) {
+                return false;
+            }
+        }
+    }
+    clear_last_error();
+    set_last_result("completed");
+    return true;
+}
+
+bool mpy_runtime_precompile(const char *path, char *err_buf, size_t err_len) {
+    if (!path || !has_suffix(path, ".py")) {
+        return fail_with(err_buf, err_len, "not a Python script");
+    }
+    if (s_app_running) {
+        // The VM is single-threaded; the first run will compile instead.
+        return fail_with(err_buf, err_len, "app running");
+    }
+    if (!s_ready) {
+        mpy_runtime_init();
+    }
+    if (!s_ready) {
+        return fail_with(err_buf, err_len, "MicroPython VM init failed");
+    }
+    mp_embed_set_stack_top((void *)esp_cpu_get_sp());
+    uint32_t src_len = 0;
+    uint32_t src_hash = 0;
+    bool native = false;
+    char cache[160];
+    if (!mpy_source_digest(path, &src_len, &src_hash, &native)) {
         return fail_with(err_buf, err_len, "cannot open %s", path);
     }
-    fseek(f, 0, SEEK_END);
-    long sz = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    if (sz <= 0 || sz > 64 * 1024) {
-        fclose(f);
-        return fail_with(err_buf, err_len, "invalid script size");
+    if (native || mp_embed_frozen_app(src_len, src_hash)) {
+        return true; // compiled on each run, or already in flash
     }
-
-    char *buf = malloc(sz + 1);
-    if (!buf) {
-        fclose(f);
-        return fail_with(err_buf, err_len, "out of memory");
+    if (mpy_cache_path(path, cache, sizeof(cache)) && mpy_cache_valid(cache, src_len, src_hash)) {
+        return true;
     }
-    size_t want = (size_t)sz;
-    size_t n = fread(buf, 1, want, f);
-    fclose(f);
-    if (n != want) {
-        free(buf);
-        return fail_with(err_buf, err_len, "failed to read script (%u/%u bytes)",
-                         (unsigned)n, (unsigned)want);
+    return mpy_compile_file(path, src_len, src_hash, false, err_buf, err_len);
+}
+
+void mpy_runtime_format_gc_hist(const mp_embed_gc_stats_t *gc, char *buf, size_t len) {
+    size_t off = 0;
+    buf[0] = '\0';
+    for (int i = 0; i < MP_EMBED_GC_PAUSE_BUCKETS && off < len; ++i) {
+        unsigned bound = i < MP_EMBED_GC_PAUSE_BUCKETS - 1 ? MP_EMBED_GC_PAUSE_BUCKET_US(i)
+                                                          : MP_EMBED_GC_PAUSE_BUCKET_US(i - 1);
+        const char *op = i < MP_EMBED_GC_PAUSE_BUCKETS - 1 ? "<" : ">=";
+        int n = bound >= 1000 ? snprintf(buf + off, len - off, "%s%s%ums %u", off ? " " : "", op, bound / 1000,
+                                         (unsigned)gc->pause_hist[i])
+                              : snprintf(buf + off, len - off, "%s%s%uus %u", off ? " " : "", op, bound,
+                                         (unsigned)gc->pause_hist[i]);
+        if (n < 0) break;
+        off += (size_t)n;
     }
-    buf[n] = '\0';
+}
 
-    mp_embed_exec_str(buf);
-    free(buf);
-    clear_last_error();
-    set_last_result("completed");
+bool mpy_runtime_gc_stats(mp_embed_gc_stats_t *out, bool *live, const char **app) {
+    if (s_app_running) {
+        mp_embed_gc_stats_peek(out);
+        *live = true;
+        *app = s_app_path;
+        return true;
+    }
+    *live = false;
+    *app = s_last_gc_app;
+    if (!s_last_gc_app[0]) return false;
+    *out = s_last_gc;
     return true;
 }
 
+// Runs on the app task as the script returns, while the heap is still the
+// app's: one line for the log plus the snapshot `gc` shows afterwards.
+static void mpy_log_gc_stats(void) {
+    mp_embed_gc_stats_t gc;
+    mp_embed_gc_stats(&gc);
+    char hist[96];
+    mpy_runtime_format_gc_hist(&gc, hist, sizeof(hist));
+    ESP_LOGI(TAG, "heap %u KB in %u area(s)%s, peak %u KB, largest free %u KB; "
+             "%u collections, pause max %u us avg %u us [%s]; alloc %u KB at %u KB/s",
+             (unsigned)(gc.heap_total / 1024), (unsigned)gc.areas, s_heap_psram ? " (psram)" : "",
+             (unsigned)(gc.heap_peak / 1024), (unsigned)(gc.heap_max_free / 1024),
+             (unsigned)gc.collections, (unsigned)gc.max_pause_us,
+             gc.collections ? (unsigned)(gc.total_pause_us / gc.collections) : 0u, hist,
+             (unsigned)(gc.alloc_bytes / 1024),
+             gc.elapsed_ms ? (unsigned)(gc.alloc_bytes * 1000 / gc.elapsed_ms / 1024) : 0u);
+    s_last_gc = gc;
+    snprintf(s_last_gc_app, sizeof(s_last_gc_app), "%s", s_app_path);
+}
+
+// Everything an app may leave behind outside the VM heap.
+static void mpy_app_release(void) {
+    basalt_res_release_all();
+    // Commits the app left deferred reach flash now rather than on a timer.
+    rt_kv_sync();
+    // An app that left its canvas on still gets its last frame shown.
+    tft_console_canvas_end();
+}
+
 static void mpy_app_task(void *arg) {
-    char path[128];
-    snprintf(path, sizeof(path), "%s", (const char *)arg);
-    free(arg);
+    (void)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!s_app_running) continue; // late wake-up from a stop request
 
-    char err[128];
-    if (!mpy_runtime_run_file(path, err, sizeof(err))) {
-        // Start succeeds before app task runs; surface runtime errors here.
-        printf("run: %s\n", err);
-        fflush(stdout);
+        char err[128];
+        if (!mpy_runtime_run_file(s_app_path, err, sizeof(err))) {
+            // Start succeeds before app task runs; surface runtime errors here.
+            printf("run: %s\n", err);
+            fflush(stdout);
+        }
+        mpy_log_gc_stats();
+        mpy_app_release();
+        s_app_running = false;
     }
+}
 
-    s_app_path[0] = '\0';
-    s_app_task = NULL;
-    vTaskDelete(NULL);
+typedef struct {
+    int core; // -1: any
+    unsigned priority;
+    unsigned stack_kb;
+} mpy_app_sched_t;
+
+static void mpy_app_sched(const char *script, mpy_app_sched_t *out) {
+    out->core = BASALT_MPY_APP_CORE;
+    out->priority = BASALT_MPY_APP_PRIO;
+    out->stack_kb = BASALT_MPY_APP_STACK_KB;
+    char toml[160];
+    if (!app_manifest_path_for_script(script, toml, sizeof(toml))) return;
+    char core[8];
+    if (app_manifest_get(toml, "core", core, sizeof(core))) {
+        if (strcmp(core, "any") == 0) {
+            out->core = -1;
+        } else if (core[0] >= '0' && core[0] < '0' + portNUM_PROCESSORS && core[1] == '\0') {
+            out->core = core[0] - '0';
+        } else {
+            ESP_LOGW(TAG, "app.toml core=%s: not a core on this chip", core);
+        }
+    }
+    out->priority = app_manifest_get_uint(toml, "priority", out->priority);
+    if (out->priority < 1) out->priority = 1;
+    if (out->priority > BASALT_MPY_APP_PRIO_MAX) out->priority = BASALT_MPY_APP_PRIO_MAX;
+    out->stack_kb = app_manifest_get_uint(toml, "stack_kb", out->stack_kb);
+    if (out->stack_kb < MPY_APP_STACK_KB_MIN) out->stack_kb = MPY_APP_STACK_KB_MIN;
+    if (out->stack_kb > MPY_APP_STACK_KB_MAX) out->stack_kb = MPY_APP_STACK_KB_MAX;
+}
+
+// Affinity and stack size are fixed at creation, so a parked app task that
+// doesn't match the next app's settings is replaced; priority is just set.
+static bool mpy_app_task_prepare(const mpy_app_sched_t *sched) {
+    if (s_app_task && (s_app_task_core != sched->core || s_app_task_stack_kb != sched->stack_kb)) {
+        vTaskDelete(s_app_task);
+        s_app_task = NULL;
+    }
+    if (s_app_task) {
+        vTaskPrioritySet(s_app_task, sched->priority);
+        return true;
+    }
+    BaseType_t core = sched->core < 0 ? tskNO_AFFINITY : (BaseType_t)sched->core;
+    if (xTaskCreatePinnedToCore(mpy_app_task, "mpy_app", sched->stack_kb * 1024, NULL, sched->priority,
+                                &s_app_task, core) != pdPASS) {
+        s_app_task = NULL;
+        return false;
+    }
+    s_app_task_core = sched->core;
+    s_app_task_stack_kb = sched->stack_kb;
+    return true;
 }
 
 bool mpy_runtime_start_file(const char *path, char *err_buf, size_t err_len) {
     if (!path || !path[0]) {
         return fail_with(err_buf, err_len, "missing script path");
     }
-    if (s_app_task) {
+    if (s_app_running) {
         return fail_with(err_buf, err_len, "app already running");
     }
-    char *path_copy = malloc(strlen(path) + 1);
-    if (!path_copy) {
-        return fail_with(err_buf, err_len, "out of memory");
+    if (strlen(path) >= sizeof(s_app_path)) {
+        return fail_with(err_buf, err_len, "script path too long");
     }
-    strcpy(path_copy, path);
-    snprintf(s_app_path, sizeof(s_app_path), "%s", path);
-    if (xTaskCreate(mpy_app_task, "mpy_app", 8192, path_copy, 5, &s_app_task) != pdPASS) {
-        free(path_copy);
-        s_app_task = NULL;
-        s_app_path[0] = '\0';
-        return fail_with(err_buf, err_len, "failed to start app");
+    mpy_app_sched_t sched;
+    mpy_app_sched(path, &sched);
+    if (!mpy_app_task_prepare(&sched)) {
+        return fail_with(err_buf, err_len, "failed to start app (%u KB stack)", sched.stack_kb);
+    }
+    if (sched.core >= 0) {
+        ESP_LOGI(TAG, "app task: core %d, priority %u, stack %u KB", sched.core, sched.priority, sched.stack_kb);
+    } else {
+        ESP_LOGI(TAG, "app task: any core, priority %u, stack %u KB", sched.priority, sched.stack_kb);
     }
+    snprintf(s_app_path, sizeof(s_app_path), "%s", path);
+    s_app_running = true;
+    xTaskNotifyGive(s_app_task);
     clear_last_error();
     set_last_result("running");
     return true;
 }
 
+static bool mpy_wait_stopped(int ms) {
+    for (int waited = 0; s_app_running && waited < ms; waited += 10) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return !s_app_running;
+}
+
 bool mpy_runtime_stop(bool force, char *err_buf, size_t err_len) {
-    if (!s_app_task) {
+    if (!s_app_running) {
         return fail_with(err_buf, err_len, "no app running");
     }
-    // No cooperative stop yet; force kill for now.
-    (void)force;
-    vTaskDelete(s_app_task);
-    s_app_task = NULL;
+    bool stopped = false;
+    if (!force) {
+        // Ask first: the script unwinds through its finally blocks and the
+        // task releases the app's resources itself. A notify cuts short a
+        // sleep so the interrupt is seen without waiting it out.
+        mp_embed_interrupt();
+        xTaskNotifyGive(s_app_task);
+        stopped = mpy_wait_stopped(BASALT_MPY_STOP_GRACE_MS / 2);
+        if (!stopped) {
+            mp_embed_abort();
+            xTaskNotifyGive(s_app_task);
+            stopped = mpy_wait_stopped(BASALT_MPY_STOP_GRACE_MS / 2);
+        }
+        if (!stopped) {
+            ESP_LOGW(TAG, "app ignored stop for %d ms; killing it", BASALT_MPY_STOP_GRACE_MS);
+        }
+    }
+    if (!stopped) {
+        // Stuck in C code (or `kill`): delete the task. The next run soft-resets
+        // the VM, which drops the dead task's NLR frames and heap objects.
+        vTaskDelete(s_app_task);
+        s_app_task = NULL;
+        mpy_app_release();
+        s_app_running = false;
+    }
     s_app_path[0] = '\0';
-    mpy_runtime_deinit();
     clear_last_error();
     set_last_result(force ? "killed-by-user" : "stopped-by-user");
     return true;
@@ -3,12 +3,21 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "port/micropython_embed.h"
+
 void mpy_runtime_init(void);
 bool mpy_runtime_is_ready(void);
 bool mpy_runtime_run_file(const char *path, char *err_buf, size_t err_len);
+// Compiles a .py script into its "<stem>.mpc" bytecode cache without running it.
+bool mpy_runtime_precompile(const char *path, char *err_buf, size_t err_len);
 bool mpy_runtime_start_file(const char *path, char *err_buf, size_t err_len);
 bool mpy_runtime_stop(bool force, char *err_buf, size_t err_len);
 bool mpy_runtime_is_running(void);
 const char *mpy_runtime_current_app(void);
 const char *mpy_runtime_last_error(void);
 const char *mpy_runtime_last_result(void);
+// GC telemetry of the running app (heap figures as of its last collection),
+// else of the last app that exited. False if no app has run yet.
+bool mpy_runtime_gc_stats(mp_embed_gc_stats_t *out, bool *live, const char **app);
+// "<250us 3 <1ms 1 ..." for gc->pause_hist.
+void mpy_runtime_format_gc_hist(const mp_embed_gc_stats_t *gc, char *buf, size_t len);
@@ -0,0 +1,273 @@
+// Event bus behind rt_event_post/rt_event_poll (runtime/runtime_api.h).
+// Every subscriber owns one bounded MPMC ring per priority lane (Vyukov's
+// sequence-numbered cells), so posting from tasks on either core or from an
+// ISR never takes a lock: a producer claims a cell with one CAS and publishes
+// it with a release store. A poller sleeps on its task notification, so a post
+// and a stop request (mpy_runtime notifies the app task) both wake it. The
+// post path and the rings it touches live in IRAM and internal RAM, so
+// ESP_INTR_FLAG_IRAM handlers may post while the flash cache is off.
+
+#include "rt_events.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+
+// Lane sizes, powers of two. Lane 0 carries input (KEY, TOUCH) and is
+// drained first, so a burst of timer or user events can't delay a touch.
+#ifndef BASALT_RT_EVENT_INPUT_LANE_LEN
+#define BASALT_RT_EVENT_INPUT_LANE_LEN 16
+#endif
+#ifndef BASALT_RT_EVENT_LANE_LEN
+#define BASALT_RT_EVENT_LANE_LEN 32
+#endif
+#define RT_EVENT_LANES 2
+
+typedef struct {
+    atomic_uint seq;
+    rt_event_t evt;
+} rt_event_cell_t;
+
+typedef struct {
+    rt_event_cell_t *cells;
+    unsigned mask;
+    atomic_uint head; // next cell to fill
+    atomic_uint tail; // next cell to drain
+} rt_event_ring_t;
+
+enum { SUB_FREE = 0, SUB_CLAIMED, SUB_ACTIVE };
+
+typedef struct {
+    atomic_int state;
+    atomic_uint types;
+    atomic_uintptr_t waiter; // TaskHandle_t blocked in poll, or 0
+    atomic_uint delivered;
+    atomic_uint dropped;
+    rt_event_ring_t lanes[RT_EVENT_LANES];
+} rt_event_sub_t;
+
+static rt_event_sub_t s_subs[RT_EVENT_MAX_SUBSCRIBERS];
+static atomic_bool s_ready;
+static int s_default_sub = -1;
+
+static const unsigned k_lane_len[RT_EVENT_LANES] = {
+    BASALT_RT_EVENT_INPUT_LANE_LEN,
+    BASALT_RT_EVENT_LANE_LEN,
+};
+
+static int IRAM_ATTR rt_event_lane(rt_event_type_t type) {
+    return (type == RT_EVT_KEY || type == RT_EVT_TOUCH) ? 0 : 1;
+}
+
+static bool ring_alloc(rt_event_ring_t *r, unsigned len) {
+    // Touched from ISRs, so internal RAM even on PSRAM boards.
+    r->cells = heap_caps_malloc(len * sizeof(rt_event_cell_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!r->cells) return false;
+    r->mask = len - 1;
+    for (unsigned i = 0; i < len; ++i) {
+        atomic_init(&r->cells[i].seq, i);
+    }
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    return true;
+}
+
+static bool IRAM_ATTR ring_push(rt_event_ring_t *r, const rt_event_t *evt) {
+    unsigned pos = atomic_load_explicit(&r->head, memory_order_relaxed);
+    for (;;) {
+        rt_event_cell_t *cell = &r->cells[pos & r->mask];
+        unsigned seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&r->head, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                cell->evt = *evt;
+                atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; // full
+        } else {
+            pos = atomic_load_explicit(&r->head, memory_order_relaxed);
+        }
+    }
+}
+
+// Empty also covers a cell claimed by a producer that was preempted before
+// publishing it; that producer notifies the poller once it does.
+static bool IRAM_ATTR ring_pop(rt_event_ring_t *r, rt_event_t *out) {
+    unsigned pos = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    for (;;) {
+        rt_event_cell_t *cell = &r->cells[pos & r->mask];
+        unsigned seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        int diff = (int)(seq - (pos + 1));
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&r->tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                *out = cell->evt;
+                atomic_store_explicit(&cell->seq, pos + r->mask + 1, memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&r->tail, memory_order_relaxed);
+        }
+    }
+}
+
+static bool sub_pop(rt_event_sub_t *sub, rt_event_t *out) {
+    for (int lane = 0; lane < RT_EVENT_LANES; ++lane) {
+        if (ring_pop(&sub->lanes[lane], out)) return true;
+    }
+    return false;
+}
+
+static rt_event_sub_t *sub_get(int id) {
+    if (id < 0 || id >= RT_EVENT_MAX_SUBSCRIBERS) return NULL;
+    rt_event_sub_t *sub = &s_subs[id];
+    return atomic_load_explicit(&sub->state, memory_order_acquire) == SUB_ACTIVE ? sub : NULL;
+}
+
+int rt_event_subscribe(uint32_t type_mask) {
+    if (!atomic_load(&s_ready)) return RUNTIME_ENOSYS;
+    if (type_mask == 0) return RUNTIME_EINVAL;
+    for (int id = 0; id < RT_EVENT_MAX_SUBSCRIBERS; ++id) {
+        rt_event_sub_t *sub = &s_subs[id];
+        int expect = SUB_FREE;
+        if (!atomic_compare_exchange_strong(&sub->state, &expect, SUB_CLAIMED)) continue;
+        // Rings outlive unsubscribe (a post may still be writing to them), so
+        // a reused slot only needs draining.
+        for (int lane = 0; lane < RT_EVENT_LANES; ++lane) {
+            if (!sub->lanes[lane].cells && !ring_alloc(&sub->lanes[lane], k_lane_len[lane])) {
+                atomic_store(&sub->state, SUB_FREE);
+                return RUNTIME_ENOMEM;
+            }
+        }
+        rt_event_t stale;
+        while (sub_pop(sub, &stale)) {
+        }
+        atomic_store(&sub->waiter, 0);
+        atomic_store(&sub->delivered, 0);
+        atomic_store(&sub->dropped, 0);
+        atomic_store(&sub->types, type_mask);
+        atomic_store_explicit(&sub->state, SUB_ACTIVE, memory_order_release);
+        return id;
+    }
+    return RUNTIME_ENOMEM;
+}
+
+int rt_event_unsubscribe(int id) {
+    rt_event_sub_t *sub = sub_get(id);
+    if (!sub || id == s_default_sub) return RUNTIME_EINVAL;
+    atomic_store(&sub->types, 0);
+    atomic_store_explicit(&sub->state, SUB_FREE, memory_order_release);
+    return RUNTIME_OK;
+}
+
+int rt_event_init(void) {
+    if (atomic_load(&s_ready)) return RUNTIME_OK;
+    atomic_store(&s_ready, true);
+    int id = rt_event_subscribe(~RT_EVENT_MASK(RT_EVT_DIAG));
+    if (id < 0) {
+        atomic_store(&s_ready, false);
+        return id;
+    }
+    s_default_sub = id;
+    return RUNTIME_OK;
+}
+
+int IRAM_ATTR rt_event_post(const rt_event_t *evt) {
+    if (!evt || evt->type <= RT_EVT_NONE || evt->type >= RT_EVT_TYPE_COUNT) return RUNTIME_EINVAL;
+    if (!atomic_load_explicit(&s_ready, memory_order_acquire)) return RUNTIME_ENOSYS;
+    bool isr = xPortInIsrContext();
+    BaseType_t woken = pdFALSE;
+    int rc = RUNTIME_OK;
+    uint32_t bit = RT_EVENT_MASK(evt->type);
+    int lane = rt_event_lane(evt->type);
+    for (int id = 0; id < RT_EVENT_MAX_SUBSCRIBERS; ++id) {
+        rt_event_sub_t *sub = &s_subs[id];
+        if (atomic_load_explicit(&sub->state, memory_order_acquire) != SUB_ACTIVE) continue;
+        if (!(atomic_load_explicit(&sub->types, memory_order_relaxed) & bit)) continue;
+        rt_event_ring_t *ring = &sub->lanes[lane];
+        if (!ring_push(ring, evt)) {
+            // Nobody is draining: make room by dropping the oldest, so a
+            // poller that comes back sees current input rather than stale.
+            rt_event_t old;
+            if (ring_pop(ring, &old)) atomic_fetch_add_explicit(&sub->dropped, 1, memory_order_relaxed);
+            if (!ring_push(ring, evt)) {
+                atomic_fetch_add_explicit(&sub->dropped, 1, memory_order_relaxed);
+                rc = RUNTIME_ENOMEM;
+                continue;
+            }
+        }
+        atomic_fetch_add_explicit(&sub->delivered, 1, memory_order_relaxed);
+        // Pairs with the fence in rt_event_poll_sub: the push (a release
+        // store) must not be reordered after this load, or the poller can
+        // miss the event while we miss its registration.
+        atomic_thread_fence(memory_order_seq_cst);
+        TaskHandle_t waiter = (TaskHandle_t)atomic_load_explicit(&sub->waiter, memory_order_acquire);
+        if (!waiter) continue;
+        if (isr) {
+            vTaskNotifyGiveFromISR(waiter, &woken);
+        } else {
+            xTaskNotifyGive(waiter);
+        }
+    }
+    if (isr) portYIELD_FROM_ISR(woken);
+    return rc;
+}
+
+int rt_event_poll_sub(int id, rt_event_t *evt, uint32_t timeout_ms) {
+    if (!evt) return RUNTIME_EINVAL;
+    if (!atomic_load(&s_ready)) return RUNTIME_ENOSYS;
+    rt_event_sub_t *sub = sub_get(id);
+    if (!sub) return RUNTIME_EINVAL;
+    if (sub_pop(sub, evt)) return 1;
+    if (timeout_ms == 0) return 0;
+
+    // Register before the second check: a post landing in between leaves a
+    // pending notification, so the take below returns at once. The fence
+    // keeps the ring loads in sub_pop after the store; with the one in
+    // rt_event_post, either we see the event or the poster sees us.
+    atomic_store_explicit(&sub->waiter, (uintptr_t)xTaskGetCurrentTaskHandle(), memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+    int got = 0;
+    if (sub_pop(sub, evt)) {
+        got = 1;
+    } else {
+        TickType_t ticks = timeout_ms == RT_EVENT_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        if (ticks == 0) ticks = 1;
+        if (ulTaskNotifyTake(pdTRUE, ticks) > 0) {
+            got = sub_pop(sub, evt);
+        }
+    }
+    atomic_store_explicit(&sub->waiter, 0, memory_order_release);
+    return got;
+}
+
+int rt_event_poll(rt_event_t *evt, uint32_t timeout_ms) {
+    if (!atomic_load(&s_ready)) return RUNTIME_ENOSYS;
+    return rt_event_poll_sub(s_default_sub, evt, timeout_ms);
+}
+
+int rt_event_sub_stats(int id, rt_event_sub_stats_t *out) {
+    if (id < 0 || id >= RT_EVENT_MAX_SUBSCRIBERS || !out) return RUNTIME_EINVAL;
+    rt_event_sub_t *sub = &s_subs[id];
+    memset(out, 0, sizeof(*out));
+    out->active = atomic_load(&sub->state) == SUB_ACTIVE;
+    if (!out->active) return RUNTIME_OK;
+    out->types = atomic_load(&sub->types);
+    out->delivered = atomic_load(&sub->delivered);
+    out->dropped = atomic_load(&sub->dropped);
+    for (int lane = 0; lane < RT_EVENT_LANES; ++lane) {
+        rt_event_ring_t *r = &sub->lanes[lane];
+        out->depth += atomic_load(&r->head) - atomic_load(&r->tail);
+    }
+    return RUNTIME_OK;
+}
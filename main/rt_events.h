@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "runtime_api.h"
+
+// Subscriber slots, including the default one behind rt_event_poll.
+#define RT_EVENT_MAX_SUBSCRIBERS 4
+
+typedef struct {
+    bool active;
+    uint32_t types;     // RT_EVENT_MASK bits
+    uint32_t delivered; // events queued to this subscriber
+    uint32_t dropped;   // oldest events overwritten by a full lane
+    uint32_t depth;     // events waiting, both lanes
+} rt_event_sub_stats_t;
+
+int rt_event_sub_stats(int sub, rt_event_sub_stats_t *out);
+
+// Throughput/latency benchmark over RT_EVT_DIAG (main/rt_events_bench.c):
+// `producers` tasks post `events` in total, each of `subscribers` consumer
+// tasks receives them on its own subscription. Runs on target (`events bench`)
+// and on the host (tools/event_bench).
+typedef struct {
+    uint32_t events;
+    int producers;
+    int subscribers;
+} rt_event_bench_cfg_t;
+
+typedef struct {
+    uint32_t posted;
+    uint32_t received;   // summed over subscribers
+    uint32_t dropped;    // overwritten by full lanes (counted, not lost)
+    uint32_t lost;       // neither received nor counted as dropped
+    uint32_t misordered; // duplicates or out of order per producer
+    uint64_t elapsed_us;
+    uint32_t lat_p50_us;
+    uint32_t lat_p99_us;
+    uint32_t lat_max_us;
+} rt_event_bench_result_t;
+
+int rt_event_bench_run(const rt_event_bench_cfg_t *cfg, rt_event_bench_result_t *out);
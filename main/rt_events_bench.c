@@ -0,0 +1,188 @@
+// Event bus benchmark: producer tasks post RT_EVT_DIAG events stamped with
+// (producer, sequence, post time); one consumer task per subscription checks
+// that each producer's sequence only moves forward and samples the post to
+// poll latency. Built into the firmware and into tools/event_bench on the host.
+
+#include "rt_events.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#define BENCH_MAX_PRODUCERS 8
+#define BENCH_MAX_SAMPLES 512 // latency samples per consumer
+#define BENCH_BURST 16        // posts between yields, half the lane
+#define BENCH_IDLE_MS 50      // consumer exits this long after producers finish
+#define BENCH_STACK 3072
+#define BENCH_PRIO 4
+
+typedef struct {
+    int sub;
+    uint32_t received;
+    uint32_t misordered;
+    uint32_t next_seq[BENCH_MAX_PRODUCERS];
+    uint32_t samples[BENCH_MAX_SAMPLES];
+    uint32_t nsamples;
+    uint32_t stride;
+    uint64_t last_rx_us;
+} bench_consumer_t;
+
+typedef struct {
+    int id;
+    uint32_t count;
+} bench_producer_t;
+
+static atomic_int s_running;
+static atomic_bool s_producers_done;
+
+static void bench_producer_task(void *arg) {
+    bench_producer_t *p = arg;
+    rt_event_t evt = {.type = RT_EVT_DIAG, .code = (uint32_t)p->id};
+    for (uint32_t seq = 1; seq <= p->count; ++seq) {
+        evt.a = seq;
+        evt.b = (uint32_t)esp_timer_get_time();
+        rt_event_post(&evt);
+        if (seq % BENCH_BURST == 0) taskYIELD();
+    }
+    atomic_fetch_sub(&s_running, 1);
+    vTaskDelete(NULL);
+}
+
+static void bench_consumer_task(void *arg) {
+    bench_consumer_t *c = arg;
+    rt_event_t evt;
+    for (;;) {
+        int rc = rt_event_poll_sub(c->sub, &evt, BENCH_IDLE_MS);
+        if (rc <= 0) {
+            if (rc < 0 || atomic_load(&s_producers_done)) break;
+            continue;
+        }
+        uint64_t now = esp_timer_get_time();
+        c->last_rx_us = now;
+        c->received++;
+        // Drops leave gaps; going backwards means a duplicate or reorder.
+        if (evt.code < BENCH_MAX_PRODUCERS) {
+            if (evt.a < c->next_seq[evt.code]) {
+                c->misordered++;
+            } else {
+                c->next_seq[evt.code] = evt.a + 1;
+            }
+        }
+        if (c->received % c->stride == 0 && c->nsamples < BENCH_MAX_SAMPLES) {
+            c->samples[c->nsamples++] = (uint32_t)now - evt.b;
+        }
+    }
+    atomic_fetch_sub(&s_running, 1);
+    vTaskDelete(NULL);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int rt_event_bench_run(const rt_event_bench_cfg_t *cfg, rt_event_bench_result_t *out) {
+    if (!cfg || !out || cfg->events == 0) return RUNTIME_EINVAL;
+    if (cfg->producers < 1 || cfg->producers > BENCH_MAX_PRODUCERS) return RUNTIME_EINVAL;
+    if (cfg->subscribers < 1 || cfg->subscribers >= RT_EVENT_MAX_SUBSCRIBERS) return RUNTIME_EINVAL;
+    memset(out, 0, sizeof(*out));
+
+    int nc = cfg->subscribers, np = cfg->producers;
+    bench_consumer_t *cons = calloc((size_t)nc, sizeof(*cons));
+    bench_producer_t *prods = calloc((size_t)np, sizeof(*prods));
+    if (!cons || !prods) {
+        free(cons);
+        free(prods);
+        return RUNTIME_ENOMEM;
+    }
+    int rc = RUNTIME_OK;
+    int subscribed = 0;
+    uint64_t start = 0;
+    for (; subscribed < nc; ++subscribed) {
+        int sub = rt_event_subscribe(RT_EVENT_MASK(RT_EVT_DIAG));
+        if (sub < 0) {
+            rc = sub;
+            goto done;
+        }
+        cons[subscribed].sub = sub;
+        cons[subscribed].stride = cfg->events / BENCH_MAX_SAMPLES + 1;
+    }
+
+    atomic_store(&s_producers_done, false);
+    atomic_store(&s_running, 0);
+    for (int i = 0; i < nc; ++i) {
+        atomic_fetch_add(&s_running, 1);
+        if (xTaskCreate(bench_consumer_task, "evb_rx", BENCH_STACK, &cons[i], BENCH_PRIO, NULL) != pdPASS) {
+            atomic_fetch_sub(&s_running, 1);
+            atomic_store(&s_producers_done, true);
+            rc = RUNTIME_ENOMEM;
+            goto wait;
+        }
+    }
+
+    start = esp_timer_get_time();
+    int consumers_running = nc;
+    for (int i = 0; i < np; ++i) {
+        prods[i].id = i;
+        prods[i].count = cfg->events / (uint32_t)np + ((uint32_t)i < cfg->events % (uint32_t)np ? 1 : 0);
+        atomic_fetch_add(&s_running, 1);
+        if (xTaskCreate(bench_producer_task, "evb_tx", BENCH_STACK, &prods[i], BENCH_PRIO, NULL) != pdPASS) {
+            atomic_fetch_sub(&s_running, 1);
+            rc = RUNTIME_ENOMEM;
+            break;
+        }
+        out->posted += prods[i].count;
+    }
+    while (atomic_load(&s_running) > consumers_running) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    atomic_store(&s_producers_done, true);
+
+wait:
+    while (atomic_load(&s_running) > 0) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    if (rc != RUNTIME_OK) goto done;
+
+    uint32_t total = 0;
+    uint64_t last_rx = start;
+    for (int i = 0; i < nc; ++i) total += cons[i].nsamples;
+    uint32_t *lat = malloc((total ? total : 1) * sizeof(uint32_t));
+    if (!lat) {
+        rc = RUNTIME_ENOMEM;
+        goto done;
+    }
+    uint32_t n = 0;
+    for (int i = 0; i < nc; ++i) {
+        rt_event_sub_stats_t st;
+        rt_event_sub_stats(cons[i].sub, &st);
+        out->received += cons[i].received;
+        out->dropped += st.dropped;
+        out->misordered += cons[i].misordered;
+        if (cons[i].last_rx_us > last_rx) last_rx = cons[i].last_rx_us;
+        memcpy(&lat[n], cons[i].samples, cons[i].nsamples * sizeof(uint32_t));
+        n += cons[i].nsamples;
+    }
+    uint32_t expected = out->posted * (uint32_t)nc;
+    out->lost = expected > out->received + out->dropped ? expected - out->received - out->dropped : 0;
+    out->elapsed_us = last_rx - start;
+    if (n > 0) {
+        qsort(lat, n, sizeof(uint32_t), cmp_u32);
+        out->lat_p50_us = lat[n / 2];
+        out->lat_p99_us = lat[(n * 99) / 100];
+        out->lat_max_us = lat[n - 1];
+    }
+    free(lat);
+
+done:
+    for (int i = 0; i < subscribed; ++i) {
+        rt_event_unsubscribe(cons[i].sub);
+    }
+    free(cons);
+    free(prods);
+    return rc;
+}
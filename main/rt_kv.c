@@ -0,0 +1,360 @@
+// rt_kv_* (runtime/runtime_api.h): a read-through RAM cache over a storage
+// backend. Sets and deletes only touch the cache and mark the entry dirty; a
+// commit hands every dirty entry to the backend and flushes once. Commits that
+// follow a flash write within the backend's commit window are merged into one
+// deferred write, so an app that commits after every change still writes at
+// most once per window. Setting the value a key already has writes nothing.
+
+#include "rt_kv.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#ifndef BASALT_KV_CACHE_ENTRIES
+#define BASALT_KV_CACHE_ENTRIES 32
+#endif
+#ifndef BASALT_KV_COMMIT_WINDOW_MS
+#define BASALT_KV_COMMIT_WINDOW_MS 1000
+#endif
+#ifndef BASALT_KV_TASK_PRIO
+#define BASALT_KV_TASK_PRIO 2
+#endif
+#ifndef BASALT_KV_TASK_STACK
+#define BASALT_KV_TASK_STACK 3072
+#endif
+// Host builds swap in their own storage. The primary backend is tried first;
+// the default one is the fallback when it can't open.
+#ifndef BASALT_KV_PRIMARY_BACKEND
+#define BASALT_KV_PRIMARY_BACKEND rt_kv_log_backend
+#endif
+#ifndef BASALT_KV_DEFAULT_BACKEND
+#define BASALT_KV_DEFAULT_BACKEND rt_kv_nvs_backend
+#endif
+const rt_kv_backend_t *BASALT_KV_PRIMARY_BACKEND(void);
+const rt_kv_backend_t *BASALT_KV_DEFAULT_BACKEND(void);
+
+static const char *TAG = "rt_kv";
+
+typedef struct {
+    char key[RT_KV_KEY_MAX + 1];
+    uint8_t *val;   // NULL unless present
+    uint16_t len;
+    bool used;
+    bool present;   // false: the key is absent (or deleted, if dirty)
+    bool dirty;
+    uint32_t stamp; // last use, for eviction
+} kv_entry_t;
+
+static const rt_kv_backend_t *s_backend;
+static SemaphoreHandle_t s_kv_lock;
+static esp_timer_handle_t s_commit_timer;
+static TaskHandle_t s_kv_task;
+static bool s_kv_task_tried;
+static kv_entry_t s_cache[BASALT_KV_CACHE_ENTRIES];
+static uint32_t s_clock;
+static bool s_commit_pending;
+static int64_t s_last_flush_us;
+static rt_kv_stats_t s_stats;
+static int64_t s_window_us;
+
+static bool kv_key_ok(const char *key) {
+    size_t n = key ? strlen(key) : 0;
+    return n > 0 && n <= RT_KV_KEY_MAX;
+}
+
+static void kv_entry_clear(kv_entry_t *e) {
+    free(e->val);
+    memset(e, 0, sizeof(*e));
+}
+
+static kv_entry_t *kv_find(const char *key) {
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        kv_entry_t *e = &s_cache[i];
+        if (e->used && strcmp(e->key, key) == 0) {
+            e->stamp = ++s_clock;
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static int kv_flush_locked(void) {
+    uint32_t ops = 0, bytes = 0;
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        kv_entry_t *e = &s_cache[i];
+        if (!e->used || !e->dirty) continue;
+        int rc = e->present ? s_backend->store(e->key, e->val, e->len) : s_backend->erase(e->key);
+        if (rc != RUNTIME_OK) return rc; // entries stay dirty for the next try
+        ops++;
+        bytes += e->present ? e->len : 0;
+    }
+    if (ops > 0) {
+        int rc = s_backend->flush();
+        if (rc != RUNTIME_OK) return rc;
+        s_stats.flash_commits++;
+        s_stats.flash_ops += ops;
+        s_stats.bytes_written += bytes;
+    }
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        s_cache[i].dirty = false;
+    }
+    s_last_flush_us = esp_timer_get_time();
+    if (s_commit_pending) {
+        esp_timer_stop(s_commit_timer);
+        s_commit_pending = false;
+    }
+    return RUNTIME_OK;
+}
+
+// A free slot, else the least recently used clean one. With every entry
+// dirty there is none: writing them out to make room would put uncommitted
+// changes on flash, so the caller fails instead until the app commits.
+static kv_entry_t *kv_slot(void) {
+    kv_entry_t *victim = NULL;
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        kv_entry_t *e = &s_cache[i];
+        if (!e->used) return e;
+        if (!e->dirty && (!victim || e->stamp < victim->stamp)) victim = e;
+    }
+    if (victim) kv_entry_clear(victim);
+    return victim;
+}
+
+// Cached entry for key, reading it from the backend on a miss. Absent keys
+// are cached too, so repeated lookups of a missing key stay off flash.
+static int kv_lookup(const char *key, kv_entry_t **out) {
+    kv_entry_t *e = kv_find(key);
+    if (e) {
+        s_stats.cache_hits++;
+        *out = e;
+        return RUNTIME_OK;
+    }
+    size_t len = 0;
+    int rc = s_backend->load(key, NULL, &len);
+    if (rc != RUNTIME_OK && rc != RUNTIME_ENOENT) return rc;
+    if (rc == RUNTIME_OK && len > BASALT_KV_VALUE_MAX) return RUNTIME_ENOMEM;
+    uint8_t *val = NULL;
+    if (rc == RUNTIME_OK) {
+        val = malloc(len ? len : 1);
+        if (!val) return RUNTIME_ENOMEM;
+        rc = s_backend->load(key, val, &len);
+        if (rc != RUNTIME_OK) {
+            free(val);
+            return rc;
+        }
+    }
+    e = kv_slot();
+    if (!e) {
+        free(val);
+        return RUNTIME_ENOMEM;
+    }
+    strcpy(e->key, key);
+    e->used = true;
+    e->present = val != NULL;
+    e->val = val;
+    e->len = (uint16_t)len;
+    e->stamp = ++s_clock;
+    *out = e;
+    return RUNTIME_OK;
+}
+
+// A failed flush leaves the entries dirty and the commit pending, and tries
+// again one window later; rt_kv_sync and app exit retry it too.
+static void kv_deferred_flush(void) {
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    if (s_commit_pending) {
+        int rc = kv_flush_locked();
+        if (rc != RUNTIME_OK) {
+            ESP_LOGW(TAG, "deferred commit failed (%d); retrying", rc);
+            esp_timer_start_once(s_commit_timer, (uint64_t)s_window_us);
+        }
+    }
+    xSemaphoreGive(s_kv_lock);
+}
+
+static void kv_commit_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        kv_deferred_flush();
+    }
+}
+
+// The flush is an NVS commit or a kvlog GC copy and erase: tens of ms that
+// would hold up every other esp_timer callback (stream samplers included),
+// so the timer only wakes the worker.
+static void kv_commit_timer_cb(void *arg) {
+    (void)arg;
+    if (s_kv_task) {
+        xTaskNotifyGive(s_kv_task);
+        return;
+    }
+    kv_deferred_flush();
+}
+
+int rt_kv_init_backend(const rt_kv_backend_t *backend) {
+    if (!backend) return RUNTIME_EINVAL;
+    if (!s_kv_lock) {
+        s_kv_lock = xSemaphoreCreateMutex();
+        if (!s_kv_lock) return RUNTIME_ENOMEM;
+    }
+    if (!s_commit_timer) {
+        const esp_timer_create_args_t args = {.callback = kv_commit_timer_cb, .name = "rt_kv"};
+        if (esp_timer_create(&args, &s_commit_timer) != ESP_OK) return RUNTIME_ENOMEM;
+    }
+    if (!s_kv_task_tried) {
+        s_kv_task_tried = true;
+        if (xTaskCreate(kv_commit_task, "rt_kv", BASALT_KV_TASK_STACK, NULL, BASALT_KV_TASK_PRIO, &s_kv_task) != pdPASS) {
+            // Fall back to flushing from the timer callback.
+            s_kv_task = NULL;
+            ESP_LOGW(TAG, "rt_kv task unavailable; deferred commits run on the timer task");
+        }
+    }
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    if (s_commit_pending) esp_timer_stop(s_commit_timer);
+    s_commit_pending = false;
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        kv_entry_clear(&s_cache[i]);
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_backend = NULL;
+    int rc = backend->open();
+    if (rc == RUNTIME_OK) {
+        s_backend = backend;
+        s_stats.backend = backend->name;
+        uint32_t window_ms = backend->commit_window_ms ? backend->commit_window_ms : BASALT_KV_COMMIT_WINDOW_MS;
+        s_window_us = (int64_t)window_ms * 1000;
+        s_last_flush_us = esp_timer_get_time() - s_window_us;
+    }
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+int rt_kv_init(void) {
+    int rc = rt_kv_init_backend(BASALT_KV_PRIMARY_BACKEND());
+    if (rc == RUNTIME_OK) return rc;
+    if (rc != RUNTIME_ENOSYS) {
+        ESP_LOGW(TAG, "%s backend failed (%d), falling back", BASALT_KV_PRIMARY_BACKEND()->name, rc);
+    }
+    return rt_kv_init_backend(BASALT_KV_DEFAULT_BACKEND());
+}
+
+int rt_kv_get(const char *key, void *buf, size_t *len_inout) {
+    if (!kv_key_ok(key) || !len_inout) return RUNTIME_EINVAL;
+    if (!s_backend) return RUNTIME_ENOSYS;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    s_stats.gets++;
+    kv_entry_t *e = NULL;
+    int rc = kv_lookup(key, &e);
+    if (rc == RUNTIME_OK && !e->present) {
+        rc = RUNTIME_ENOENT;
+    } else if (rc == RUNTIME_OK) {
+        if (buf && *len_inout < e->len) {
+            rc = RUNTIME_EINVAL;
+        } else if (buf) {
+            memcpy(buf, e->val, e->len);
+        }
+        *len_inout = e->len;
+    }
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+int rt_kv_set(const char *key, const void *buf, size_t len) {
+    if (!kv_key_ok(key) || (!buf && len) || len > BASALT_KV_VALUE_MAX) return RUNTIME_EINVAL;
+    if (!s_backend) return RUNTIME_ENOSYS;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    s_stats.sets++;
+    kv_entry_t *e = NULL;
+    int rc = kv_lookup(key, &e);
+    if (rc == RUNTIME_OK && e->present && e->len == len && (len == 0 || memcmp(e->val, buf, len) == 0)) {
+        s_stats.sets_unchanged++;
+    } else if (rc == RUNTIME_OK) {
+        uint8_t *val = malloc(len ? len : 1);
+        if (!val) {
+            rc = RUNTIME_ENOMEM;
+        } else {
+            if (len) memcpy(val, buf, len);
+            free(e->val);
+            e->val = val;
+            e->len = (uint16_t)len;
+            e->present = true;
+            e->dirty = true;
+        }
+    }
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+int rt_kv_del(const char *key) {
+    if (!kv_key_ok(key)) return RUNTIME_EINVAL;
+    if (!s_backend) return RUNTIME_ENOSYS;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    s_stats.dels++;
+    kv_entry_t *e = NULL;
+    int rc = kv_lookup(key, &e);
+    if (rc == RUNTIME_OK && e->present) {
+        free(e->val);
+        e->val = NULL;
+        e->len = 0;
+        e->present = false;
+        e->dirty = true;
+    }
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+int rt_kv_commit(void) {
+    if (!s_backend) return RUNTIME_ENOSYS;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    s_stats.commits++;
+    int rc = RUNTIME_OK;
+    int64_t since = esp_timer_get_time() - s_last_flush_us;
+    int64_t window = s_window_us;
+    if (since >= window) {
+        rc = kv_flush_locked();
+    } else if (!s_commit_pending) {
+        // Nothing dirty means nothing to defer.
+        bool dirty = false;
+        for (int i = 0; i < BASALT_KV_CACHE_ENTRIES && !dirty; ++i) {
+            dirty = s_cache[i].used && s_cache[i].dirty;
+        }
+        if (dirty && esp_timer_start_once(s_commit_timer, (uint64_t)(window - since)) == ESP_OK) {
+            s_commit_pending = true;
+        } else if (dirty) {
+            rc = kv_flush_locked();
+        }
+    }
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+int rt_kv_sync(void) {
+    if (!s_backend) return RUNTIME_ENOSYS;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    int rc = s_commit_pending ? kv_flush_locked() : RUNTIME_OK;
+    xSemaphoreGive(s_kv_lock);
+    return rc;
+}
+
+void rt_kv_get_stats(rt_kv_stats_t *out) {
+    if (!out) return;
+    memset(out, 0, sizeof(*out));
+    if (!s_kv_lock) return;
+    xSemaphoreTake(s_kv_lock, portMAX_DELAY);
+    *out = s_stats;
+    for (int i = 0; i < BASALT_KV_CACHE_ENTRIES; ++i) {
+        if (!s_cache[i].used) continue;
+        out->cached++;
+        if (s_cache[i].dirty) out->dirty++;
+    }
+    out->commit_pending = s_commit_pending;
+    xSemaphoreGive(s_kv_lock);
+}
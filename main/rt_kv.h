@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "runtime_api.h"
+
+// Key length matches NVS (15 chars), so every backend takes the same keys.
+#define RT_KV_KEY_MAX 15
+#ifndef BASALT_KV_VALUE_MAX
+#define BASALT_KV_VALUE_MAX 512
+#endif
+
+// Storage under the rt_kv cache (main/rt_kv.c). The cache only calls store and
+// erase from inside a commit, followed by one flush.
+typedef struct {
+    const char *name;
+    int (*open)(void);
+    // RUNTIME_ENOENT if absent; with buf NULL, just reports the length.
+    int (*load)(const char *key, void *buf, size_t *len_inout);
+    int (*store)(const char *key, const void *buf, size_t len);
+    int (*erase)(const char *key); // absent keys are not an error
+    int (*flush)(void);            // make the stores since the last flush durable
+    uint32_t commit_window_ms;     // 0: BASALT_KV_COMMIT_WINDOW_MS
+} rt_kv_backend_t;
+
+const rt_kv_backend_t *rt_kv_nvs_backend(void);
+
+// rt_kv_init() uses the kvlog partition (main/kv_log.h) when the partition
+// table has one and NVS otherwise. Calling this again drops the cache (pending commits
+// included) and reopens, which the host tests use to simulate a reboot.
+int rt_kv_init_backend(const rt_kv_backend_t *backend);
+
+// Write a deferred commit now (app exit, reboot).
+int rt_kv_sync(void);
+
+typedef struct {
+    const char *backend;
+    uint32_t gets;
+    uint32_t cache_hits;
+    uint32_t sets;
+    uint32_t sets_unchanged; // same value as cached; nothing to write
+    uint32_t dels;
+    uint32_t commits;        // rt_kv_commit calls
+    uint32_t flash_commits;  // backend flushes, i.e. actual flash writes
+    uint32_t flash_ops;      // keys stored or erased by those flushes
+    uint32_t bytes_written;
+    uint32_t cached;         // entries in RAM
+    uint32_t dirty;          // of which changed since the last flush
+    bool commit_pending;
+} rt_kv_stats_t;
+
+void rt_kv_get_stats(rt_kv_stats_t *out);
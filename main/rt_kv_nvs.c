@@ -0,0 +1,67 @@
+// NVS storage for rt_kv: one blob per key in the "basalt_kv" namespace, so
+// app data never collides with IDF's own NVS users. nvs_set_blob already
+// writes the entry to flash, which is why rt_kv.c only calls it from a commit.
+
+#include "rt_kv.h"
+
+#include "nvs.h"
+
+#define RT_KV_NVS_NAMESPACE "basalt_kv"
+
+static nvs_handle_t s_nvs;
+static bool s_nvs_open;
+
+static int kv_nvs_err(esp_err_t err) {
+    switch (err) {
+    case ESP_OK:
+        return RUNTIME_OK;
+    case ESP_ERR_NVS_NOT_FOUND:
+        return RUNTIME_ENOENT;
+    case ESP_ERR_NVS_INVALID_LENGTH:
+    case ESP_ERR_NVS_INVALID_NAME:
+    case ESP_ERR_NVS_KEY_TOO_LONG:
+        return RUNTIME_EINVAL;
+    case ESP_ERR_NVS_NOT_ENOUGH_SPACE:
+    case ESP_ERR_NO_MEM:
+        return RUNTIME_ENOMEM;
+    default:
+        return RUNTIME_EIO;
+    }
+}
+
+static int kv_nvs_open(void) {
+    if (s_nvs_open) return RUNTIME_OK;
+    esp_err_t err = nvs_open(RT_KV_NVS_NAMESPACE, NVS_READWRITE, &s_nvs);
+    s_nvs_open = err == ESP_OK;
+    return kv_nvs_err(err);
+}
+
+static int kv_nvs_load(const char *key, void *buf, size_t *len_inout) {
+    return kv_nvs_err(nvs_get_blob(s_nvs, key, buf, len_inout));
+}
+
+static int kv_nvs_store(const char *key, const void *buf, size_t len) {
+    return kv_nvs_err(nvs_set_blob(s_nvs, key, buf, len));
+}
+
+static int kv_nvs_erase(const char *key) {
+    esp_err_t err = nvs_erase_key(s_nvs, key);
+    return err == ESP_ERR_NVS_NOT_FOUND ? RUNTIME_OK : kv_nvs_err(err);
+}
+
+static int kv_nvs_flush(void) {
+    return kv_nvs_err(nvs_commit(s_nvs));
+}
+
+static const rt_kv_backend_t s_kv_nvs_backend = {
+    .name = "nvs",
+    .open = kv_nvs_open,
+    .load = kv_nvs_load,
+    .store = kv_nvs_store,
+    .erase = kv_nvs_erase,
+    .flush = kv_nvs_flush,
+};
+
+const rt_kv_backend_t *rt_kv_nvs_backend(void) {
+    return &s_kv_nvs_backend;
+}
@@ -87,6 +87,14 @@ bool runtime_dispatch_start_file(basalt_runtime_kind_t kind, const char *path, c
     }
 }
 
+bool runtime_dispatch_precompile(basalt_runtime_kind_t kind, const char *path, char *err_buf, size_t err_len) {
+    if (kind == BASALT_RUNTIME_PYTHON) {
+        return mpy_runtime_precompile(path, err_buf, err_len);
+    }
+    // Lua scripts are loaded from source.
+    return true;
+}
+
 bool runtime_dispatch_stop(bool force, char *err_buf, size_t err_len) {
     bool ok = false;
     if (s_dispatch_last_runtime == BASALT_RUNTIME_LUA) {
@@ -13,6 +13,8 @@ basalt_runtime_kind_t runtime_kind_from_string(const char *name);
 const char *runtime_kind_name(basalt_runtime_kind_t kind);
 
 bool runtime_dispatch_start_file(basalt_runtime_kind_t kind, const char *path, char *err_buf, size_t err_len);
+// Builds the runtime's bytecode cache for `path`, if it has one.
+bool runtime_dispatch_precompile(basalt_runtime_kind_t kind, const char *path, char *err_buf, size_t err_len);
 bool runtime_dispatch_stop(bool force, char *err_buf, size_t err_len);
 bool runtime_dispatch_is_running(void);
 bool runtime_dispatch_is_ready(void);
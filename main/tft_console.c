@@ -2,11 +2,16 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
@@ -18,6 +23,7 @@
 // Board-generated pin assignments and feature gates
 #include "basalt_config.h"
 #include "bus_manager.h"
+#include "runtime_api.h"
 
 // -----------------------------------------------------------------------------
 // Display selection
@@ -124,24 +130,115 @@ static bool s_ready = false;
 static char s_screen[MAX_ROWS][MAX_COLS];
 static uint16_t s_color[MAX_ROWS][MAX_COLS];
 static uint16_t s_linebuf[BASALT_TFT_WIDTH * FONT_H];
+#define TFT_LINEBUF_PIXELS ((int)(sizeof(s_linebuf) / sizeof(s_linebuf[0])))
 static uint16_t s_fg = 0xFFFF;
 static uint16_t s_bg = 0x0000;
 static int s_row = 0;
 static int s_col = 0;
 static SemaphoreHandle_t s_tft_lock = NULL;
 
+// Last CASET/RASET programmed into the panel. Successive windows that share a
+// column or row range skip the redundant command (pixels, spans, text rows).
+static int s_win_x0 = -1;
+static int s_win_x1 = -1;
+static int s_win_y0 = -1;
+static int s_win_y1 = -1;
+
+// Fills stream one pattern buffer repeatedly into a single address window;
+// keep up to this many DMA transfers in flight (<= device queue_size).
+#define BASALT_TFT_FILL_QUEUE_DEPTH 4
+
+// Pending solid rectangle for span-based primitives. Horizontal spans with the
+// same extent on consecutive rows are merged before anything is sent.
+typedef struct {
+    bool active;
+    uint16_t color;
+    int x0;
+    int x1;
+    int y0;
+    int y1;
+} tft_span_batch_t;
+
+static tft_span_batch_t s_span;
+
+// Deferred text flush: writes only touch the cell buffers and mark a dirty
+// column span per row; a low-priority task pushes the spans to the panel at a
+// capped frame rate so bursts of printf output coalesce into a few transfers.
+#ifndef BASALT_TFT_FLUSH_INTERVAL_MS
+#define BASALT_TFT_FLUSH_INTERVAL_MS 33
+#endif
+#ifndef BASALT_TFT_FLUSH_TASK_PRIO
+#define BASALT_TFT_FLUSH_TASK_PRIO 2
+#endif
+#ifndef BASALT_TFT_FLUSH_TASK_STACK
+#define BASALT_TFT_FLUSH_TASK_STACK 3072
+#endif
+static int16_t s_dirty_lo[MAX_ROWS];
+static int16_t s_dirty_hi[MAX_ROWS];
+static bool s_any_dirty = false;
+static TaskHandle_t s_flush_task = NULL;
+
+// Scrollback: rows scrolled off the top land in a ring of packed cells (char
+// in the low byte, palette index in the high byte) so a line costs 2 bytes per
+// column instead of 3. BASALT_CFG_TFT_SCROLLBACK_LINES = 0 sizes the ring from
+// free PSRAM, or keeps one screen in internal RAM when there is none.
+#ifndef BASALT_CFG_TFT_SCROLLBACK_LINES
+#define BASALT_CFG_TFT_SCROLLBACK_LINES 0
+#endif
+#define TFT_SB_PALETTE 16
+#define TFT_SB_AUTO_MAX_LINES 8192
+#define TFT_SB_PSRAM_SHARE 8 // auto sizing takes at most 1/8 of free PSRAM
+
+static uint16_t *s_sb = NULL;
+static int s_sb_cap = 0;
+static int s_sb_head = 0;
+static int s_sb_count = 0;
+static uint16_t s_sb_palette[TFT_SB_PALETTE];
+static int s_sb_palette_count = 0;
+// Lines the viewport is scrolled back from the live screen; 0 = live.
+static int s_view = 0;
+
 #if defined(BASALT_PIN_TOUCH_CS)
 #define BASALT_TOUCH_CS BASALT_PIN_TOUCH_CS
 #else
 #define BASALT_TOUCH_CS -1
 #endif
 
-// XPT2046 defaults; can become board-configurable later.
-#define BASALT_TOUCH_X_MIN 200
-#define BASALT_TOUCH_X_MAX 3800
-#define BASALT_TOUCH_Y_MIN 200
-#define BASALT_TOUCH_Y_MAX 3800
+#if defined(BASALT_PIN_TOUCH_IRQ)
+#define BASALT_TOUCH_IRQ BASALT_PIN_TOUCH_IRQ
+#else
+#define BASALT_TOUCH_IRQ -1
+#endif
+
+// XPT2046 touch service. A task samples the controller only while the panel is
+// pressed: PENIRQ (when wired) wakes it from a blocked wait, otherwise it
+// checks pressure at a slow idle rate. Each report is the median of
+// BASALT_TOUCH_OVERSAMPLE conversions per axis, mapped through the Q16
+// calibration below and posted to the event queue as press/move/release.
 #define BASALT_TOUCH_Z_MIN 80
+#define BASALT_TOUCH_OVERSAMPLE 5
+#define BASALT_TOUCH_SAMPLE_MS 10
+#define BASALT_TOUCH_IDLE_POLL_MS 40
+#define BASALT_TOUCH_MOVE_MIN 2
+#define BASALT_TOUCH_QUEUE_LEN 16
+#define BASALT_TOUCH_TASK_PRIO 4
+#define BASALT_TOUCH_TASK_STACK 2560
+
+typedef struct {
+    tft_touch_cal_t cal;
+    int32_t scale_x; // Q16 screen pixels per raw unit
+    int32_t scale_y;
+} tft_touch_map_t;
+
+static tft_touch_map_t s_touch_map;
+static QueueHandle_t s_touch_queue = NULL;
+static TaskHandle_t s_touch_task = NULL;
+// Last report from the touch task; touch_read() serves it without SPI traffic.
+static volatile int s_touch_pressed = 0;
+static volatile int s_touch_x = -1;
+static volatile int s_touch_y = -1;
+static volatile int s_touch_raw_x = -1;
+static volatile int s_touch_raw_y = -1;
 
 static inline void tft_maybe_yield(int step) {
     if (step > 0 && (step % 4) == 0) {
@@ -273,6 +370,7 @@ static inline void tft_write_u8(uint8_t v) {
 }
 
 static void tft_reset(void) {
+    s_win_x0 = s_win_x1 = s_win_y0 = s_win_y1 = -1;
     if (BASALT_TFT_RST < 0) return;
     gpio_set_level(BASALT_TFT_RST, 0);
     vTaskDelay(pdMS_TO_TICKS(20));
@@ -413,19 +511,27 @@ static void tft_set_addr_window(int x0, int y0, int x1, int y1) {
     y0 += BASALT_TFT_Y_OFFSET;
     y1 += BASALT_TFT_Y_OFFSET;
     uint8_t data[4];
-    tft_write_cmd(0x2A);
-    data[0] = (x0 >> 8) & 0xFF;
-    data[1] = x0 & 0xFF;
-    data[2] = (x1 >> 8) & 0xFF;
-    data[3] = x1 & 0xFF;
-    tft_write_data(data, 4);
-
-    tft_write_cmd(0x2B);
-    data[0] = (y0 >> 8) & 0xFF;
-    data[1] = y0 & 0xFF;
-    data[2] = (y1 >> 8) & 0xFF;
-    data[3] = y1 & 0xFF;
-    tft_write_data(data, 4);
+    if (x0 != s_win_x0 || x1 != s_win_x1) {
+        tft_write_cmd(0x2A);
+        data[0] = (x0 >> 8) & 0xFF;
+        data[1] = x0 & 0xFF;
+        data[2] = (x1 >> 8) & 0xFF;
+        data[3] = x1 & 0xFF;
+        tft_write_data(data, 4);
+        s_win_x0 = x0;
+        s_win_x1 = x1;
+    }
+
+    if (y0 != s_win_y0 || y1 != s_win_y1) {
+        tft_write_cmd(0x2B);
+        data[0] = (y0 >> 8) & 0xFF;
+        data[1] = y0 & 0xFF;
+        data[2] = (y1 >> 8) & 0xFF;
+        data[3] = y1 & 0xFF;
+        tft_write_data(data, 4);
+        s_win_y0 = y0;
+        s_win_y1 = y1;
+    }
 
     tft_write_cmd(0x2C);
 }
@@ -438,6 +544,509 @@ static void tft_push_colors(const uint16_t *data, int len) {
     spi_device_polling_transmit(s_spi, &t);
 }
 
+// Stream `total` pixels into the current address window in transfers of at
+// most `chunk_len` pixels. With `advance` the source is consumed linearly
+// (bitmaps); without it the same pattern buffer is re-sent (solid fills).
+// Transfers are queued back to back so DMA keeps the bus busy; all of them
+// have completed when this returns.
+static void tft_push_chunks(const uint16_t *data, int chunk_len, int total, bool advance) {
+    if (!data || chunk_len <= 0 || total <= 0) return;
+    spi_transaction_t trans[BASALT_TFT_FILL_QUEUE_DEPTH];
+    int inflight = 0;
+    int slot = 0;
+
+    gpio_set_level(BASALT_TFT_DC, 1);
+    while (total > 0) {
+        int n = (total < chunk_len) ? total : chunk_len;
+        if (inflight == BASALT_TFT_FILL_QUEUE_DEPTH) {
+            spi_transaction_t *done = NULL;
+            spi_device_get_trans_result(s_spi, &done, portMAX_DELAY);
+            inflight--;
+        }
+        spi_transaction_t *t = &trans[slot];
+        memset(t, 0, sizeof(*t));
+        t->length = n * 16;
+        t->tx_buffer = data;
+        if (spi_device_queue_trans(s_spi, t, portMAX_DELAY) != ESP_OK) {
+            break;
+        }
+        inflight++;
+        slot = (slot + 1) % BASALT_TFT_FILL_QUEUE_DEPTH;
+        total -= n;
+        if (advance) data += n;
+    }
+    while (inflight > 0) {
+        spi_transaction_t *done = NULL;
+        spi_device_get_trans_result(s_spi, &done, portMAX_DELAY);
+        inflight--;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Off-screen canvas
+// -----------------------------------------------------------------------------
+// While a canvas is active every pixel the console produces (text, shapes,
+// blits) is composed off-screen and only reaches the panel on
+// tft_console_canvas_flush(), which sends the dirty regions once.
+//   - full: RGB565 frame (PSRAM when available); flush copies dirty
+//     rectangles out through s_linebuf.
+//   - band: no frame, a display list of fills/pixel rows is replayed into a
+//     small internal-RAM band per strip; only pixels some op covered are sent.
+// BASALT_CFG_TFT_CANVAS_MODE ("auto", "full", "band", "direct") picks the
+// backing; "auto" uses a full frame when PSRAM can hold it, else bands.
+
+#ifndef BASALT_CFG_TFT_CANVAS_MODE
+#define BASALT_CFG_TFT_CANVAS_MODE "auto"
+#endif
+#ifndef BASALT_CFG_TFT_CANVAS_BAND_ROWS
+#define BASALT_CFG_TFT_CANVAS_BAND_ROWS 16
+#endif
+#ifndef BASALT_CFG_TFT_CANVAS_LIST_KB
+#define BASALT_CFG_TFT_CANVAS_LIST_KB 64
+#endif
+// The band display list starts small and doubles as a frame needs it; only a
+// frame that outgrows BASALT_CFG_TFT_CANVAS_LIST_KB of pixel data is sent
+// before tft_console_canvas_flush().
+#define TFT_CANVAS_OPS_INIT 384
+#define TFT_CANVAS_OPS_MAX (TFT_CANVAS_OPS_INIT * 8)
+#define TFT_CANVAS_ARENA_INIT (BASALT_TFT_WIDTH * FONT_H * 2)
+#define TFT_CANVAS_ARENA_MAX (BASALT_CFG_TFT_CANVAS_LIST_KB * 1024 / 2)
+#define TFT_CANVAS_MAX_DIRTY 8
+#define TFT_CANVAS_STAGE_PIXELS (BASALT_TFT_WIDTH * 2)
+
+typedef enum {
+    TFT_CANVAS_OFF = 0,
+    TFT_CANVAS_FULL,
+    TFT_CANVAS_BAND,
+} tft_canvas_mode_t;
+
+typedef enum {
+    TFT_CANVAS_OP_FILL = 0,
+    TFT_CANVAS_OP_PIXELS,
+} tft_canvas_op_kind_t;
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint8_t kind;
+    uint16_t color;     // FILL
+    uint32_t offset;    // PIXELS: start in s_canvas_arena, w*h pixels
+} tft_canvas_op_t;
+
+typedef struct {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+} tft_rect_t;
+
+static tft_canvas_mode_t s_canvas_mode = TFT_CANVAS_OFF;
+static uint16_t *s_canvas_fb = NULL;
+static uint16_t *s_canvas_band = NULL;
+static uint16_t *s_canvas_stage = NULL;
+static uint8_t *s_canvas_cover = NULL;
+static int s_canvas_band_rows = 0;
+static tft_canvas_op_t *s_canvas_ops = NULL;
+static int s_canvas_op_count = 0;
+static int s_canvas_op_cap = 0;
+static uint16_t *s_canvas_arena = NULL;
+static int s_canvas_arena_used = 0;
+static int s_canvas_arena_cap = 0;
+static bool s_canvas_spill_warned = false;
+static tft_rect_t s_canvas_dirty[TFT_CANVAS_MAX_DIRTY];
+static int s_canvas_dirty_count = 0;
+
+static int64_t rect_area(const tft_rect_t *r) {
+    return (int64_t)(r->x1 - r->x0 + 1) * (int64_t)(r->y1 - r->y0 + 1);
+}
+
+static void rect_union(tft_rect_t *dst, const tft_rect_t *src) {
+    if (src->x0 < dst->x0) dst->x0 = src->x0;
+    if (src->y0 < dst->y0) dst->y0 = src->y0;
+    if (src->x1 > dst->x1) dst->x1 = src->x1;
+    if (src->y1 > dst->y1) dst->y1 = src->y1;
+}
+
+static bool rect_touches(const tft_rect_t *a, const tft_rect_t *b) {
+    return a->x0 <= b->x1 + 1 && b->x0 <= a->x1 + 1 && a->y0 <= b->y1 + 1 && b->y0 <= a->y1 + 1;
+}
+
+// Grow the dirty list by an already-clipped rectangle. Touching rectangles are
+// merged; when the list is full the new one joins whichever grows least.
+static void tft_canvas_mark(int x, int y, int w, int h) {
+    tft_rect_t r = { x, y, x + w - 1, y + h - 1 };
+    for (int i = 0; i < s_canvas_dirty_count; ++i) {
+        if (rect_touches(&s_canvas_dirty[i], &r)) {
+            rect_union(&s_canvas_dirty[i], &r);
+            return;
+        }
+    }
+    if (s_canvas_dirty_count < TFT_CANVAS_MAX_DIRTY) {
+        s_canvas_dirty[s_canvas_dirty_count++] = r;
+        return;
+    }
+    int best = 0;
+    int64_t best_growth = -1;
+    for (int i = 0; i < s_canvas_dirty_count; ++i) {
+        tft_rect_t u = s_canvas_dirty[i];
+        rect_union(&u, &r);
+        int64_t growth = rect_area(&u) - rect_area(&s_canvas_dirty[i]);
+        if (best_growth < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    rect_union(&s_canvas_dirty[best], &r);
+}
+
+// Copy rows of a caller buffer into the two halves of `stage` in turn, so
+// one half is being filled while DMA sends the other. Caller buffers (GC heap,
+// PSRAM, odd offsets) would otherwise get a driver bounce allocation per
+// transfer. `stage` holds at least two rows of the panel width.
+static void tft_push_staged(const uint16_t *src, int w, int h, int stride, uint16_t *stage, int stage_pixels) {
+    const int half = stage_pixels / 2;
+    // A block that fits the whole buffer goes out in one transfer.
+    const int rows_per_batch = (w * h <= stage_pixels) ? h : half / w;
+    spi_transaction_t trans[2];
+    int inflight = 0;
+    int slot = 0;
+
+    gpio_set_level(BASALT_TFT_DC, 1);
+    for (int y = 0; y < h; y += rows_per_batch) {
+        int rows = (h - y < rows_per_batch) ? h - y : rows_per_batch;
+        if (inflight == 2) {
+            // Results come back in order: this is the half about to be reused.
+            spi_transaction_t *done = NULL;
+            spi_device_get_trans_result(s_spi, &done, portMAX_DELAY);
+            inflight--;
+        }
+        uint16_t *buf = stage + (size_t)slot * (size_t)half;
+        for (int r = 0; r < rows; ++r) {
+            memcpy(buf + (size_t)r * (size_t)w, src + (size_t)(y + r) * (size_t)stride, (size_t)w * sizeof(uint16_t));
+        }
+        spi_transaction_t *t = &trans[slot];
+        memset(t, 0, sizeof(*t));
+        t->length = rows * w * 16;
+        t->tx_buffer = buf;
+        if (spi_device_queue_trans(s_spi, t, portMAX_DELAY) != ESP_OK) {
+            break;
+        }
+        inflight++;
+        slot ^= 1;
+    }
+    while (inflight > 0) {
+        spi_transaction_t *done = NULL;
+        spi_device_get_trans_result(s_spi, &done, portMAX_DELAY);
+        inflight--;
+    }
+}
+
+static bool tft_in_buf(const uint16_t *p, const uint16_t *buf, size_t len) {
+    return buf && p >= buf && p < buf + len;
+}
+
+// Pixels already in s_linebuf (decoded rows) or in whole aligned band rows go
+// to DMA as they are. Other band pixels are staged through s_canvas_stage:
+// a band spill happens while a caller's pixels may still sit in s_linebuf.
+// Everything else is staged through s_linebuf.
+static void tft_panel_put_pixels(int x, int y, int w, int h, const uint16_t *src, int stride) {
+    tft_set_addr_window(x, y, x + w - 1, y + h - 1);
+    bool direct = tft_in_buf(src, s_linebuf, TFT_LINEBUF_PIXELS);
+    bool in_band = tft_in_buf(src, s_canvas_band, (size_t)s_canvas_band_rows * BASALT_TFT_WIDTH);
+    if (in_band && (stride == w || h == 1) && ((uintptr_t)src & 3U) == 0) {
+        direct = true;
+    }
+    if (!direct && in_band) {
+        tft_push_staged(src, w, h, stride, s_canvas_stage, TFT_CANVAS_STAGE_PIXELS);
+    } else if (!direct) {
+        tft_push_staged(src, w, h, stride, s_linebuf, TFT_LINEBUF_PIXELS);
+    } else if (stride == w || h == 1) {
+        tft_push_chunks(src, TFT_LINEBUF_PIXELS, w * h, true);
+    } else {
+        for (int r = 0; r < h; ++r) {
+            tft_push_chunks(src + (size_t)r * (size_t)stride, TFT_LINEBUF_PIXELS, w, true);
+        }
+    }
+}
+
+static void cover_set(uint8_t *bits, int x0, int n) {
+    for (int x = x0; x < x0 + n; ++x) {
+        bits[x >> 3] |= (uint8_t)(1U << (x & 7));
+    }
+}
+
+static bool cover_get(const uint8_t *bits, int x) {
+    return (bits[x >> 3] >> (x & 7)) & 1U;
+}
+
+// Replay the display list one band at a time and send covered pixels.
+static void tft_canvas_band_flush(void) {
+    if (s_canvas_op_count == 0 || s_canvas_dirty_count == 0) {
+        s_canvas_op_count = 0;
+        s_canvas_arena_used = 0;
+        s_canvas_dirty_count = 0;
+        return;
+    }
+    int y_min = s_canvas_dirty[0].y0;
+    int y_max = s_canvas_dirty[0].y1;
+    for (int i = 1; i < s_canvas_dirty_count; ++i) {
+        if (s_canvas_dirty[i].y0 < y_min) y_min = s_canvas_dirty[i].y0;
+        if (s_canvas_dirty[i].y1 > y_max) y_max = s_canvas_dirty[i].y1;
+    }
+    const int cover_stride = (BASALT_TFT_WIDTH + 7) / 8;
+    int step = 0;
+    for (int by = y_min; by <= y_max; by += s_canvas_band_rows) {
+        int bh = s_canvas_band_rows;
+        if (by + bh - 1 > y_max) bh = y_max - by + 1;
+        memset(s_canvas_cover, 0, (size_t)cover_stride * (size_t)bh);
+
+        for (int i = 0; i < s_canvas_op_count; ++i) {
+            const tft_canvas_op_t *op = &s_canvas_ops[i];
+            int y0 = (op->y > by) ? op->y : by;
+            int y1 = op->y + op->h - 1;
+            if (y1 > by + bh - 1) y1 = by + bh - 1;
+            for (int yy = y0; yy <= y1; ++yy) {
+                uint16_t *row = s_canvas_band + (size_t)(yy - by) * BASALT_TFT_WIDTH;
+                if (op->kind == TFT_CANVAS_OP_FILL) {
+                    for (int xx = 0; xx < op->w; ++xx) {
+                        row[op->x + xx] = op->color;
+                    }
+                } else {
+                    const uint16_t *src = s_canvas_arena + op->offset + (size_t)(yy - op->y) * op->w;
+                    memcpy(row + op->x, src, (size_t)op->w * sizeof(uint16_t));
+                }
+                cover_set(s_canvas_cover + (size_t)(yy - by) * cover_stride, op->x, op->w);
+            }
+        }
+
+        // Fully covered rows are contiguous in the band and go out together.
+        int full_start = -1;
+        for (int r = 0; r <= bh; ++r) {
+            const uint8_t *bits = s_canvas_cover + (size_t)r * cover_stride;
+            bool full = false;
+            if (r < bh) {
+                full = true;
+                for (int x = 0; x < BASALT_TFT_WIDTH && full; ++x) {
+                    full = cover_get(bits, x);
+                }
+            }
+            if (full) {
+                if (full_start < 0) full_start = r;
+                continue;
+            }
+            if (full_start >= 0) {
+                tft_panel_put_pixels(0, by + full_start, BASALT_TFT_WIDTH, r - full_start,
+                                     s_canvas_band + (size_t)full_start * BASALT_TFT_WIDTH, BASALT_TFT_WIDTH);
+                full_start = -1;
+            }
+            if (r == bh) break;
+            const uint16_t *row = s_canvas_band + (size_t)r * BASALT_TFT_WIDTH;
+            int x = 0;
+            while (x < BASALT_TFT_WIDTH) {
+                while (x < BASALT_TFT_WIDTH && !cover_get(bits, x)) x++;
+                int start = x;
+                while (x < BASALT_TFT_WIDTH && cover_get(bits, x)) x++;
+                if (x > start) {
+                    tft_panel_put_pixels(start, by + r, x - start, 1, row + start, x - start);
+                }
+            }
+        }
+        step++;
+        tft_maybe_yield(step);
+    }
+    s_canvas_op_count = 0;
+    s_canvas_arena_used = 0;
+    s_canvas_dirty_count = 0;
+}
+
+static void tft_canvas_full_flush(void) {
+    int step = 0;
+    for (int i = 0; i < s_canvas_dirty_count; ++i) {
+        const tft_rect_t *d = &s_canvas_dirty[i];
+        int w = d->x1 - d->x0 + 1;
+        int rows_per_batch = TFT_LINEBUF_PIXELS / w;
+        tft_set_addr_window(d->x0, d->y0, d->x1, d->y1);
+        for (int y = d->y0; y <= d->y1; y += rows_per_batch) {
+            int rows = rows_per_batch;
+            if (y + rows - 1 > d->y1) rows = d->y1 - y + 1;
+            for (int r = 0; r < rows; ++r) {
+                memcpy(s_linebuf + (size_t)r * w,
+                       s_canvas_fb + (size_t)(y + r) * BASALT_TFT_WIDTH + d->x0,
+                       (size_t)w * sizeof(uint16_t));
+            }
+            tft_push_colors(s_linebuf, rows * w);
+            step++;
+            tft_maybe_yield(step);
+        }
+    }
+    s_canvas_dirty_count = 0;
+}
+
+static void tft_canvas_flush_locked(void) {
+    if (s_canvas_mode == TFT_CANVAS_FULL) {
+        tft_canvas_full_flush();
+    } else if (s_canvas_mode == TFT_CANVAS_BAND) {
+        tft_canvas_band_flush();
+    }
+}
+
+// Make room for one more op carrying `pixels` arena pixels, growing the list
+// so it is only replayed at tft_console_canvas_flush(). When it can't grow
+// the list is sent early; returns false if the op still doesn't fit.
+static bool tft_canvas_reserve(int pixels) {
+    if (s_canvas_op_count >= s_canvas_op_cap && s_canvas_op_cap * 2 <= TFT_CANVAS_OPS_MAX) {
+        int cap = s_canvas_op_cap * 2;
+        tft_canvas_op_t *ops = heap_caps_realloc(s_canvas_ops, sizeof(tft_canvas_op_t) * cap, MALLOC_CAP_8BIT);
+        if (ops) {
+            s_canvas_ops = ops;
+            s_canvas_op_cap = cap;
+        }
+    }
+    int need = s_canvas_arena_used + pixels;
+    if (need > s_canvas_arena_cap && need <= TFT_CANVAS_ARENA_MAX) {
+        int cap = s_canvas_arena_cap;
+        while (cap < need) cap *= 2;
+        if (cap > TFT_CANVAS_ARENA_MAX) cap = TFT_CANVAS_ARENA_MAX;
+        uint16_t *arena = heap_caps_realloc(s_canvas_arena, sizeof(uint16_t) * cap, MALLOC_CAP_8BIT);
+        if (arena) {
+            s_canvas_arena = arena;
+            s_canvas_arena_cap = cap;
+        }
+    }
+    if (s_canvas_op_count < s_canvas_op_cap && need <= s_canvas_arena_cap) return true;
+    if (!s_canvas_spill_warned) {
+        ESP_LOGW(TAG, "canvas display list full (%d ops, %d px), flushing mid-frame", s_canvas_op_count,
+                 s_canvas_arena_used);
+        s_canvas_spill_warned = true;
+    }
+    tft_canvas_band_flush();
+    return pixels <= s_canvas_arena_cap;
+}
+
+// Record a solid fill; rectangle already clipped.
+static void tft_canvas_fill(int x, int y, int w, int h, uint16_t color) {
+    if (s_canvas_mode == TFT_CANVAS_FULL) {
+        for (int r = 0; r < h; ++r) {
+            uint16_t *row = s_canvas_fb + (size_t)(y + r) * BASALT_TFT_WIDTH + x;
+            for (int c = 0; c < w; ++c) {
+                row[c] = color;
+            }
+        }
+    } else {
+        tft_canvas_reserve(0);
+        tft_canvas_op_t *op = &s_canvas_ops[s_canvas_op_count++];
+        op->x = (int16_t)x;
+        op->y = (int16_t)y;
+        op->w = (int16_t)w;
+        op->h = (int16_t)h;
+        op->kind = TFT_CANVAS_OP_FILL;
+        op->color = color;
+        op->offset = 0;
+    }
+    tft_canvas_mark(x, y, w, h);
+}
+
+// Record a block of pixels; rectangle already clipped.
+static void tft_canvas_pixels(int x, int y, int w, int h, const uint16_t *src, int stride) {
+    if (s_canvas_mode == TFT_CANVAS_FULL) {
+        for (int r = 0; r < h; ++r) {
+            memcpy(s_canvas_fb + (size_t)(y + r) * BASALT_TFT_WIDTH + x,
+                   src + (size_t)r * (size_t)stride, (size_t)w * sizeof(uint16_t));
+        }
+        tft_canvas_mark(x, y, w, h);
+        return;
+    }
+    int need = w * h;
+    if (!tft_canvas_reserve(need)) {
+        // Larger than the arena can grow: the list is empty now, so sending
+        // it straight away keeps the drawing order.
+        tft_panel_put_pixels(x, y, w, h, src, stride);
+        return;
+    }
+    uint16_t *dst = s_canvas_arena + s_canvas_arena_used;
+    for (int r = 0; r < h; ++r) {
+        memcpy(dst + (size_t)r * w, src + (size_t)r * (size_t)stride, (size_t)w * sizeof(uint16_t));
+    }
+    tft_canvas_op_t *op = &s_canvas_ops[s_canvas_op_count++];
+    op->x = (int16_t)x;
+    op->y = (int16_t)y;
+    op->w = (int16_t)w;
+    op->h = (int16_t)h;
+    op->kind = TFT_CANVAS_OP_PIXELS;
+    op->color = 0;
+    op->offset = (uint32_t)s_canvas_arena_used;
+    s_canvas_arena_used += need;
+    tft_canvas_mark(x, y, w, h);
+}
+
+static void tft_canvas_free(void) {
+    heap_caps_free(s_canvas_fb);
+    heap_caps_free(s_canvas_band);
+    heap_caps_free(s_canvas_stage);
+    heap_caps_free(s_canvas_cover);
+    heap_caps_free(s_canvas_ops);
+    heap_caps_free(s_canvas_arena);
+    s_canvas_fb = NULL;
+    s_canvas_band = NULL;
+    s_canvas_stage = NULL;
+    s_canvas_cover = NULL;
+    s_canvas_ops = NULL;
+    s_canvas_arena = NULL;
+    s_canvas_op_count = 0;
+    s_canvas_op_cap = 0;
+    s_canvas_arena_used = 0;
+    s_canvas_arena_cap = 0;
+    s_canvas_dirty_count = 0;
+    s_canvas_mode = TFT_CANVAS_OFF;
+}
+
+static bool tft_canvas_alloc_full(void) {
+    size_t bytes = (size_t)BASALT_TFT_WIDTH * BASALT_TFT_HEIGHT * sizeof(uint16_t);
+    s_canvas_fb = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!s_canvas_fb && strcmp(BASALT_CFG_TFT_CANVAS_MODE, "full") == 0) {
+        s_canvas_fb = heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    }
+    if (!s_canvas_fb) return false;
+    s_canvas_mode = TFT_CANVAS_FULL;
+    return true;
+}
+
+static bool tft_canvas_alloc_band(void) {
+    int rows = BASALT_CFG_TFT_CANVAS_BAND_ROWS;
+    if (rows < 1) rows = 1;
+    if (rows > BASALT_TFT_HEIGHT) rows = BASALT_TFT_HEIGHT;
+    const int cover_stride = (BASALT_TFT_WIDTH + 7) / 8;
+    s_canvas_band = heap_caps_malloc((size_t)rows * BASALT_TFT_WIDTH * sizeof(uint16_t),
+                                     MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    s_canvas_stage = heap_caps_malloc(sizeof(uint16_t) * TFT_CANVAS_STAGE_PIXELS, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    s_canvas_cover = heap_caps_malloc((size_t)rows * cover_stride, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    s_canvas_ops = heap_caps_malloc(sizeof(tft_canvas_op_t) * TFT_CANVAS_OPS_INIT, MALLOC_CAP_8BIT);
+    s_canvas_arena = heap_caps_malloc(sizeof(uint16_t) * TFT_CANVAS_ARENA_INIT, MALLOC_CAP_8BIT);
+    if (!s_canvas_band || !s_canvas_stage || !s_canvas_cover || !s_canvas_ops || !s_canvas_arena) {
+        tft_canvas_free();
+        return false;
+    }
+    s_canvas_band_rows = rows;
+    s_canvas_op_cap = TFT_CANVAS_OPS_INIT;
+    s_canvas_arena_cap = TFT_CANVAS_ARENA_INIT;
+    s_canvas_mode = TFT_CANVAS_BAND;
+    return true;
+}
+
+// Single entry points for everything that produces pixels.
+static void tft_put_fill(int x, int y, int w, int h, uint16_t color);
+
+static void tft_put_pixels(int x, int y, int w, int h, const uint16_t *src, int stride) {
+    if (w <= 0 || h <= 0) return;
+    if (s_canvas_mode != TFT_CANVAS_OFF) {
+        tft_canvas_pixels(x, y, w, h, src, stride);
+        return;
+    }
+    tft_panel_put_pixels(x, y, w, h, src, stride);
+}
+
 static int touch_read_adc(uint8_t cmd) {
     if (!s_touch_spi) return -1;
     uint8_t tx[3] = {cmd, 0x00, 0x00};
@@ -461,38 +1070,182 @@ static int touch_clamp(int v, int lo, int hi) {
     return v;
 }
 
-static void tft_draw_line(int row) {
+// Paint columns [c0, c1) of screen row `row` from one row of cells.
+static void tft_render_cells(int row, int c0, int c1, const char *text, const uint16_t *color) {
     if (row < 0 || row >= MAX_ROWS) return;
+    if (c0 < 0) c0 = 0;
+    if (c1 > MAX_COLS) c1 = MAX_COLS;
+    if (c0 >= c1) return;
     int y0 = row * FONT_H;
-    int y1 = y0 + FONT_H - 1;
+    int x0 = c0 * FONT_W;
+    // The last column also owns the unused pixels up to the panel edge.
+    int x1 = (c1 == MAX_COLS) ? (BASALT_TFT_WIDTH - 1) : (c1 * FONT_W - 1);
+    int w = x1 - x0 + 1;
 
-    for (int x = 0; x < BASALT_TFT_WIDTH * FONT_H; x++) {
-        s_linebuf[x] = s_bg;
+    for (int i = 0; i < w * FONT_H; i++) {
+        s_linebuf[i] = s_bg;
     }
 
-    for (int col = 0; col < MAX_COLS; col++) {
-        char ch = s_screen[row][col];
+    for (int col = c0; col < c1; col++) {
+        char ch = text[col];
         if (ch < 32 || ch > 127) ch = '?';
         const uint8_t *glyph = font5x7[ch - 32];
-        uint16_t fg = s_color[row][col];
-        int x0 = col * FONT_W;
+        uint16_t fg = color[col];
+        int gx0 = (col - c0) * FONT_W;
         for (int gx = 0; gx < 5; gx++) {
             uint8_t bits = glyph[gx];
             for (int gy = 0; gy < 7; gy++) {
                 if (bits & (1 << gy)) {
-                    int px = x0 + gx;
                     int py = gy + 1; // small top padding
-                    int idx = py * BASALT_TFT_WIDTH + px;
-                    if (idx >= 0 && idx < BASALT_TFT_WIDTH * FONT_H) {
-                        s_linebuf[idx] = fg;
-                    }
+                    s_linebuf[py * w + gx0 + gx] = fg;
                 }
             }
         }
     }
 
-    tft_set_addr_window(0, y0, BASALT_TFT_WIDTH - 1, y1);
-    tft_push_colors(s_linebuf, BASALT_TFT_WIDTH * FONT_H);
+    tft_put_pixels(x0, y0, w, FONT_H, s_linebuf, w);
+}
+
+static void tft_draw_span(int row, int c0, int c1) {
+    if (row < 0 || row >= MAX_ROWS) return;
+    tft_render_cells(row, c0, c1, s_screen[row], s_color[row]);
+}
+
+static void tft_dirty_reset(void) {
+    for (int r = 0; r < MAX_ROWS; r++) {
+        s_dirty_lo[r] = MAX_COLS;
+        s_dirty_hi[r] = 0;
+    }
+    s_any_dirty = false;
+}
+
+static void tft_mark_dirty(int row, int c0, int c1) {
+    if (row < 0 || row >= MAX_ROWS || c0 >= c1) return;
+    if (c0 < s_dirty_lo[row]) s_dirty_lo[row] = (int16_t)c0;
+    if (c1 > s_dirty_hi[row]) s_dirty_hi[row] = (int16_t)c1;
+    s_any_dirty = true;
+}
+
+// Caller holds s_tft_lock.
+// While the viewport shows scrollback, live rows stay dirty until it returns.
+static void tft_flush_dirty_locked(void) {
+    if (!s_any_dirty || s_view > 0) return;
+    int step = 0;
+    for (int r = 0; r < MAX_ROWS; r++) {
+        if (s_dirty_lo[r] >= s_dirty_hi[r]) continue;
+        tft_draw_span(r, s_dirty_lo[r], s_dirty_hi[r]);
+        s_dirty_lo[r] = MAX_COLS;
+        s_dirty_hi[r] = 0;
+        step++;
+        tft_maybe_yield(step);
+    }
+    s_any_dirty = false;
+}
+
+static int tft_sb_color_index(uint16_t c) {
+    for (int i = 0; i < s_sb_palette_count; i++) {
+        if (s_sb_palette[i] == c) return i;
+    }
+    if (s_sb_palette_count < TFT_SB_PALETTE) {
+        s_sb_palette[s_sb_palette_count] = c;
+        return s_sb_palette_count++;
+    }
+    // Palette full: nearest entry by per-channel distance.
+    int best = 0;
+    int best_d = INT32_MAX;
+    for (int i = 0; i < TFT_SB_PALETTE; i++) {
+        uint16_t p = s_sb_palette[i];
+        int dr = ((p >> 11) & 0x1F) - ((c >> 11) & 0x1F);
+        int dg = (((p >> 5) & 0x3F) - ((c >> 5) & 0x3F)) / 2;
+        int db = (p & 0x1F) - (c & 0x1F);
+        int d = dr * dr + dg * dg + db * db;
+        if (d < best_d) {
+            best_d = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static void tft_sb_alloc(void) {
+    const size_t line_bytes = MAX_COLS * sizeof(uint16_t);
+    int lines = BASALT_CFG_TFT_SCROLLBACK_LINES;
+    bool autosize = lines <= 0;
+    if (autosize) {
+        size_t free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        size_t fit = free_psram / TFT_SB_PSRAM_SHARE / line_bytes;
+        lines = fit > TFT_SB_AUTO_MAX_LINES ? TFT_SB_AUTO_MAX_LINES : (int)fit;
+    }
+    if (lines > 0) {
+        s_sb = heap_caps_malloc((size_t)lines * line_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (!s_sb) {
+        if (autosize || lines <= 0) lines = MAX_ROWS;
+        s_sb = heap_caps_malloc((size_t)lines * line_bytes, MALLOC_CAP_8BIT);
+    }
+    if (!s_sb) {
+        ESP_LOGW(TAG, "scrollback disabled (no memory for %d lines)", lines);
+        return;
+    }
+    s_sb_cap = lines;
+    ESP_LOGI(TAG, "scrollback: %d lines", lines);
+}
+
+// Caller holds s_tft_lock. Keeps a scrolled-back viewport anchored on the
+// same text while new lines arrive.
+static void tft_sb_push_row(int row) {
+    if (!s_sb) return;
+    int slot;
+    if (s_sb_count < s_sb_cap) {
+        slot = (s_sb_head + s_sb_count) % s_sb_cap;
+        s_sb_count++;
+    } else {
+        slot = s_sb_head;
+        s_sb_head = (s_sb_head + 1) % s_sb_cap;
+    }
+    uint16_t *cells = &s_sb[(size_t)slot * MAX_COLS];
+    for (int c = 0; c < MAX_COLS; c++) {
+        cells[c] = (uint8_t)s_screen[row][c] | (uint16_t)(tft_sb_color_index(s_color[row][c]) << 8);
+    }
+    if (s_view > 0 && s_view < s_sb_count) s_view++;
+}
+
+// History line `index` (0 = oldest ring line, then the live rows).
+static void tft_history_row(int index, char *text, uint16_t *color) {
+    if (index < s_sb_count) {
+        const uint16_t *cells = &s_sb[(size_t)((s_sb_head + index) % s_sb_cap) * MAX_COLS];
+        for (int c = 0; c < MAX_COLS; c++) {
+            text[c] = (char)(cells[c] & 0xFF);
+            color[c] = s_sb_palette[cells[c] >> 8];
+        }
+        return;
+    }
+    int row = index - s_sb_count;
+    memcpy(text, s_screen[row], MAX_COLS);
+    memcpy(color, s_color[row], MAX_COLS * sizeof(uint16_t));
+}
+
+// Caller holds s_tft_lock.
+static void tft_view_set_locked(int view) {
+    if (view < 0) view = 0;
+    if (view > s_sb_count) view = s_sb_count;
+    if (view == s_view) return;
+    s_view = view;
+    if (view == 0) {
+        for (int r = 0; r < MAX_ROWS; r++) {
+            tft_mark_dirty(r, 0, MAX_COLS);
+        }
+        tft_flush_dirty_locked();
+        return;
+    }
+    char text[MAX_COLS];
+    uint16_t color[MAX_COLS];
+    int top = s_sb_count - view;
+    for (int r = 0; r < MAX_ROWS; r++) {
+        tft_history_row(top + r, text, color);
+        tft_render_cells(r, 0, MAX_COLS, text, color);
+        tft_maybe_yield(r + 1);
+    }
 }
 
 static uint32_t isqrt_u32(uint32_t n) {
@@ -530,24 +1283,35 @@ static bool clip_rect(int *x, int *y, int *w, int *h) {
 
 static void tft_draw_pixel_raw(int x, int y, uint16_t color) {
     if (x < 0 || y < 0 || x >= BASALT_TFT_WIDTH || y >= BASALT_TFT_HEIGHT) return;
-    tft_set_addr_window(x, y, x, y);
-    tft_push_colors(&color, 1);
+    tft_put_fill(x, y, 1, 1, color);
 }
 
-static void tft_fill_rect_raw(int x, int y, int w, int h, uint16_t color) {
-    if (!clip_rect(&x, &y, &w, &h)) return;
-    if (w > BASALT_TFT_WIDTH) w = BASALT_TFT_WIDTH;
-
-    for (int i = 0; i < w; ++i) {
+// One address window for the whole rectangle; s_linebuf doubles as the
+// solid-colour pattern that is streamed into it. Rectangle already clipped.
+static void tft_put_fill(int x, int y, int w, int h, uint16_t color) {
+    if (s_canvas_mode != TFT_CANVAS_OFF) {
+        tft_canvas_fill(x, y, w, h, color);
+        return;
+    }
+    int total = w * h;
+    int pattern_len = TFT_LINEBUF_PIXELS;
+    if (pattern_len > total) pattern_len = total;
+    for (int i = 0; i < pattern_len; ++i) {
         s_linebuf[i] = color;
     }
-    for (int row = 0; row < h; ++row) {
-        int yy = y + row;
-        tft_set_addr_window(x, yy, x + w - 1, yy);
-        tft_push_colors(s_linebuf, w);
+    tft_set_addr_window(x, y, x + w - 1, y + h - 1);
+    if (total == 1) {
+        tft_push_colors(s_linebuf, 1);
+    } else {
+        tft_push_chunks(s_linebuf, pattern_len, total, false);
     }
 }
 
+static void tft_fill_rect_raw(int x, int y, int w, int h, uint16_t color) {
+    if (!clip_rect(&x, &y, &w, &h)) return;
+    tft_put_fill(x, y, w, h, color);
+}
+
 static void tft_draw_hline_raw(int x, int y, int w, uint16_t color) {
     tft_fill_rect_raw(x, y, w, 1, color);
 }
@@ -556,6 +1320,39 @@ static void tft_draw_vline_raw(int x, int y, int h, uint16_t color) {
     tft_fill_rect_raw(x, y, 1, h, color);
 }
 
+static void tft_span_flush(void) {
+    if (!s_span.active) return;
+    s_span.active = false;
+    tft_fill_rect_raw(s_span.x0, s_span.y0, s_span.x1 - s_span.x0 + 1, s_span.y1 - s_span.y0 + 1,
+                      s_span.color);
+}
+
+static void tft_span_begin(uint16_t color) {
+    tft_span_flush();
+    s_span.color = color;
+}
+
+// Queue pixels x0..x1 on row y; grows the pending rectangle when it continues
+// straight down, otherwise sends the pending one first.
+static void tft_span_add(int x0, int x1, int y) {
+    if (x1 < x0) {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (y < 0 || y >= BASALT_TFT_HEIGHT || x1 < 0 || x0 >= BASALT_TFT_WIDTH) return;
+    if (s_span.active && x0 == s_span.x0 && x1 == s_span.x1 && y == s_span.y1 + 1) {
+        s_span.y1 = y;
+        return;
+    }
+    tft_span_flush();
+    s_span.active = true;
+    s_span.x0 = x0;
+    s_span.x1 = x1;
+    s_span.y0 = y;
+    s_span.y1 = y;
+}
+
 static void tft_clear_screen(void) {
     // Clear text buffer
     for (int r = 0; r < MAX_ROWS; r++) {
@@ -564,22 +1361,13 @@ static void tft_clear_screen(void) {
             s_color[r][c] = s_fg;
         }
     }
+    tft_dirty_reset();
     // Fill display with background color (black)
-    for (int x = 0; x < BASALT_TFT_WIDTH * FONT_H; x++) {
-        s_linebuf[x] = s_bg;
-    }
-    int step = 0;
-    for (int y = 0; y < BASALT_TFT_HEIGHT; y += FONT_H) {
-        int y1 = y + FONT_H - 1;
-        if (y1 >= BASALT_TFT_HEIGHT) y1 = BASALT_TFT_HEIGHT - 1;
-        tft_set_addr_window(0, y, BASALT_TFT_WIDTH - 1, y1);
-        tft_push_colors(s_linebuf, BASALT_TFT_WIDTH * (y1 - y + 1));
-        step++;
-        tft_maybe_yield(step);
-    }
+    tft_fill_rect_raw(0, 0, BASALT_TFT_WIDTH, BASALT_TFT_HEIGHT, s_bg);
 }
 
 static void tft_scroll(void) {
+    tft_sb_push_row(0);
     for (int r = 1; r < MAX_ROWS; r++) {
         memcpy(s_screen[r - 1], s_screen[r], MAX_COLS);
         memcpy(s_color[r - 1], s_color[r], MAX_COLS * sizeof(uint16_t));
@@ -588,71 +1376,344 @@ static void tft_scroll(void) {
         s_screen[MAX_ROWS - 1][c] = ' ';
         s_color[MAX_ROWS - 1][c] = s_fg;
     }
+    // Every row moved; the next flush repaints them once no matter how many
+    // lines scrolled in between.
     for (int r = 0; r < MAX_ROWS; r++) {
-        tft_draw_line(r);
-        tft_maybe_yield(r + 1);
+        tft_mark_dirty(r, 0, MAX_COLS);
     }
 }
 
-void tft_console_write(const char *text) {
-    if (!s_ready || !text) return;
-    if (s_tft_lock) {
-        xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+static void tft_newline(void) {
+    s_row++;
+    s_col = 0;
+    if (s_row >= MAX_ROWS) {
+        s_row = MAX_ROWS - 1;
+        tft_scroll();
     }
-    bool dirty = false;
+}
 
-    for (const char *p = text; *p; p++) {
-        char ch = *p;
-        if (ch == '\n') {
-            tft_draw_line(s_row);
-            s_row++;
-            s_col = 0;
-            dirty = false;
-            if (s_row >= MAX_ROWS) {
-                s_row = MAX_ROWS - 1;
-                tft_scroll();
-            }
-            continue;
+// Hand pending text to the flush task, or paint it now when there is none.
+static void tft_request_flush(void) {
+    if (s_flush_task) {
+        xTaskNotifyGive(s_flush_task);
+        return;
+    }
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+static void tft_flush_task(void *arg) {
+    (void)arg;
+    const TickType_t interval = pdMS_TO_TICKS(BASALT_TFT_FLUSH_INTERVAL_MS);
+    TickType_t last = xTaskGetTickCount();
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TickType_t elapsed = xTaskGetTickCount() - last;
+        if (elapsed < interval) {
+            vTaskDelay(interval - elapsed);
         }
+        if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+        tft_flush_dirty_locked();
+        if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+        last = xTaskGetTickCount();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ANSI escape handling
+// -----------------------------------------------------------------------------
+// The console understands the subset of ECMA-48 that shell and log output use,
+// so one byte stream can feed both the UART and the panel:
+//   SGR (ESC[...m): 0 reset, 1/22 bold, 30-37/90-97 fg, 39 default fg,
+//                   38;5;n (xterm 256) and 38;2;r;g;b; background codes are
+//                   accepted and ignored (the console has one background).
+//   Cursor: A B C D (relative), H/f (row;col), G (column).
+//   Erase:  J (0/1/2 display), K (0/1/2 line).
+// The parser state survives across writes so sequences may be split.
+#define TFT_ANSI_MAX_PARAMS 8
+#define TFT_TAB_WIDTH 8
+
+typedef enum {
+    TFT_ANSI_TEXT = 0,
+    TFT_ANSI_ESC,
+    TFT_ANSI_CSI,
+} tft_ansi_state_t;
+
+static tft_ansi_state_t s_ansi_state = TFT_ANSI_TEXT;
+static uint16_t s_ansi_params[TFT_ANSI_MAX_PARAMS];
+static int s_ansi_nparams = 0;
+static bool s_ansi_bold = false;
+static int s_ansi_color = -1; // 0-7 when s_fg came from the 8-colour table
+
+#define TFT_DEFAULT_FG 0xFFFF
+
+static const uint16_t k_ansi_colors[16] = {
+    0x0000, 0xF800, 0x07E0, 0xFFE0, 0x001F, 0xF81F, 0x07FF, 0xC618, // normal
+    0x7BEF, 0xFB2C, 0x7FEF, 0xFFF0, 0x6B5F, 0xFB3F, 0x7FFF, 0xFFFF, // bright
+};
 
-        if (ch == '\r') continue;
+static uint16_t rgb888_to_565(int r, int g, int b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xFF) >> 3));
+}
 
-        if (s_row < 0) s_row = 0;
-        if (s_row >= MAX_ROWS) s_row = MAX_ROWS - 1;
-        if (s_col < 0) s_col = 0;
-        if (s_col >= MAX_COLS) {
-            tft_draw_line(s_row);
-            s_row++;
-            s_col = 0;
-            dirty = false;
-            if (s_row >= MAX_ROWS) {
-                s_row = MAX_ROWS - 1;
-                tft_scroll();
+static uint16_t ansi_256_color(int n) {
+    if (n < 16) return k_ansi_colors[n];
+    if (n < 232) {
+        static const uint8_t level[6] = {0, 95, 135, 175, 215, 255};
+        n -= 16;
+        return rgb888_to_565(level[n / 36], level[(n / 6) % 6], level[n % 6]);
+    }
+    int v = 8 + (n - 232) * 10;
+    return rgb888_to_565(v, v, v);
+}
+
+// Caller holds s_tft_lock.
+static void tft_erase_cells(int row, int c0, int c1) {
+    if (row < 0 || row >= MAX_ROWS) return;
+    if (c0 < 0) c0 = 0;
+    if (c1 > MAX_COLS) c1 = MAX_COLS;
+    if (c0 >= c1) return;
+    memset(&s_screen[row][c0], ' ', (size_t)(c1 - c0));
+    for (int c = c0; c < c1; c++) s_color[row][c] = s_fg;
+    tft_mark_dirty(row, c0, c1);
+}
+
+static void tft_ansi_sgr(void) {
+    if (s_ansi_nparams == 0) s_ansi_params[s_ansi_nparams++] = 0;
+    for (int i = 0; i < s_ansi_nparams; i++) {
+        int p = s_ansi_params[i];
+        if (p == 0) {
+            s_fg = TFT_DEFAULT_FG;
+            s_ansi_bold = false;
+            s_ansi_color = -1;
+        } else if (p == 1 || p == 22) {
+            s_ansi_bold = (p == 1);
+            if (s_ansi_color >= 0) s_fg = k_ansi_colors[s_ansi_color + (s_ansi_bold ? 8 : 0)];
+        } else if (p >= 30 && p <= 37) {
+            s_ansi_color = p - 30;
+            s_fg = k_ansi_colors[s_ansi_color + (s_ansi_bold ? 8 : 0)];
+        } else if (p >= 90 && p <= 97) {
+            s_ansi_color = -1;
+            s_fg = k_ansi_colors[p - 90 + 8];
+        } else if (p == 39) {
+            s_ansi_color = -1;
+            s_fg = TFT_DEFAULT_FG;
+        } else if (p == 38 || p == 48) {
+            // Extended colour: consume its arguments; only foreground applies.
+            uint16_t c = s_fg;
+            if (i + 2 < s_ansi_nparams && s_ansi_params[i + 1] == 5) {
+                c = ansi_256_color(s_ansi_params[i + 2] & 0xFF);
+                i += 2;
+            } else if (i + 4 < s_ansi_nparams && s_ansi_params[i + 1] == 2) {
+                c = rgb888_to_565(s_ansi_params[i + 2], s_ansi_params[i + 3], s_ansi_params[i + 4]);
+                i += 4;
+            } else {
+                i = s_ansi_nparams;
+            }
+            if (p == 38) {
+                s_ansi_color = -1;
+                s_fg = c;
             }
         }
+    }
+}
+
+// Caller holds s_tft_lock.
+static void tft_ansi_csi(char final) {
+    int n = (s_ansi_nparams > 0 && s_ansi_params[0] > 0) ? s_ansi_params[0] : 1;
+    int mode = s_ansi_nparams > 0 ? s_ansi_params[0] : 0;
+    switch (final) {
+        case 'm':
+            tft_ansi_sgr();
+            break;
+        case 'A': s_row -= n; break;
+        case 'B': s_row += n; break;
+        case 'C': s_col += n; break;
+        case 'D': s_col -= n; break;
+        case 'G': s_col = n - 1; break;
+        case 'H':
+        case 'f':
+            s_row = n - 1;
+            s_col = (s_ansi_nparams > 1 && s_ansi_params[1] > 0) ? s_ansi_params[1] - 1 : 0;
+            break;
+        case 'J':
+            if (mode == 0) {
+                tft_erase_cells(s_row, s_col, MAX_COLS);
+                for (int r = s_row + 1; r < MAX_ROWS; r++) tft_erase_cells(r, 0, MAX_COLS);
+            } else if (mode == 1) {
+                for (int r = 0; r < s_row; r++) tft_erase_cells(r, 0, MAX_COLS);
+                tft_erase_cells(s_row, 0, s_col + 1);
+            } else {
+                for (int r = 0; r < MAX_ROWS; r++) tft_erase_cells(r, 0, MAX_COLS);
+            }
+            break;
+        case 'K':
+            if (mode == 0) {
+                tft_erase_cells(s_row, s_col, MAX_COLS);
+            } else if (mode == 1) {
+                tft_erase_cells(s_row, 0, s_col + 1);
+            } else {
+                tft_erase_cells(s_row, 0, MAX_COLS);
+            }
+            break;
+        default:
+            break; // unsupported sequences are swallowed, not printed
+    }
+    if (s_row < 0) s_row = 0;
+    if (s_row >= MAX_ROWS) s_row = MAX_ROWS - 1;
+    if (s_col < 0) s_col = 0;
+    if (s_col > MAX_COLS - 1) s_col = MAX_COLS - 1;
+}
 
-        s_screen[s_row][s_col] = ch;
-        s_color[s_row][s_col] = s_fg;
-        s_col++;
-        dirty = true;
+// Consume one byte of an escape sequence. Caller holds s_tft_lock.
+static void tft_ansi_byte(char ch) {
+    if (s_ansi_state == TFT_ANSI_ESC) {
+        if (ch == '[') {
+            s_ansi_state = TFT_ANSI_CSI;
+            s_ansi_nparams = 0;
+            s_ansi_params[0] = 0;
+        } else {
+            s_ansi_state = TFT_ANSI_TEXT; // two-byte escapes are ignored
+        }
+        return;
+    }
+    if (ch >= '0' && ch <= '9') {
+        if (s_ansi_nparams == 0) s_ansi_nparams = 1;
+        uint16_t *p = &s_ansi_params[s_ansi_nparams - 1];
+        if (*p < 10000) *p = (uint16_t)(*p * 10 + (ch - '0'));
+    } else if (ch == ';') {
+        if (s_ansi_nparams == 0) s_ansi_nparams = 1;
+        if (s_ansi_nparams < TFT_ANSI_MAX_PARAMS) s_ansi_params[s_ansi_nparams++] = 0;
+    } else if (ch >= 0x40 && ch <= 0x7E) {
+        tft_ansi_csi(ch);
+        s_ansi_state = TFT_ANSI_TEXT;
+    } else if (ch < 0x20 || ch > 0x3F) {
+        s_ansi_state = TFT_ANSI_TEXT; // malformed; drop it
+    }
+    // '?' and other parameter bytes are accepted and ignored.
+}
+
+void tft_console_write(const char *text) {
+    if (!s_ready || !text) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
 
-        if (s_col >= MAX_COLS) {
-            tft_draw_line(s_row);
-            s_row++;
-            s_col = 0;
-            dirty = false;
-            if (s_row >= MAX_ROWS) {
-                s_row = MAX_ROWS - 1;
-                tft_scroll();
+    const char *p = text;
+    while (*p) {
+        if (s_ansi_state != TFT_ANSI_TEXT) {
+            tft_ansi_byte(*p++);
+            continue;
+        }
+        char ch = *p;
+        if ((unsigned char)ch >= 0x20 && ch != 0x7F) {
+            // Printable run: copy up to the end of the row in one go.
+            if (s_col >= MAX_COLS) tft_newline();
+            int room = MAX_COLS - s_col;
+            int n = 0;
+            while (n < room && (unsigned char)p[n] >= 0x20 && p[n] != 0x7F) n++;
+            memcpy(&s_screen[s_row][s_col], p, (size_t)n);
+            for (int c = s_col; c < s_col + n; c++) s_color[s_row][c] = s_fg;
+            tft_mark_dirty(s_row, s_col, s_col + n);
+            s_col += n;
+            p += n;
+            if (s_col >= MAX_COLS) tft_newline();
+            continue;
+        }
+        p++;
+        switch (ch) {
+            case '\x1b':
+                s_ansi_state = TFT_ANSI_ESC;
+                break;
+            case '\n':
+                tft_newline();
+                break;
+            case '\r':
+                s_col = 0;
+                break;
+            case '\b':
+                if (s_col > 0) s_col--;
+                break;
+            case '\t': {
+                int next = (s_col / TFT_TAB_WIDTH + 1) * TFT_TAB_WIDTH;
+                if (next > MAX_COLS) next = MAX_COLS;
+                tft_erase_cells(s_row, s_col, next);
+                s_col = next;
+                if (s_col >= MAX_COLS) tft_newline();
+                break;
             }
+            default:
+                break; // other C0 controls are not rendered
         }
     }
 
-    if (dirty) {
-        tft_draw_line(s_row);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    tft_request_flush();
+}
+
+void tft_console_flush(void) {
+    if (!s_ready) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+bool tft_console_canvas_begin(void) {
+    if (!s_ready) return false;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    bool ok = s_canvas_mode != TFT_CANVAS_OFF;
+    if (!ok) {
+        const char *mode = BASALT_CFG_TFT_CANVAS_MODE;
+        if (strcmp(mode, "full") == 0) {
+            ok = tft_canvas_alloc_full();
+        } else if (strcmp(mode, "band") == 0) {
+            ok = tft_canvas_alloc_band();
+        } else if (strcmp(mode, "auto") == 0) {
+            ok = tft_canvas_alloc_full() || tft_canvas_alloc_band();
+        }
+        if (ok && s_canvas_mode == TFT_CANVAS_FULL) {
+            // Seed the frame with the console text so partial flushes do not
+            // blank it; graphics drawn before the canvas are not captured.
+            for (int i = 0; i < BASALT_TFT_WIDTH * BASALT_TFT_HEIGHT; ++i) {
+                s_canvas_fb[i] = s_bg;
+            }
+            for (int r = 0; r < MAX_ROWS; ++r) {
+                tft_draw_span(r, 0, MAX_COLS);
+            }
+            s_canvas_dirty_count = 0;
+        }
+        if (ok) {
+            ESP_LOGI(TAG, "canvas on (%s)", tft_console_canvas_mode());
+        } else {
+            ESP_LOGW(TAG, "canvas unavailable (mode=%s)", mode);
+        }
     }
-    if (s_tft_lock) {
-        xSemaphoreGive(s_tft_lock);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    return ok;
+}
+
+void tft_console_canvas_end(void) {
+    if (s_canvas_mode == TFT_CANVAS_OFF) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    tft_canvas_flush_locked();
+    tft_canvas_free();
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+void tft_console_canvas_flush(void) {
+    if (!s_ready || s_canvas_mode == TFT_CANVAS_OFF) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    tft_canvas_flush_locked();
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+const char *tft_console_canvas_mode(void) {
+    switch (s_canvas_mode) {
+        case TFT_CANVAS_FULL: return "full";
+        case TFT_CANVAS_BAND: return "band";
+        default: return "direct";
     }
 }
 
@@ -669,6 +1730,7 @@ void tft_console_clear(void) {
     if (s_tft_lock) {
         xSemaphoreTake(s_tft_lock, portMAX_DELAY);
     }
+    s_view = 0;
     tft_clear_screen();
     s_row = 0;
     s_col = 0;
@@ -677,6 +1739,85 @@ void tft_console_clear(void) {
     }
 }
 
+int tft_console_scrollback_lines(void) {
+    return s_ready ? s_sb_count + s_row + 1 : 0;
+}
+
+int tft_console_scrollback_capacity(void) {
+    return s_sb_cap;
+}
+
+bool tft_console_scrollback_get(int index, char *out, size_t len) {
+    if (!s_ready || !out || len == 0) return false;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    bool ok = index >= 0 && index < s_sb_count + s_row + 1;
+    if (ok) {
+        char text[MAX_COLS];
+        uint16_t color[MAX_COLS];
+        tft_history_row(index, text, color);
+        int n = MAX_COLS;
+        while (n > 0 && text[n - 1] == ' ') n--;
+        if ((size_t)n >= len) n = (int)len - 1;
+        memcpy(out, text, (size_t)n);
+        out[n] = '\0';
+    }
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    return ok;
+}
+
+int tft_console_scrollback_find(const char *needle, int before) {
+    if (!s_ready || !needle || !needle[0]) return -1;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    int total = s_sb_count + s_row + 1;
+    if (before < 0 || before > total) before = total;
+    char text[MAX_COLS + 1];
+    uint16_t color[MAX_COLS];
+    int found = -1;
+    for (int i = before - 1; i >= 0; i--) {
+        tft_history_row(i, text, color);
+        text[MAX_COLS] = '\0';
+        if (strstr(text, needle)) {
+            found = i;
+            break;
+        }
+    }
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    return found;
+}
+
+int tft_console_view_offset(void) {
+    return s_view;
+}
+
+int tft_console_view_top(void) {
+    return s_sb_count - s_view;
+}
+
+void tft_console_view_scroll(int lines) {
+    if (!s_ready) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_view_set_locked(s_view + lines);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+void tft_console_view_page(int pages) {
+    tft_console_view_scroll(pages * (MAX_ROWS - 1));
+}
+
+void tft_console_view_line(int index) {
+    if (!s_ready) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_view_set_locked(s_sb_count - index);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
+void tft_console_view_live(void) {
+    if (!s_ready || s_view == 0) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_view_set_locked(0);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
 void tft_console_write_at(int x, int y, const char *text) {
     if (!s_ready || !text) return;
     int row = y / FONT_H;
@@ -692,30 +1833,82 @@ void tft_console_write_at(int x, int y, const char *text) {
         s_screen[row][c] = *p;
         s_color[row][c] = s_fg;
     }
-    tft_draw_line(row);
+    tft_mark_dirty(row, col, c);
     if (s_tft_lock) {
         xSemaphoreGive(s_tft_lock);
     }
+    tft_request_flush();
 }
 
 void tft_console_draw_pixel(int x, int y, uint16_t color) {
     if (!s_ready) return;
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
     tft_draw_pixel_raw(x, y, color);
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
 }
 
+void tft_console_draw_pixels(const int16_t *pts, size_t count, bool has_color, uint16_t color) {
+    if (!s_ready || !pts || count == 0) return;
+    const size_t stride = has_color ? 3 : 2;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+
+    // Points that continue a row in the same colour become one span; spans
+    // stacked straight down merge into a rectangle, as in draw_line.
+    uint16_t run_c = has_color ? (uint16_t)pts[2] : color;
+    int run_y = pts[1];
+    int run_x0 = pts[0];
+    int run_x1 = pts[0];
+    tft_span_begin(run_c);
+    for (size_t i = 1; i < count; ++i) {
+        const int16_t *p = pts + i * stride;
+        uint16_t c = has_color ? (uint16_t)p[2] : color;
+        if (c == run_c && p[1] == run_y && p[0] == run_x1 + 1) {
+            run_x1 = p[0];
+            continue;
+        }
+        tft_span_add(run_x0, run_x1, run_y);
+        if (c != run_c) {
+            tft_span_begin(c);
+            run_c = c;
+        }
+        run_y = p[1];
+        run_x0 = p[0];
+        run_x1 = p[0];
+    }
+    tft_span_add(run_x0, run_x1, run_y);
+    tft_span_flush();
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
+
 void tft_console_draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
     if (!s_ready) return;
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
     int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
     int sx = (x0 < x1) ? 1 : -1;
     int dy = (y1 > y0) ? (y0 - y1) : (y1 - y0); // negative abs
     int sy = (y0 < y1) ? 1 : -1;
     int err = dx + dy;
 
+    // Collect each row's run of pixels and emit it as one span; vertical and
+    // steep lines merge further into single-column rectangles.
+    tft_span_begin(color);
+    int run_y = y0;
+    int run_x0 = x0;
+    int run_x1 = x0;
     while (true) {
-        tft_draw_pixel_raw(x0, y0, color);
+        if (y0 != run_y) {
+            tft_span_add(run_x0, run_x1, run_y);
+            run_y = y0;
+            run_x0 = x0;
+            run_x1 = x0;
+        } else if (x0 < run_x0) {
+            run_x0 = x0;
+        } else if (x0 > run_x1) {
+            run_x1 = x0;
+        }
         if (x0 == x1 && y0 == y1) break;
         int e2 = err << 1;
         if (e2 >= dy) {
@@ -727,12 +1920,15 @@ void tft_console_draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
             y0 += sy;
         }
     }
+    tft_span_add(run_x0, run_x1, run_y);
+    tft_span_flush();
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
 }
 
 void tft_console_draw_rect(int x, int y, int w, int h, uint16_t color, bool fill) {
     if (!s_ready || w <= 0 || h <= 0) return;
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
     if (fill) {
         tft_fill_rect_raw(x, y, w, h, color);
     } else {
@@ -744,91 +1940,645 @@ void tft_console_draw_rect(int x, int y, int w, int h, uint16_t color, bool fill
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
 }
 
+// Half-width of the ellipse row `y` rows from the centre, or -1 outside it.
+static int ellipse_half_width(int rx, int ry, int y) {
+    if (y < 0) y = -y;
+    if (y > ry) return -1;
+    uint64_t rx2 = (uint64_t)rx * (uint64_t)rx;
+    uint64_t ry2 = (uint64_t)ry * (uint64_t)ry;
+    uint64_t term = (uint64_t)y * (uint64_t)y * rx2;
+    uint64_t remain = rx2 * ry2 - term;
+    return (int)isqrt_u32((uint32_t)(remain / ry2));
+}
+
+// Emit an ellipse as horizontal spans. Outlines cover, per row, the columns
+// between this row's edge and the next row outward so the curve stays closed;
+// the left and right edges go out in separate passes so each merges
+// vertically along the steep sides. Caller holds s_tft_lock.
+static void tft_ellipse_spans(int cx, int cy, int rx, int ry, uint16_t color, bool fill) {
+    tft_span_begin(color);
+    if (fill) {
+        for (int y = -ry; y <= ry; ++y) {
+            int x = ellipse_half_width(rx, ry, y);
+            if (x < 0) continue;
+            tft_span_add(cx - x, cx + x, cy + y);
+        }
+        tft_span_flush();
+        return;
+    }
+    for (int side = 0; side < 2; ++side) {
+        for (int y = -ry; y <= ry; ++y) {
+            int x = ellipse_half_width(rx, ry, y);
+            if (x < 0) continue;
+            int outer = ellipse_half_width(rx, ry, (y < 0) ? (y - 1) : (y + 1));
+            int inner = outer + 1;
+            if (inner > x) inner = x;
+            if (inner <= 0) {
+                // Cap rows: both edges meet, send the row once.
+                if (side == 0) tft_span_add(cx - x, cx + x, cy + y);
+                continue;
+            }
+            if (side == 0) {
+                tft_span_add(cx - x, cx - inner, cy + y);
+            } else {
+                tft_span_add(cx + inner, cx + x, cy + y);
+            }
+        }
+        tft_span_flush();
+    }
+}
+
 void tft_console_draw_circle(int cx, int cy, int r, uint16_t color, bool fill) {
     if (!s_ready || r <= 0) return;
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
-    int rr = r * r;
-    for (int y = -r; y <= r; ++y) {
-        int yy = y * y;
-        if (yy > rr) continue;
-        int x = (int)isqrt_u32((uint32_t)(rr - yy));
-        if (fill) {
-            tft_draw_hline_raw(cx - x, cy + y, (x * 2) + 1, color);
-        } else {
-            tft_draw_pixel_raw(cx - x, cy + y, color);
-            tft_draw_pixel_raw(cx + x, cy + y, color);
-        }
-    }
+    tft_flush_dirty_locked();
+    tft_ellipse_spans(cx, cy, r, r, color, fill);
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
 }
 
 void tft_console_draw_ellipse(int cx, int cy, int rx, int ry, uint16_t color, bool fill) {
     if (!s_ready || rx <= 0 || ry <= 0) return;
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    tft_ellipse_spans(cx, cy, rx, ry, color, fill);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
 
-    uint64_t rx2 = (uint64_t)rx * (uint64_t)rx;
-    uint64_t ry2 = (uint64_t)ry * (uint64_t)ry;
-    uint64_t rhs = rx2 * ry2;
-    for (int y = -ry; y <= ry; ++y) {
-        uint64_t y2 = (uint64_t)(y * y);
-        uint64_t term = y2 * rx2;
-        if (term > rhs) continue;
-        uint64_t remain = rhs - term;
-        uint32_t x = (uint32_t)isqrt_u32((uint32_t)(remain / ry2));
-        if (fill) {
-            tft_draw_hline_raw(cx - (int)x, cy + y, ((int)x * 2) + 1, color);
-        } else {
-            tft_draw_pixel_raw(cx - (int)x, cy + y, color);
-            tft_draw_pixel_raw(cx + (int)x, cy + y, color);
+// -----------------------------------------------------------------------------
+// Bitmap blits
+// -----------------------------------------------------------------------------
+// Source pixels are RGB565 in the same in-memory layout as the colour values
+// passed to the draw_* functions, so raw bitmaps go to DMA untouched.
+// Indexed and RLE sources are decoded row by row into s_linebuf and sent in
+// batches; a colour key (>= 0) drops matching pixels and sends only the
+// opaque runs of each row.
+
+typedef struct {
+    int x;
+    int y;
+    int w;
+    int h;
+    int sx;
+    int sy;
+} tft_blit_clip_t;
+
+static bool tft_blit_clip(int x, int y, int w, int h, tft_blit_clip_t *c) {
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    if (!clip_rect(&c->x, &c->y, &c->w, &c->h)) return false;
+    c->sx = c->x - x;
+    c->sy = c->y - y;
+    return true;
+}
+
+static void tft_blit_row_keyed(int x, int y, const uint16_t *row, int n, uint16_t key) {
+    int i = 0;
+    while (i < n) {
+        while (i < n && row[i] == key) i++;
+        int start = i;
+        while (i < n && row[i] != key) i++;
+        if (i > start) {
+            tft_put_pixels(x + start, y, i - start, 1, row + start, i - start);
         }
     }
+}
+
+typedef struct {
+    int x;
+    int y;
+    int w;
+    int rows;
+    int max_rows;
+    int key;
+} tft_blit_out_t;
+
+static void tft_blit_out_init(tft_blit_out_t *o, const tft_blit_clip_t *c, int key) {
+    o->x = c->x;
+    o->y = c->y;
+    o->w = c->w;
+    o->rows = 0;
+    o->max_rows = TFT_LINEBUF_PIXELS / c->w;
+    o->key = key;
+}
+
+static uint16_t *tft_blit_out_row(tft_blit_out_t *o) {
+    return s_linebuf + o->rows * o->w;
+}
+
+static void tft_blit_out_flush(tft_blit_out_t *o) {
+    if (o->rows == 0) return;
+    tft_put_pixels(o->x, o->y, o->w, o->rows, s_linebuf, o->w);
+    o->y += o->rows;
+    o->rows = 0;
+}
+
+// The row returned by tft_blit_out_row() has been filled.
+static void tft_blit_out_commit(tft_blit_out_t *o) {
+    if (o->key >= 0) {
+        tft_blit_row_keyed(o->x, o->y, s_linebuf, o->w, (uint16_t)o->key);
+        o->y++;
+        return;
+    }
+    o->rows++;
+    if (o->rows >= o->max_rows) {
+        tft_blit_out_flush(o);
+    }
+}
+
+void tft_console_blit(int x, int y, int w, int h, const uint16_t *rgb565) {
+    if (!s_ready || !rgb565 || w <= 0 || h <= 0) return;
+    tft_blit_clip_t c;
+    if (!tft_blit_clip(x, y, w, h, &c)) return;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    const uint16_t *src = rgb565 + (size_t)c.sy * (size_t)w + (size_t)c.sx;
+    tft_put_pixels(c.x, c.y, c.w, c.h, src, w);
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
 }
 
-bool tft_console_touch_read(int *pressed, int *x, int *y, int *raw_x, int *raw_y) {
-    if (pressed) *pressed = 0;
-    if (x) *x = -1;
-    if (y) *y = -1;
-    if (raw_x) *raw_x = -1;
-    if (raw_y) *raw_y = -1;
+void tft_console_blit_indexed(int x, int y, int w, int h, const uint8_t *data, int bpp,
+                              const uint16_t *palette, int palette_len, int key) {
+    if (!s_ready || !data || !palette || palette_len <= 0 || w <= 0 || h <= 0) return;
+    if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) return;
+    tft_blit_clip_t c;
+    if (!tft_blit_clip(x, y, w, h, &c)) return;
 
-    if (!s_ready || !s_touch_spi || BASALT_TOUCH_CS < 0) return false;
+    // Rows are packed MSB-first and padded to a whole byte.
+    const int per_byte = 8 / bpp;
+    const int mask = (1 << bpp) - 1;
+    const size_t stride = ((size_t)w * (size_t)bpp + 7U) / 8U;
 
     if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
-    // XPT2046 command bytes.
-    int z1 = touch_read_adc(0xB0);
-    int z2 = touch_read_adc(0xC0);
-    int rx = touch_read_adc(0xD0);
-    int ry = touch_read_adc(0x90);
+    tft_flush_dirty_locked();
+    tft_blit_out_t out;
+    tft_blit_out_init(&out, &c, key);
+    for (int r = 0; r < c.h; ++r) {
+        const uint8_t *row = data + (size_t)(c.sy + r) * stride;
+        uint16_t *dst = tft_blit_out_row(&out);
+        for (int i = 0; i < c.w; ++i) {
+            int col = c.sx + i;
+            int shift = (per_byte - 1 - (col % per_byte)) * bpp;
+            int idx = (row[col / per_byte] >> shift) & mask;
+            dst[i] = (idx < palette_len) ? palette[idx] : palette[0];
+        }
+        tft_blit_out_commit(&out);
+    }
+    tft_blit_out_flush(&out);
     if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
 
-    if (z1 < 0 || z2 < 0 || rx < 0 || ry < 0) return false;
+// RLE stream: control byte n, then
+//   n & 0x80 -> one pixel repeated (n & 0x7F) + 1 times
+//   else     -> n + 1 literal pixels
+// Pixels are 2 bytes, little-endian (the in-memory RGB565 layout).
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    int left;
+    bool repeat;
+    uint16_t value;
+} tft_rle_reader_t;
+
+static bool tft_rle_next(tft_rle_reader_t *rd, uint16_t *out) {
+    if (rd->left == 0) {
+        if (rd->p >= rd->end) return false;
+        uint8_t n = *rd->p++;
+        rd->repeat = (n & 0x80) != 0;
+        rd->left = (n & 0x7F) + 1;
+        if (rd->repeat) {
+            if (rd->end - rd->p < 2) return false;
+            rd->value = (uint16_t)(rd->p[0] | (rd->p[1] << 8));
+            rd->p += 2;
+        }
+    }
+    if (!rd->repeat) {
+        if (rd->end - rd->p < 2) return false;
+        rd->value = (uint16_t)(rd->p[0] | (rd->p[1] << 8));
+        rd->p += 2;
+    }
+    rd->left--;
+    *out = rd->value;
+    return true;
+}
 
-    int pressure = z1 + (4095 - z2);
-    if (pressure < BASALT_TOUCH_Z_MIN) {
-        if (pressed) *pressed = 0;
-        return true;
+void tft_console_blit_rle(int x, int y, int w, int h, const uint8_t *data, size_t len, int key) {
+    if (!s_ready || !data || len == 0 || w <= 0 || h <= 0) return;
+    tft_blit_clip_t c;
+    if (!tft_blit_clip(x, y, w, h, &c)) return;
+
+    tft_rle_reader_t rd = {
+        .p = data,
+        .end = data + len,
+        .left = 0,
+        .repeat = false,
+        .value = 0,
+    };
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    tft_blit_out_t out;
+    tft_blit_out_init(&out, &c, key);
+    bool ok = true;
+    uint16_t px = 0;
+    // Rows above the visible area still have to be decoded to find the
+    // start of the first visible one.
+    for (int r = 0; ok && r < c.sy + c.h; ++r) {
+        bool visible = r >= c.sy;
+        uint16_t *dst = visible ? tft_blit_out_row(&out) : NULL;
+        for (int col = 0; col < w; ++col) {
+            if (!tft_rle_next(&rd, &px)) {
+                ok = false;
+                break;
+            }
+            if (visible && col >= c.sx && col < c.sx + c.w) {
+                dst[col - c.sx] = px;
+            }
+        }
+        if (ok && visible) {
+            tft_blit_out_commit(&out);
+        }
     }
-    if (pressed) *pressed = 1;
-    if (raw_x) *raw_x = rx;
-    if (raw_y) *raw_y = ry;
+    // A truncated stream keeps the rows that decoded completely.
+    tft_blit_out_flush(&out);
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+}
 
-    // Map raw touch range to screen coordinates.
-    int mx = (rx - BASALT_TOUCH_X_MIN) * (BASALT_TFT_WIDTH - 1) / (BASALT_TOUCH_X_MAX - BASALT_TOUCH_X_MIN);
-    int my = (ry - BASALT_TOUCH_Y_MIN) * (BASALT_TFT_HEIGHT - 1) / (BASALT_TOUCH_Y_MAX - BASALT_TOUCH_Y_MIN);
+// -----------------------------------------------------------------------------
+// Proportional text (tft_font.c)
+// -----------------------------------------------------------------------------
+// Opaque text is composed a band at a time straight into s_linebuf and sent as
+// one window per band; transparent text is sent as merged fg spans. Glyphs are
+// decoded row by row from flash (or the font file), never expanded in RAM.
+
+static void tft_text_opaque(int x, int y, const char *text, const tft_font_t *font, int scale,
+                            uint16_t fg, uint16_t bg, int tw, int th) {
+    tft_blit_clip_t c;
+    if (!tft_blit_clip(x, y, tw, th, &c)) return;
+    uint8_t row[256];
+    int band = TFT_LINEBUF_PIXELS / c.w;
+    for (int by = 0; by < c.h; by += band) {
+        int n = (c.h - by < band) ? (c.h - by) : band;
+        for (int i = 0; i < n * c.w; i++) s_linebuf[i] = bg;
+        int oy0 = c.sy + by; // first band row, in text coordinates
+        int fr0 = oy0 / scale;
+        int fr1 = (oy0 + n - 1) / scale;
+        int pen = x;
+        for (const char *p = text; *p; ++p) {
+            tft_glyph_t g;
+            if (!tft_font_glyph(font, (uint8_t)*p, &g)) continue;
+            int gx0 = pen;
+            pen += g.advance * scale;
+            if (pen <= c.x || gx0 >= c.x + c.w || g.width == 0) continue;
+            tft_glyph_reader_t rd;
+            tft_glyph_reader_init(&rd, &g);
+            for (int fr = 0; fr < fr0; fr++) tft_glyph_read_row(&rd, row);
+            for (int fr = fr0; fr <= fr1; fr++) {
+                tft_glyph_read_row(&rd, row);
+                int ya = fr * scale - oy0;
+                int yb = ya + scale;
+                if (ya < 0) ya = 0;
+                if (yb > n) yb = n;
+                for (int gx = 0; gx < g.width; gx++) {
+                    if (!row[gx]) continue;
+                    int px0 = gx0 + gx * scale - c.x;
+                    int px1 = px0 + scale;
+                    if (px0 < 0) px0 = 0;
+                    if (px1 > c.w) px1 = c.w;
+                    for (int yy = ya; yy < yb; yy++) {
+                        uint16_t *dst = s_linebuf + yy * c.w;
+                        for (int px = px0; px < px1; px++) dst[px] = fg;
+                    }
+                }
+            }
+        }
+        tft_put_pixels(c.x, c.y + by, c.w, n, s_linebuf, c.w);
+    }
+}
+
+static void tft_text_spans(int x, int y, const char *text, const tft_font_t *font, int scale, uint16_t fg) {
+    uint8_t row[256];
+    int height = tft_font_height(font);
+    int pen = x;
+    tft_span_begin(fg);
+    for (const char *p = text; *p; ++p) {
+        tft_glyph_t g;
+        if (!tft_font_glyph(font, (uint8_t)*p, &g)) continue;
+        int gx0 = pen;
+        pen += g.advance * scale;
+        if (pen <= 0 || gx0 >= BASALT_TFT_WIDTH) continue;
+        tft_glyph_reader_t rd;
+        tft_glyph_reader_init(&rd, &g);
+        for (int fr = 0; fr < height; fr++) {
+            tft_glyph_read_row(&rd, row);
+            for (int gx = 0; gx < g.width;) {
+                if (!row[gx]) {
+                    gx++;
+                    continue;
+                }
+                int start = gx;
+                while (gx < g.width && row[gx]) gx++;
+                int x0 = gx0 + start * scale;
+                int x1 = gx0 + gx * scale - 1;
+                for (int s = 0; s < scale; s++) {
+                    tft_span_add(x0 < 0 ? 0 : x0, x1 >= BASALT_TFT_WIDTH ? BASALT_TFT_WIDTH - 1 : x1,
+                                 y + fr * scale + s);
+                }
+            }
+        }
+    }
+    tft_span_flush();
+}
+
+int tft_console_draw_text(int x, int y, const char *text, const tft_font_t *font, int scale, uint16_t fg,
+                          int bg) {
+    if (!s_ready || !text) return 0;
+    if (!font) font = tft_font_builtin(NULL);
+    if (!font) return 0;
+    if (scale < 1) scale = 1;
+    int tw = tft_font_text_width(font, text) * scale;
+    int th = tft_font_height(font) * scale;
+    if (tw <= 0 || th <= 0) return 0;
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    tft_flush_dirty_locked();
+    if (bg >= 0) {
+        tft_text_opaque(x, y, text, font, scale, fg, (uint16_t)bg, tw, th);
+    } else {
+        tft_text_spans(x, y, text, font, scale, fg);
+    }
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    return tw;
+}
+
+static void tft_touch_set_map(const tft_touch_cal_t *cal) {
+    s_touch_map.cal = *cal;
+    s_touch_map.scale_x = ((int32_t)(BASALT_TFT_WIDTH - 1) << 16) / (cal->x_max - cal->x_min);
+    s_touch_map.scale_y = ((int32_t)(BASALT_TFT_HEIGHT - 1) << 16) / (cal->y_max - cal->y_min);
+}
+
+static void tft_touch_default_map(void) {
+    tft_touch_cal_t cal = {
+        .x_min = 200,
+        .x_max = 3800,
+        .y_min = 200,
+        .y_max = 3800,
+#if defined(BASALT_BOARD_CYD) || defined(BASALT_BOARD_CYD_3248S035R)
+        // CYD/XPT2046 panel is rotated 180 degrees relative to TFT coordinates.
+        .invert_x = true,
+        .invert_y = true,
+#else
+        .invert_x = false,
+        .invert_y = false,
+#endif
+    };
+    tft_touch_set_map(&cal);
+}
+
+void tft_console_touch_get_calibration(tft_touch_cal_t *cal) {
+    if (!cal) return;
+    if (s_touch_map.scale_x == 0) tft_touch_default_map();
+    *cal = s_touch_map.cal;
+}
+
+bool tft_console_touch_set_calibration(const tft_touch_cal_t *cal) {
+    if (!cal) return false;
+    if (cal->x_min < 0 || cal->y_min < 0 || cal->x_max > 4095 || cal->y_max > 4095) return false;
+    // Narrow ranges are noise amplifiers (and would overflow the Q16 maths).
+    if (cal->x_max - cal->x_min < 100 || cal->y_max - cal->y_min < 100) return false;
+    tft_touch_set_map(cal);
+    return true;
+}
+
+static int touch_median(int *v, int n) {
+    for (int i = 1; i < n; ++i) {
+        int key = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > key) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = key;
+    }
+    return v[n / 2];
+}
+
+typedef struct {
+    int pressed;
+    int x;
+    int y;
+    int raw_x;
+    int raw_y;
+} tft_touch_sample_t;
+
+// One filtered reading. Returns false on SPI failure. Takes s_tft_lock since
+// the controller shares the display bus.
+static bool tft_touch_sample(tft_touch_sample_t *out, bool position) {
+    int xs[BASALT_TOUCH_OVERSAMPLE];
+    int ys[BASALT_TOUCH_OVERSAMPLE];
+    out->pressed = 0;
+    out->x = out->y = out->raw_x = out->raw_y = -1;
+
+    if (s_tft_lock) xSemaphoreTake(s_tft_lock, portMAX_DELAY);
+    // XPT2046 command bytes (PD=00 keeps PENIRQ armed between conversions).
+    int z1 = touch_read_adc(0xB0);
+    int z2 = touch_read_adc(0xC0);
+    bool ok = z1 >= 0 && z2 >= 0;
+    bool down = ok && (z1 + (4095 - z2)) >= BASALT_TOUCH_Z_MIN;
+    if (down && position) {
+        for (int i = 0; i < BASALT_TOUCH_OVERSAMPLE && ok; ++i) {
+            xs[i] = touch_read_adc(0xD0);
+            ys[i] = touch_read_adc(0x90);
+            ok = xs[i] >= 0 && ys[i] >= 0;
+        }
+    }
+    if (s_tft_lock) xSemaphoreGive(s_tft_lock);
+    if (!ok) return false;
+    if (!down) return true;
+
+    out->pressed = 1;
+    if (!position) return true;
+    if (s_touch_map.scale_x == 0) tft_touch_default_map();
+    const tft_touch_cal_t *cal = &s_touch_map.cal;
+    int rx = touch_median(xs, BASALT_TOUCH_OVERSAMPLE);
+    int ry = touch_median(ys, BASALT_TOUCH_OVERSAMPLE);
+    int mx = ((touch_clamp(rx, cal->x_min, cal->x_max) - cal->x_min) * s_touch_map.scale_x) >> 16;
+    int my = ((touch_clamp(ry, cal->y_min, cal->y_max) - cal->y_min) * s_touch_map.scale_y) >> 16;
     mx = touch_clamp(mx, 0, BASALT_TFT_WIDTH - 1);
     my = touch_clamp(my, 0, BASALT_TFT_HEIGHT - 1);
+    if (cal->invert_x) mx = BASALT_TFT_WIDTH - 1 - mx;
+    if (cal->invert_y) my = BASALT_TFT_HEIGHT - 1 - my;
+    out->raw_x = rx;
+    out->raw_y = ry;
+    out->x = mx;
+    out->y = my;
+    return true;
+}
 
-    // CYD/XPT2046 panel is typically rotated relative to TFT coordinates.
-#if defined(BASALT_BOARD_CYD) || defined(BASALT_BOARD_CYD_3248S035R)
-    int tx = BASALT_TFT_WIDTH - 1 - mx;
-    int ty = BASALT_TFT_HEIGHT - 1 - my;
-    mx = tx;
-    my = ty;
+static void tft_touch_post(uint8_t type, int x, int y) {
+    if (!s_touch_queue) return;
+    tft_touch_event_t ev = {
+        .type = type,
+        .x = (int16_t)x,
+        .y = (int16_t)y,
+        .ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+    if (xQueueSend(s_touch_queue, &ev, 0) != pdTRUE) {
+        // Nobody is draining: drop the oldest so press/release pairs stay
+        // recent rather than stale.
+        tft_touch_event_t old;
+        xQueueReceive(s_touch_queue, &old, 0);
+        xQueueSend(s_touch_queue, &ev, 0);
+    }
+    // Same event for asyncio loops waiting on the OS event queue.
+    rt_event_t rt = {
+        .type = RT_EVT_TOUCH,
+        .code = type,
+        .a = (uint32_t)x,
+        .b = (uint32_t)y,
+    };
+    rt_event_post(&rt);
+}
+
+#if BASALT_TOUCH_IRQ >= 0
+static void IRAM_ATTR tft_touch_isr(void *arg) {
+    (void)arg;
+    gpio_intr_disable(BASALT_TOUCH_IRQ);
+    BaseType_t woken = pdFALSE;
+    if (s_touch_task) vTaskNotifyGiveFromISR(s_touch_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+#endif
+
+static void tft_touch_task(void *arg) {
+    (void)arg;
+    for (;;) {
+#if BASALT_TOUCH_IRQ >= 0
+        // PENIRQ is low while pressed; only block when it is released so an
+        // edge that arrived during the last release is not lost.
+        if (gpio_get_level(BASALT_TOUCH_IRQ) != 0) {
+            gpio_intr_enable(BASALT_TOUCH_IRQ);
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+#else
+        tft_touch_sample_t idle;
+        vTaskDelay(pdMS_TO_TICKS(BASALT_TOUCH_IDLE_POLL_MS));
+        if (!tft_touch_sample(&idle, false) || !idle.pressed) continue;
+#endif
+        bool down = false;
+        int last_x = -1;
+        int last_y = -1;
+        for (;;) {
+            tft_touch_sample_t sm;
+            if (!tft_touch_sample(&sm, true)) {
+                vTaskDelay(pdMS_TO_TICKS(BASALT_TOUCH_SAMPLE_MS));
+                continue;
+            }
+            if (!sm.pressed) break;
+            s_touch_x = sm.x;
+            s_touch_y = sm.y;
+            s_touch_raw_x = sm.raw_x;
+            s_touch_raw_y = sm.raw_y;
+            s_touch_pressed = 1;
+            int dist = abs(sm.x - last_x) + abs(sm.y - last_y);
+            if (!down) {
+                tft_touch_post(TFT_TOUCH_PRESS, sm.x, sm.y);
+                down = true;
+                last_x = sm.x;
+                last_y = sm.y;
+            } else if (dist >= BASALT_TOUCH_MOVE_MIN) {
+                tft_touch_post(TFT_TOUCH_MOVE, sm.x, sm.y);
+                last_x = sm.x;
+                last_y = sm.y;
+            }
+            vTaskDelay(pdMS_TO_TICKS(BASALT_TOUCH_SAMPLE_MS));
+        }
+        s_touch_pressed = 0;
+        if (down) tft_touch_post(TFT_TOUCH_RELEASE, last_x, last_y);
+#if BASALT_TOUCH_IRQ >= 0
+        // PENIRQ low without pressure (noise, or a missing pull-up): back off
+        // to the idle rate instead of spinning on SPI reads.
+        if (!down) vTaskDelay(pdMS_TO_TICKS(BASALT_TOUCH_IDLE_POLL_MS));
 #endif
+    }
+}
+
+static void tft_touch_start(void) {
+    if (!s_touch_spi || s_touch_task) return;
+    if (s_touch_map.scale_x == 0) tft_touch_default_map();
+    s_touch_queue = xQueueCreate(BASALT_TOUCH_QUEUE_LEN, sizeof(tft_touch_event_t));
+    if (!s_touch_queue) {
+        ESP_LOGW(TAG, "touch queue alloc failed; touch reads stay synchronous");
+        return;
+    }
+#if BASALT_TOUCH_IRQ >= 0
+    gpio_config_t irq_conf = {
+        .pin_bit_mask = (1ULL << BASALT_TOUCH_IRQ),
+        .mode = GPIO_MODE_INPUT,
+        // Input-only pads (GPIO34-39 on ESP32) have no pull-up; PENIRQ boards
+        // using them carry their own.
+        .pull_up_en = GPIO_IS_VALID_OUTPUT_GPIO(BASALT_TOUCH_IRQ) ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    gpio_config(&irq_conf);
+    esp_err_t ie = gpio_install_isr_service(0);
+    if (ie != ESP_OK && ie != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "touch ISR service failed (%s)", esp_err_to_name(ie));
+    }
+    gpio_intr_disable(BASALT_TOUCH_IRQ);
+#endif
+    if (xTaskCreate(tft_touch_task, "tft_touch", BASALT_TOUCH_TASK_STACK, NULL,
+                    BASALT_TOUCH_TASK_PRIO, &s_touch_task) != pdPASS) {
+        s_touch_task = NULL;
+        vQueueDelete(s_touch_queue);
+        s_touch_queue = NULL;
+        ESP_LOGW(TAG, "touch task unavailable; touch reads stay synchronous");
+        return;
+    }
+#if BASALT_TOUCH_IRQ >= 0
+    gpio_isr_handler_add(BASALT_TOUCH_IRQ, tft_touch_isr, NULL);
+    ESP_LOGI(TAG, "touch service on PENIRQ GPIO%d", BASALT_TOUCH_IRQ);
+#else
+    ESP_LOGI(TAG, "touch service polling every %d ms (no PENIRQ pin)", BASALT_TOUCH_IDLE_POLL_MS);
+#endif
+}
+
+bool tft_console_touch_next_event(tft_touch_event_t *ev, uint32_t timeout_ms) {
+    if (!ev || !s_touch_queue) return false;
+    TickType_t ticks = (timeout_ms == UINT32_MAX) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xQueueReceive(s_touch_queue, ev, ticks) == pdTRUE;
+}
 
-    if (x) *x = mx;
-    if (y) *y = my;
+bool tft_console_touch_read(int *pressed, int *x, int *y, int *raw_x, int *raw_y) {
+    if (pressed) *pressed = 0;
+    if (x) *x = -1;
+    if (y) *y = -1;
+    if (raw_x) *raw_x = -1;
+    if (raw_y) *raw_y = -1;
+
+    if (!s_ready || !s_touch_spi || BASALT_TOUCH_CS < 0) return false;
+
+    if (s_touch_task) {
+        // Served from the touch task's last report; no bus traffic.
+        int down = s_touch_pressed;
+        if (pressed) *pressed = down;
+        if (down) {
+            if (x) *x = s_touch_x;
+            if (y) *y = s_touch_y;
+            if (raw_x) *raw_x = s_touch_raw_x;
+            if (raw_y) *raw_y = s_touch_raw_y;
+        }
+        return true;
+    }
+
+    tft_touch_sample_t sm;
+    if (!tft_touch_sample(&sm, true)) return false;
+    if (pressed) *pressed = sm.pressed;
+    if (!sm.pressed) return true;
+    if (x) *x = sm.x;
+    if (y) *y = sm.y;
+    if (raw_x) *raw_x = sm.raw_x;
+    if (raw_y) *raw_y = sm.raw_y;
     return true;
 }
 
@@ -946,7 +2696,16 @@ bool tft_console_init(void) {
 #endif
 
     tft_clear_screen();
+    if (!s_sb) tft_sb_alloc();
     s_ready = true;
+    tft_touch_start();
+    if (!s_flush_task &&
+        xTaskCreate(tft_flush_task, "tft_flush", BASALT_TFT_FLUSH_TASK_STACK, NULL,
+                    BASALT_TFT_FLUSH_TASK_PRIO, &s_flush_task) != pdPASS) {
+        // Fall back to painting synchronously from the writer.
+        s_flush_task = NULL;
+        ESP_LOGW(TAG, "TFT flush task unavailable; console writes are synchronous");
+    }
     ESP_LOGI(TAG, "TFT console ready (%dx%d)", BASALT_TFT_WIDTH, BASALT_TFT_HEIGHT);
     return true;
 #else
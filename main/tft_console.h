@@ -1,8 +1,34 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "tft_font.h"
+
+typedef enum {
+    TFT_TOUCH_PRESS = 1,
+    TFT_TOUCH_MOVE = 2,
+    TFT_TOUCH_RELEASE = 3,
+} tft_touch_event_type_t;
+
+typedef struct {
+    uint8_t type;   // tft_touch_event_type_t
+    int16_t x;
+    int16_t y;
+    uint32_t ms;    // esp_timer time of the sample
+} tft_touch_event_t;
+
+// Raw XPT2046 range that maps onto the panel, plus axis flips.
+typedef struct {
+    int16_t x_min;
+    int16_t x_max;
+    int16_t y_min;
+    int16_t y_max;
+    bool invert_x;
+    bool invert_y;
+} tft_touch_cal_t;
+
 bool tft_console_init(void);
 bool tft_console_is_ready(void);
 void tft_console_write(const char *text);
@@ -10,8 +36,43 @@ void tft_console_set_color(uint16_t fg);
 void tft_console_clear(void);
 void tft_console_write_at(int x, int y, const char *text);
 void tft_console_draw_pixel(int x, int y, uint16_t color);
+// count points packed as int16 (x, y) pairs in `color`, or (x, y, rgb565)
+// triples when has_color; one lock and merged spans for the whole batch.
+void tft_console_draw_pixels(const int16_t *pts, size_t count, bool has_color, uint16_t color);
 void tft_console_draw_line(int x0, int y0, int x1, int y1, uint16_t color);
 void tft_console_draw_rect(int x, int y, int w, int h, uint16_t color, bool fill);
 void tft_console_draw_circle(int cx, int cy, int r, uint16_t color, bool fill);
 void tft_console_draw_ellipse(int cx, int cy, int rx, int ry, uint16_t color, bool fill);
+void tft_console_blit(int x, int y, int w, int h, const uint16_t *rgb565);
+void tft_console_blit_indexed(int x, int y, int w, int h, const uint8_t *data, int bpp,
+                              const uint16_t *palette, int palette_len, int key);
+void tft_console_blit_rle(int x, int y, int w, int h, const uint8_t *data, size_t len, int key);
+// Draws `text` with a proportional font (NULL = built-in "small") at integer
+// `scale`; bg < 0 draws transparently. Returns the width in pixels.
+int tft_console_draw_text(int x, int y, const char *text, const tft_font_t *font, int scale, uint16_t fg,
+                          int bg);
+void tft_console_flush(void);
+bool tft_console_canvas_begin(void);
+void tft_console_canvas_end(void);
+void tft_console_canvas_flush(void);
+const char *tft_console_canvas_mode(void);
+// Scrollback: lines scrolled off the top are kept in a ring (sized by the tft
+// driver option scrollback_lines). History index 0 is the oldest line; the
+// live screen rows follow the ring.
+int tft_console_scrollback_lines(void);
+int tft_console_scrollback_capacity(void);
+bool tft_console_scrollback_get(int index, char *out, size_t len);
+// Last line before `before` (-1 = end) containing `needle`, or -1.
+int tft_console_scrollback_find(const char *needle, int before);
+// Viewport: positive lines/pages scroll back into history. Live output is
+// buffered while scrolled back and repainted by tft_console_view_live().
+int tft_console_view_offset(void);
+int tft_console_view_top(void);
+void tft_console_view_scroll(int lines);
+void tft_console_view_page(int pages);
+void tft_console_view_line(int index);
+void tft_console_view_live(void);
 bool tft_console_touch_read(int *pressed, int *x, int *y, int *raw_x, int *raw_y);
+bool tft_console_touch_next_event(tft_touch_event_t *ev, uint32_t timeout_ms);
+void tft_console_touch_get_calibration(tft_touch_cal_t *cal);
+bool tft_console_touch_set_calibration(const tft_touch_cal_t *cal);
@@ -0,0 +1,210 @@
+#include "tft_font.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#define TFT_FONT_HEADER_LEN 16
+#define TFT_FONT_GLYPH_LEN 8
+#define TFT_FONT_FLAG_RLE 0x01
+#define TFT_FONT_MAX_BUILTINS 4
+
+static const char *TAG = "tft_font";
+
+struct tft_font {
+    const uint8_t *table; // glyph table (flash, or heap copy for files)
+    const uint8_t *data;  // bitmap data in flash; NULL for files
+    FILE *file;
+    long data_off;
+    uint8_t *scratch;
+    uint8_t height;
+    uint8_t ascent;
+    uint8_t first;
+    uint8_t count;
+    bool rle;
+};
+
+static tft_font_t s_builtin[TFT_FONT_MAX_BUILTINS];
+static bool s_builtin_parsed[TFT_FONT_MAX_BUILTINS];
+
+static uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Validates a BFN1 header; returns the bitmap data size.
+static bool tft_font_parse_header(tft_font_t *f, const uint8_t *hdr, uint32_t *data_size) {
+    if (memcmp(hdr, "BFN1", 4) != 0) return false;
+    f->height = hdr[4];
+    f->ascent = hdr[5];
+    f->first = hdr[6];
+    f->count = hdr[7];
+    f->rle = (hdr[8] & TFT_FONT_FLAG_RLE) != 0;
+    *data_size = rd32(hdr + 12);
+    return f->height > 0 && f->count > 0;
+}
+
+// Every glyph's bitmap must lie inside the data block.
+static bool tft_font_check_table(const uint8_t *table, int count, uint32_t data_size, uint16_t *max_len) {
+    uint16_t longest = 0;
+    for (int i = 0; i < count; i++) {
+        const uint8_t *g = table + i * TFT_FONT_GLYPH_LEN;
+        uint32_t off = rd32(g);
+        uint16_t len = rd16(g + 4);
+        if (off > data_size || len > data_size - off) return false;
+        if (len > longest) longest = len;
+    }
+    if (max_len) *max_len = longest;
+    return true;
+}
+
+const tft_font_t *tft_font_builtin(const char *name) {
+    for (int i = 0; i < tft_font_builtin_count && i < TFT_FONT_MAX_BUILTINS; i++) {
+        const tft_font_builtin_t *b = &tft_font_builtins[i];
+        if (name && strcmp(name, b->name) != 0) continue;
+        tft_font_t *f = &s_builtin[i];
+        if (!s_builtin_parsed[i]) {
+            uint32_t data_size = 0;
+            if (b->len < TFT_FONT_HEADER_LEN || !tft_font_parse_header(f, b->data, &data_size)) return NULL;
+            size_t table_len = (size_t)f->count * TFT_FONT_GLYPH_LEN;
+            if (TFT_FONT_HEADER_LEN + table_len + data_size > b->len) return NULL;
+            f->table = b->data + TFT_FONT_HEADER_LEN;
+            f->data = f->table + table_len;
+            if (!tft_font_check_table(f->table, f->count, data_size, NULL)) return NULL;
+            s_builtin_parsed[i] = true;
+        }
+        return f;
+    }
+    return NULL;
+}
+
+tft_font_t *tft_font_open(const char *path) {
+    if (!path) return NULL;
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return NULL;
+    tft_font_t *f = calloc(1, sizeof(*f));
+    uint8_t hdr[TFT_FONT_HEADER_LEN];
+    uint32_t data_size = 0;
+    uint8_t *table = NULL;
+    uint16_t max_len = 0;
+    if (!f || fread(hdr, 1, sizeof(hdr), fp) != sizeof(hdr) || !tft_font_parse_header(f, hdr, &data_size)) {
+        goto fail;
+    }
+    size_t table_len = (size_t)f->count * TFT_FONT_GLYPH_LEN;
+    table = malloc(table_len);
+    if (!table || fread(table, 1, table_len, fp) != table_len) goto fail;
+    if (!tft_font_check_table(table, f->count, data_size, &max_len)) goto fail;
+    f->scratch = malloc(max_len ? max_len : 1);
+    if (!f->scratch) goto fail;
+    f->table = table;
+    f->file = fp;
+    f->data_off = (long)(TFT_FONT_HEADER_LEN + table_len);
+    ESP_LOGI(TAG, "opened %s (%d px, %d glyphs)", path, f->height, f->count);
+    return f;
+
+fail:
+    ESP_LOGW(TAG, "not a BFN1 font: %s", path);
+    free(table);
+    free(f);
+    fclose(fp);
+    return NULL;
+}
+
+void tft_font_close(tft_font_t *font) {
+    if (!font || !font->file) return; // built-ins are never freed
+    fclose(font->file);
+    free((void *)font->table);
+    free(font->scratch);
+    free(font);
+}
+
+int tft_font_height(const tft_font_t *font) {
+    return font ? font->height : 0;
+}
+
+int tft_font_ascent(const tft_font_t *font) {
+    return font ? font->ascent : 0;
+}
+
+static const uint8_t *tft_font_entry(const tft_font_t *font, uint8_t ch) {
+    if (ch < font->first || ch - font->first >= font->count) return NULL;
+    return font->table + (size_t)(ch - font->first) * TFT_FONT_GLYPH_LEN;
+}
+
+int tft_font_text_width(const tft_font_t *font, const char *text) {
+    if (!font || !text) return 0;
+    int w = 0;
+    for (const char *p = text; *p; ++p) {
+        const uint8_t *g = tft_font_entry(font, (uint8_t)*p);
+        if (!g) g = tft_font_entry(font, '?');
+        if (g) w += g[7];
+    }
+    return w;
+}
+
+bool tft_font_glyph(const tft_font_t *font, uint8_t ch, tft_glyph_t *out) {
+    if (!font || !out) return false;
+    const uint8_t *g = tft_font_entry(font, ch);
+    if (!g) g = tft_font_entry(font, '?');
+    if (!g) return false;
+    uint32_t off = rd32(g);
+    out->len = rd16(g + 4);
+    out->width = g[6];
+    out->advance = g[7];
+    out->rle = font->rle;
+    if (font->data) {
+        out->bits = font->data + off;
+        return true;
+    }
+    if (out->len == 0) {
+        out->bits = font->scratch;
+        return true;
+    }
+    if (fseek(font->file, font->data_off + (long)off, SEEK_SET) != 0 ||
+        fread(font->scratch, 1, out->len, font->file) != out->len) {
+        return false;
+    }
+    out->bits = font->scratch;
+    return true;
+}
+
+void tft_glyph_reader_init(tft_glyph_reader_t *rd, const tft_glyph_t *glyph) {
+    memset(rd, 0, sizeof(*rd));
+    rd->glyph = glyph;
+}
+
+void tft_glyph_read_row(tft_glyph_reader_t *rd, uint8_t *row) {
+    const tft_glyph_t *g = rd->glyph;
+    int w = g->width;
+    if (!g->rle) {
+        for (int x = 0; x < w; x++, rd->bit++) {
+            uint32_t byte = rd->bit >> 3;
+            row[x] = (byte < g->len) ? ((g->bits[byte] >> (7 - (rd->bit & 7))) & 1) : 0;
+        }
+        return;
+    }
+    for (int x = 0; x < w; x++) {
+        // A chunk byte of 255 continues the run; anything smaller ends it.
+        while (rd->run == 0) {
+            if (rd->flip) {
+                rd->color ^= 1;
+                rd->flip = 0;
+            }
+            if (rd->pos >= g->len) break;
+            uint8_t v = g->bits[rd->pos++];
+            rd->run = v;
+            rd->flip = (v != 255);
+        }
+        if (rd->run == 0) {
+            row[x] = 0; // truncated bitmap
+            continue;
+        }
+        row[x] = rd->color;
+        rd->run--;
+    }
+}
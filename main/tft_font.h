@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Proportional bitmap fonts in the BFN1 format produced by tools/font_pack.py.
+// Built-in fonts are decoded in place from flash; fonts opened from the
+// filesystem keep only their header and glyph table in RAM and read each
+// glyph's bitmap on demand.
+
+typedef struct tft_font tft_font_t;
+
+typedef struct {
+    const char *name;
+    const uint8_t *data;
+    size_t len;
+} tft_font_builtin_t;
+
+// Generated table (main/tft_font_data.c).
+extern const tft_font_builtin_t tft_font_builtins[];
+extern const int tft_font_builtin_count;
+
+typedef struct {
+    const uint8_t *bits; // packed or RLE bitmap, see tft_font_glyph_row()
+    uint16_t len;
+    uint8_t width;
+    uint8_t advance;
+    bool rle;
+} tft_glyph_t;
+
+// Iterates a glyph bitmap one row at a time.
+typedef struct {
+    const tft_glyph_t *glyph;
+    uint32_t bit;     // packed: next bit index
+    uint16_t pos;     // RLE: next byte
+    uint16_t run;     // RLE: bits left in the current chunk
+    uint8_t color;    // RLE: colour of the current run
+    uint8_t flip;     // RLE: colour flips when the chunk ends
+} tft_glyph_reader_t;
+
+// NULL name selects the default ("small").
+const tft_font_t *tft_font_builtin(const char *name);
+tft_font_t *tft_font_open(const char *path);
+void tft_font_close(tft_font_t *font);
+
+int tft_font_height(const tft_font_t *font);
+int tft_font_ascent(const tft_font_t *font);
+int tft_font_text_width(const tft_font_t *font, const char *text);
+
+// Looks up `ch`; filesystem fonts read the bitmap into the font's scratch
+// buffer, which stays valid until the next call on the same font.
+bool tft_font_glyph(const tft_font_t *font, uint8_t ch, tft_glyph_t *out);
+void tft_glyph_reader_init(tft_glyph_reader_t *rd, const tft_glyph_t *glyph);
+// Decodes the next row into `row` (one byte per column, 0 or 1).
+void tft_glyph_read_row(tft_glyph_reader_t *rd, uint8_t *row);
@@ -0,0 +1,532 @@
+// Generated by tools/font_pack.py --builtin-c; do not edit.
+// Built-in BFN1 fonts, kept in flash and decoded in place by tft_font.c.
+
+#include <stdint.h>
+
+#include "tft_font.h"
+
+const uint8_t tft_font_small_data[1194] = {
+    0x42, 0x46, 0x4e, 0x31, 0x08, 0x07, 0x20, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03,
+    0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x25, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x2c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x33, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x45, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x4a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x59, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x5e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x63, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x6a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03,
+    0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x70, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x75, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x79, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x7e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x83, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x88, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x8d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x92, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x97, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x9c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xa1, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xa6, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xab, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0xae, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xb3, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xb8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xbd, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xc2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xc7, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xcc, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xd1, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xd6, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xdb, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xe0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xe5, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xea, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xef, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xf4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xf9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0xfe, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x06, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x0b, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x0e, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x13, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x18, 0x01, 0x00, 0x00, 0x02, 0x00, 0x02, 0x03, 0x1a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x1f, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x24, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x29, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x2e, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x33, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x38, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x3d, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x42, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x45, 0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05, 0x49, 0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x05,
+    0x4d, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04, 0x50, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x55, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x5a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x5f, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x64, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x69, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x6e, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x73, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x78, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x7d, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x82, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x87, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x8c, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06,
+    0x91, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0x96, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x99, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x9a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x03, 0x04,
+    0x9d, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05, 0x06, 0xfa, 0xb6, 0x80, 0x00, 0x52, 0xbe, 0xaf, 0xa9,
+    0x40, 0x23, 0xe8, 0xe2, 0xf8, 0x80, 0xc6, 0x44, 0x44, 0x4c, 0x60, 0x64, 0xa8, 0x8a, 0xc9, 0xa0,
+    0xd8, 0x00, 0x2a, 0x48, 0x88, 0x88, 0x92, 0xa0, 0x01, 0x2a, 0xea, 0x90, 0x00, 0x01, 0x09, 0xf2,
+    0x10, 0x00, 0x00, 0xd8, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x44, 0x44, 0x40, 0x00,
+    0x74, 0x67, 0x5c, 0xc5, 0xc0, 0x59, 0x24, 0xb8, 0x74, 0x42, 0x22, 0x23, 0xe0, 0xf8, 0x88, 0x20,
+    0xc5, 0xc0, 0x11, 0x95, 0x2f, 0x88, 0x40, 0xfc, 0x3c, 0x10, 0xc5, 0xc0, 0x32, 0x21, 0xe8, 0xc5,
+    0xc0, 0xf8, 0x44, 0x44, 0x21, 0x00, 0x74, 0x62, 0xe8, 0xc5, 0xc0, 0x74, 0x62, 0xf0, 0x89, 0x80,
+    0x3c, 0xf0, 0x3c, 0xd8, 0x12, 0x48, 0x42, 0x10, 0x00, 0x3e, 0x0f, 0x80, 0x00, 0x84, 0x21, 0x24,
+    0x80, 0x74, 0x42, 0x22, 0x00, 0x80, 0x74, 0x42, 0xda, 0xd5, 0xc0, 0x74, 0x63, 0x1f, 0xc6, 0x20,
+    0xf4, 0x63, 0xe8, 0xc7, 0xc0, 0x74, 0x61, 0x08, 0x45, 0xc0, 0xe4, 0xa3, 0x18, 0xcb, 0x80, 0xfc,
+    0x21, 0xe8, 0x43, 0xe0, 0xfc, 0x21, 0xe8, 0x42, 0x00, 0x74, 0x61, 0x78, 0xc5, 0xe0, 0x8c, 0x63,
+    0xf8, 0xc6, 0x20, 0xe9, 0x24, 0xb8, 0x38, 0x84, 0x21, 0x49, 0x80, 0x8c, 0xa9, 0x8a, 0x4a, 0x20,
+    0x84, 0x21, 0x08, 0x43, 0xe0, 0x8e, 0xeb, 0x58, 0xc6, 0x20, 0x8c, 0x73, 0x59, 0xc6, 0x20, 0x74,
+    0x63, 0x18, 0xc5, 0xc0, 0xf4, 0x63, 0xe8, 0x42, 0x00, 0x74, 0x63, 0x1a, 0xc9, 0xa0, 0xf4, 0x63,
+    0xea, 0x4a, 0x20, 0x7c, 0x20, 0xe0, 0x87, 0xc0, 0xf9, 0x08, 0x42, 0x10, 0x80, 0x8c, 0x63, 0x18,
+    0xc5, 0xc0, 0x8c, 0x63, 0x18, 0xa8, 0x80, 0x8c, 0x63, 0x5a, 0xee, 0x20, 0x8c, 0x54, 0x45, 0x46,
+    0x20, 0x8c, 0x54, 0x42, 0x10, 0x80, 0xf8, 0x44, 0x44, 0x43, 0xe0, 0xf2, 0x49, 0x38, 0x04, 0x10,
+    0x41, 0x04, 0x00, 0xe4, 0x92, 0x78, 0x22, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0,
+    0xe4, 0x00, 0x00, 0x1c, 0x17, 0xc5, 0xe0, 0x84, 0x2d, 0x98, 0xc7, 0xc0, 0x00, 0x1d, 0x08, 0x45,
+    0xc0, 0x08, 0x5b, 0x38, 0xc5, 0xe0, 0x00, 0x1d, 0x1f, 0xc1, 0xc0, 0x32, 0x51, 0xc4, 0x21, 0x00,
+    0x03, 0xe3, 0x17, 0x85, 0xc0, 0x84, 0x2d, 0x98, 0xc6, 0x20, 0x43, 0x24, 0xb8, 0x10, 0x31, 0x19,
+    0x60, 0x88, 0x9a, 0xca, 0x90, 0xc9, 0x24, 0xb8, 0x00, 0x35, 0x5a, 0xc6, 0x20, 0x00, 0x2d, 0x98,
+    0xc6, 0x20, 0x00, 0x1d, 0x18, 0xc5, 0xc0, 0x00, 0x3d, 0x1f, 0x42, 0x00, 0x00, 0x1b, 0x37, 0x84,
+    0x20, 0x00, 0x2d, 0x98, 0x42, 0x00, 0x00, 0x1d, 0x07, 0x07, 0xc0, 0x42, 0x38, 0x84, 0x24, 0xc0,
+    0x00, 0x23, 0x18, 0xcd, 0xa0, 0x00, 0x23, 0x18, 0xa8, 0x80, 0x00, 0x23, 0x1a, 0xd5, 0x40, 0x00,
+    0x22, 0xa2, 0x2a, 0x20, 0x00, 0x23, 0x17, 0x85, 0xc0, 0x00, 0x3e, 0x22, 0x23, 0xe0, 0x29, 0x44,
+    0x88, 0xfe, 0x89, 0x14, 0xa0, 0x00, 0x00, 0xd9, 0x00, 0x00,
+};
+
+const uint8_t tft_font_medium_data[2448] = {
+    0x42, 0x46, 0x4e, 0x31, 0x10, 0x0e, 0x20, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x4c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x60, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06,
+    0x68, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08, 0x74, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x94, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xa8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06, 0xb0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xc4, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06, 0xcc, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xe0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xf4, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x14, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x28, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x3c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x50, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x64, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x78, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x8c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xa0, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06, 0xa8, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06,
+    0xb0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x08, 0x0a, 0xc0, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xd4, 0x01, 0x00, 0x00, 0x10, 0x00, 0x08, 0x0a, 0xe4, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xf8, 0x01, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x0c, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x20, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x34, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x48, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x5c, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x70, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x84, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x98, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xac, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0xb8, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xcc, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xe0, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xf4, 0x02, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x08, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x1c, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x30, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x44, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x58, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x6c, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x80, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x94, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xa8, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xbc, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xd0, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xe4, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xf8, 0x03, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x0c, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x18, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x2c, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x38, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x4c, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x60, 0x04, 0x00, 0x00, 0x08, 0x00, 0x04, 0x06, 0x68, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x7c, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x90, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xa4, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xb8, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xcc, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xe0, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xf4, 0x04, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x08, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x14, 0x05, 0x00, 0x00, 0x10, 0x00, 0x08, 0x0a, 0x24, 0x05, 0x00, 0x00, 0x10, 0x00, 0x08, 0x0a,
+    0x34, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08, 0x40, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x54, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x68, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x7c, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x90, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xa4, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xb8, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xcc, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xe0, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0xf4, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x08, 0x06, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x1c, 0x06, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x30, 0x06, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c,
+    0x44, 0x06, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0x58, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x64, 0x06, 0x00, 0x00, 0x04, 0x00, 0x02, 0x04, 0x68, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x08,
+    0x74, 0x06, 0x00, 0x00, 0x14, 0x00, 0x0a, 0x0c, 0xff, 0xff, 0xf0, 0xf0, 0xcf, 0x3c, 0xf3, 0xcf,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x31, 0xce, 0xff, 0xff, 0xf3,
+    0x30, 0xcc, 0xff, 0xff, 0xf7, 0x38, 0xcc, 0x33, 0x0c, 0xc0, 0x00, 0x00, 0x0c, 0x07, 0x83, 0xfd,
+    0xff, 0xcc, 0x33, 0x07, 0xf0, 0xfe, 0x0c, 0xc3, 0x3f, 0xfb, 0xfc, 0x1e, 0x03, 0x00, 0x00, 0x00,
+    0x60, 0x3c, 0x0f, 0x0d, 0x87, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x1b, 0x0f, 0x03,
+    0xc0, 0x60, 0x00, 0x00, 0x3c, 0x1f, 0x8e, 0x33, 0x0c, 0xce, 0x33, 0x03, 0x00, 0xc0, 0xcc, 0xf3,
+    0x3c, 0x33, 0x8c, 0x7c, 0xcf, 0x30, 0x00, 0x00, 0xef, 0x33, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x73, 0x9c, 0xe3, 0x0c, 0x30, 0xc3, 0x87, 0x0e, 0x1c, 0x30, 0x00, 0xc3, 0x87, 0x0e, 0x1c,
+    0x30, 0xc3, 0x0c, 0x73, 0x9c, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0xcc, 0xf3, 0x33,
+    0xf0, 0xfc, 0xcc, 0xf3, 0x30, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+    0x30, 0x0c, 0x07, 0x8f, 0xff, 0xff, 0x1e, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xef, 0x33, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+    0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x0f, 0x03, 0xc3, 0xf1, 0xfc,
+    0xcf, 0x33, 0xf8, 0xfc, 0x3c, 0x0f, 0x07, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x31, 0xcf, 0x3c, 0x70,
+    0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0x00, 0xc0, 0x70,
+    0x38, 0x1c, 0x0e, 0x07, 0x03, 0x01, 0xc0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x38,
+    0x0c, 0x0c, 0x03, 0x00, 0x70, 0x0e, 0x01, 0xc0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+    0x03, 0x01, 0xc0, 0xf0, 0x7c, 0x33, 0x1c, 0xcc, 0x33, 0x1e, 0xff, 0xdf, 0xf0, 0x78, 0x0c, 0x03,
+    0x00, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x03, 0x00, 0xff, 0x1f, 0xe0, 0x1c, 0x03, 0x00, 0xc0,
+    0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x0f, 0x07, 0xc3, 0x81, 0xc0, 0xc0, 0x30, 0x0f,
+    0xf3, 0xfe, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0xff, 0xbf, 0xf0, 0x0c,
+    0x03, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00,
+    0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x73, 0xf0, 0xfc, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f,
+    0x8f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x77, 0xfc, 0xff, 0x00, 0xc0,
+    0x30, 0x38, 0x1c, 0x3e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x6f, 0xf6, 0x00, 0x00,
+    0x00, 0x6f, 0xf6, 0x00, 0xef, 0x33, 0xec, 0x00, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xc0, 0xc0,
+    0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0,
+    0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x70, 0x38,
+    0x1c, 0x0e, 0x03, 0x03, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+    0x03, 0x00, 0xc0, 0x70, 0x38, 0x1c, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00,
+    0x3f, 0x1f, 0xee, 0x1f, 0x03, 0x00, 0xc0, 0x33, 0x8d, 0xf3, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0x7f,
+    0x8f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0xff, 0xff,
+    0xfe, 0x1f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f,
+    0xf3, 0xfc, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0xff, 0x9f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+    0x03, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+    0x7c, 0x3f, 0x8e, 0x73, 0x0e, 0xc1, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x7c, 0x3b, 0x9c, 0xfe,
+    0x1f, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x0f, 0xf3, 0xfc, 0xe0, 0x30,
+    0x0c, 0x03, 0x80, 0xff, 0xdf, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x0f,
+    0xf3, 0xfc, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+    0x03, 0xc0, 0x30, 0x0c, 0xfb, 0x3f, 0xc1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0xcf, 0xe0, 0x00, 0x00,
+    0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x7f, 0xff, 0xff, 0xe1, 0xf0, 0x3c, 0x0f, 0x03, 0xc0,
+    0xf0, 0x30, 0x00, 0x00, 0xff, 0xf7, 0x8c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00,
+    0x0f, 0xc3, 0xf0, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xcc, 0x33, 0x9c, 0x7e,
+    0x0f, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x7c, 0x3b, 0x1c, 0xce, 0x33, 0x0f, 0x03, 0xc0, 0xcc, 0x33,
+    0x8c, 0x73, 0x0e, 0xc1, 0xf0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+    0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x80, 0xff, 0xdf, 0xf0, 0x00, 0x00, 0xc0, 0xf8, 0x7f, 0x3f,
+    0xcf, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00,
+    0xc0, 0xf0, 0x3c, 0x0f, 0x83, 0xf0, 0xfe, 0x3c, 0xcf, 0x33, 0xc7, 0xf0, 0xfc, 0x1f, 0x03, 0xc0,
+    0xf0, 0x30, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0,
+    0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f,
+    0xfb, 0xfc, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+    0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xcc, 0xf3, 0x3c, 0x33, 0x8c, 0x7c, 0xcf, 0x30, 0x00, 0x00,
+    0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f, 0xfb, 0xfc, 0xcc, 0x33, 0x0c, 0x73, 0x0e, 0xc1,
+    0xf0, 0x30, 0x00, 0x00, 0x3f, 0xdf, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x07, 0xf0, 0xfe, 0x01, 0xc0,
+    0x30, 0x0c, 0x07, 0xff, 0xbf, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xf1, 0xe0, 0x30, 0x0c, 0x03, 0x00,
+    0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f,
+    0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+    0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x1e,
+    0x03, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0xcf, 0x33, 0xcc, 0xf3,
+    0x3f, 0x3f, 0xcf, 0xe1, 0xf0, 0x30, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x73, 0x8c, 0xc0,
+    0xc0, 0x30, 0x33, 0x1c, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f,
+    0x87, 0x73, 0x8c, 0xc1, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00,
+    0xff, 0xbf, 0xf0, 0x0c, 0x03, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0c, 0x03, 0x00, 0xff,
+    0xdf, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x38, 0xfd, 0xf0, 0x00,
+    0x00, 0x00, 0x0c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfb, 0xf1, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0xff, 0xe0, 0x00,
+    0x0c, 0x07, 0x83, 0x31, 0xce, 0xe1, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xcc, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xe0, 0x0c, 0x03, 0x3f, 0xdf, 0xfc, 0x0f, 0x03, 0x7f,
+    0xcf, 0xe0, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0xf0,
+    0x3c, 0x0f, 0x87, 0xff, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xce,
+    0x03, 0x00, 0xc0, 0x30, 0x0c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c,
+    0x03, 0x3c, 0xdf, 0x3e, 0x7f, 0x0f, 0xc1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0xcf, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xec, 0x0f, 0x03, 0xff, 0xff, 0xec, 0x03, 0x00, 0x7f,
+    0x0f, 0xc0, 0x00, 0x00, 0x0f, 0x07, 0xe3, 0x9c, 0xc3, 0x30, 0x1e, 0x0f, 0xc3, 0xf0, 0x78, 0x0c,
+    0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf9, 0xff, 0xe1, 0xf0, 0x3c,
+    0x0f, 0x87, 0x7f, 0xcf, 0xf0, 0x0c, 0x03, 0x3f, 0x8f, 0xc0, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03,
+    0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00,
+    0x30, 0xc0, 0x00, 0xe3, 0xc7, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0xc3, 0xe7, 0x7e, 0x3c, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc3, 0xc7, 0xce, 0xcc, 0xf0, 0xf0, 0xcc, 0xce, 0xc7, 0xc3, 0x00, 0x00, 0xe3, 0xc7, 0x0c, 0x30,
+    0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x3c, 0xec,
+    0xcf, 0x33, 0xcc, 0xf3, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x7f,
+    0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0xec, 0x0f, 0x03, 0xff, 0xbf,
+    0xce, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xdf, 0x3c,
+    0x1f, 0x0f, 0x7f, 0xcf, 0xf0, 0x1c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xcc, 0x03, 0x00, 0x7f, 0x0f, 0xe0, 0x0c, 0x03, 0xff,
+    0xbf, 0xc0, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x01, 0xe0, 0xfc, 0x3f, 0x07, 0x80, 0xc0, 0x30, 0x0c,
+    0x03, 0x0c, 0xe7, 0x1f, 0x83, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c,
+    0x0f, 0x03, 0xc0, 0xf0, 0x7c, 0x3f, 0x9f, 0x7c, 0xcf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x1e, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0x73,
+    0x8c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x0c, 0x03,
+    0x03, 0x31, 0xce, 0xe1, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c,
+    0x0f, 0x87, 0x7f, 0xcf, 0xf0, 0x0c, 0x03, 0x3f, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xf0, 0x38, 0x0c, 0x0e, 0x07, 0x03, 0x01, 0xc0, 0xff, 0xff, 0xf0, 0x00, 0x00,
+    0x0c, 0x73, 0x8c, 0x31, 0xcc, 0x30, 0x70, 0xc3, 0x0e, 0x1c, 0x30, 0x00, 0xff, 0xff, 0xff, 0xf0,
+    0xc3, 0x87, 0x0c, 0x30, 0xe0, 0xc3, 0x38, 0xc3, 0x1c, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xcd, 0xf3, 0xe7, 0xb0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t tft_font_large_data[4511] = {
+    0x42, 0x46, 0x4e, 0x31, 0x18, 0x15, 0x20, 0x5f, 0x01, 0x00, 0x00, 0x00, 0x97, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x06,
+    0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x09, 0x0c, 0x1a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x0f, 0x12,
+    0x5b, 0x00, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12, 0x8e, 0x00, 0x00, 0x00, 0x37, 0x00, 0x0f, 0x12,
+    0xc5, 0x00, 0x00, 0x00, 0x49, 0x00, 0x0f, 0x12, 0x0e, 0x01, 0x00, 0x00, 0x11, 0x00, 0x06, 0x09,
+    0x1f, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x09, 0x0c, 0x4a, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x09, 0x0c,
+    0x75, 0x01, 0x00, 0x00, 0x2f, 0x00, 0x0f, 0x12, 0xa4, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x0f, 0x12,
+    0xbf, 0x01, 0x00, 0x00, 0x11, 0x00, 0x06, 0x09, 0xd0, 0x01, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x12,
+    0xd3, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x09, 0xde, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x12,
+    0xfd, 0x01, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12, 0x30, 0x02, 0x00, 0x00, 0x27, 0x00, 0x09, 0x0c,
+    0x57, 0x02, 0x00, 0x00, 0x29, 0x00, 0x0f, 0x12, 0x80, 0x02, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0xa7, 0x02, 0x00, 0x00, 0x37, 0x00, 0x0f, 0x12, 0xde, 0x02, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0x05, 0x03, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0x12, 0x32, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x0f, 0x12,
+    0x5d, 0x03, 0x00, 0x00, 0x2f, 0x00, 0x0f, 0x12, 0x8c, 0x03, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0x12,
+    0xb9, 0x03, 0x00, 0x00, 0x15, 0x00, 0x06, 0x09, 0xce, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x06, 0x09,
+    0xe9, 0x03, 0x00, 0x00, 0x2b, 0x00, 0x0c, 0x0f, 0x14, 0x04, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x12,
+    0x19, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x0c, 0x0f, 0x44, 0x04, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0x6b, 0x04, 0x00, 0x00, 0x3f, 0x00, 0x0f, 0x12, 0xaa, 0x04, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0xd1, 0x04, 0x00, 0x00, 0x2b, 0x00, 0x0f, 0x12, 0xfc, 0x04, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0x12,
+    0x29, 0x05, 0x00, 0x00, 0x37, 0x00, 0x0f, 0x12, 0x60, 0x05, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0x87, 0x05, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12, 0xae, 0x05, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12,
+    0xdf, 0x05, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12, 0x06, 0x06, 0x00, 0x00, 0x23, 0x00, 0x09, 0x0c,
+    0x29, 0x06, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12, 0x5a, 0x06, 0x00, 0x00, 0x45, 0x00, 0x0f, 0x12,
+    0x9f, 0x06, 0x00, 0x00, 0x2b, 0x00, 0x0f, 0x12, 0xca, 0x06, 0x00, 0x00, 0x39, 0x00, 0x0f, 0x12,
+    0x03, 0x07, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12, 0x36, 0x07, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0x12,
+    0x63, 0x07, 0x00, 0x00, 0x2b, 0x00, 0x0f, 0x12, 0x8e, 0x07, 0x00, 0x00, 0x3d, 0x00, 0x0f, 0x12,
+    0xcb, 0x07, 0x00, 0x00, 0x39, 0x00, 0x0f, 0x12, 0x04, 0x08, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0x2b, 0x08, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12, 0x52, 0x08, 0x00, 0x00, 0x2d, 0x00, 0x0f, 0x12,
+    0x7f, 0x08, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12, 0xb2, 0x08, 0x00, 0x00, 0x39, 0x00, 0x0f, 0x12,
+    0xeb, 0x08, 0x00, 0x00, 0x3b, 0x00, 0x0f, 0x12, 0x26, 0x09, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12,
+    0x59, 0x09, 0x00, 0x00, 0x2b, 0x00, 0x0f, 0x12, 0x84, 0x09, 0x00, 0x00, 0x27, 0x00, 0x09, 0x0c,
+    0xab, 0x09, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x12, 0xca, 0x09, 0x00, 0x00, 0x27, 0x00, 0x09, 0x0c,
+    0xf1, 0x09, 0x00, 0x00, 0x1b, 0x00, 0x0f, 0x12, 0x0c, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x12,
+    0x10, 0x0a, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x1f, 0x0a, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x12,
+    0x3e, 0x0a, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12, 0x6f, 0x0a, 0x00, 0x00, 0x21, 0x00, 0x0f, 0x12,
+    0x90, 0x0a, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12, 0xc1, 0x0a, 0x00, 0x00, 0x1d, 0x00, 0x0f, 0x12,
+    0xde, 0x0a, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12, 0x0f, 0x0b, 0x00, 0x00, 0x25, 0x00, 0x0f, 0x12,
+    0x34, 0x0b, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12, 0x67, 0x0b, 0x00, 0x00, 0x21, 0x00, 0x09, 0x0c,
+    0x88, 0x0b, 0x00, 0x00, 0x25, 0x00, 0x0c, 0x0f, 0xad, 0x0b, 0x00, 0x00, 0x39, 0x00, 0x0c, 0x0f,
+    0xe6, 0x0b, 0x00, 0x00, 0x27, 0x00, 0x09, 0x0c, 0x0d, 0x0c, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12,
+    0x40, 0x0c, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12, 0x67, 0x0c, 0x00, 0x00, 0x21, 0x00, 0x0f, 0x12,
+    0x88, 0x0c, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0x12, 0xa7, 0x0c, 0x00, 0x00, 0x25, 0x00, 0x0f, 0x12,
+    0xcc, 0x0c, 0x00, 0x00, 0x25, 0x00, 0x0f, 0x12, 0xf1, 0x0c, 0x00, 0x00, 0x1d, 0x00, 0x0f, 0x12,
+    0x0e, 0x0d, 0x00, 0x00, 0x31, 0x00, 0x0f, 0x12, 0x3f, 0x0d, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12,
+    0x66, 0x0d, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x12, 0x8d, 0x0d, 0x00, 0x00, 0x33, 0x00, 0x0f, 0x12,
+    0xc0, 0x0d, 0x00, 0x00, 0x2f, 0x00, 0x0f, 0x12, 0xef, 0x0d, 0x00, 0x00, 0x21, 0x00, 0x0f, 0x12,
+    0x10, 0x0e, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x12, 0x27, 0x0e, 0x00, 0x00, 0x2b, 0x00, 0x09, 0x0c,
+    0x52, 0x0e, 0x00, 0x00, 0x03, 0x00, 0x03, 0x06, 0x55, 0x0e, 0x00, 0x00, 0x2b, 0x00, 0x09, 0x0c,
+    0x80, 0x0e, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x12, 0x00, 0x2d, 0x09, 0x09, 0x09, 0x00, 0x03, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x03, 0x87, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x02, 0x2d, 0x03, 0x03, 0x03, 0x03,
+    0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x2d, 0x02, 0x04, 0x03, 0x04, 0x04, 0x04,
+    0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x30, 0x06, 0x03, 0x0c, 0x03, 0x0b, 0x06, 0x07, 0x0c, 0x03, 0x0c, 0x02, 0x10, 0x03,
+    0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x08, 0x0a, 0x06, 0x09, 0x06, 0x0a, 0x08,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x10, 0x02, 0x0c, 0x03, 0x0c, 0x07,
+    0x06, 0x0b, 0x03, 0x0c, 0x03, 0x33, 0x02, 0x02, 0x0c, 0x04, 0x0a, 0x06, 0x09, 0x06, 0x06, 0x03,
+    0x01, 0x04, 0x07, 0x03, 0x02, 0x02, 0x07, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04,
+    0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x07, 0x02, 0x02, 0x03,
+    0x07, 0x04, 0x01, 0x03, 0x06, 0x06, 0x09, 0x06, 0x0a, 0x04, 0x0c, 0x02, 0x2f, 0x03, 0x06, 0x09,
+    0x06, 0x08, 0x08, 0x05, 0x05, 0x04, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x06,
+    0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x05, 0x04, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x06, 0x03, 0x03, 0x2d, 0x00, 0x04, 0x02, 0x05, 0x01, 0x06, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x02, 0x03, 0x03, 0x03, 0x5d, 0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x03, 0x04, 0x05,
+    0x03, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06,
+    0x03, 0x06, 0x04, 0x05, 0x04, 0x07, 0x04, 0x06, 0x03, 0x06, 0x04, 0x07, 0x04, 0x06, 0x03, 0x06,
+    0x03, 0x1b, 0x00, 0x03, 0x06, 0x03, 0x06, 0x04, 0x07, 0x04, 0x06, 0x03, 0x06, 0x04, 0x07, 0x04,
+    0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05, 0x04,
+    0x03, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x04, 0x05, 0x03, 0x06, 0x03, 0x21, 0x33, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03,
+    0x06, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x60, 0x33, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0b, 0x05, 0x09, 0x07, 0x04, 0x2d, 0x04, 0x07, 0x09, 0x05, 0x0b, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x60, 0x48, 0x04, 0x02, 0x05, 0x01, 0x06, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x03, 0x15, 0x87, 0x2d, 0xb4, 0x5c, 0x02, 0x03, 0x04, 0x01,
+    0x0c, 0x01, 0x04, 0x03, 0x02, 0x14, 0x39, 0x03, 0x0c, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03,
+    0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04,
+    0x0b, 0x03, 0x0c, 0x03, 0x66, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x07, 0x07, 0x08,
+    0x06, 0x09, 0x06, 0x06, 0x09, 0x06, 0x09, 0x05, 0x0a, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03,
+    0x06, 0x03, 0x03, 0x03, 0x0a, 0x05, 0x09, 0x06, 0x09, 0x06, 0x06, 0x09, 0x06, 0x08, 0x07, 0x07,
+    0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x03, 0x03, 0x06, 0x03, 0x05, 0x04, 0x03, 0x06,
+    0x03, 0x06, 0x03, 0x06, 0x05, 0x04, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x05, 0x04, 0x05, 0x02, 0x1b, 0x1b, 0x03,
+    0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x08, 0x08, 0x07, 0x09, 0x03, 0x0c, 0x03, 0x0b,
+    0x04, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09,
+    0x03, 0x0c, 0x03, 0x0b, 0x04, 0x09, 0x2d, 0x2d, 0x00, 0x2d, 0x09, 0x04, 0x0b, 0x03, 0x0c, 0x03,
+    0x09, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0e, 0x04, 0x0c, 0x03, 0x0c, 0x04, 0x0d, 0x04, 0x0b, 0x04,
+    0x0c, 0x06, 0x09, 0x06, 0x08, 0x09, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x09,
+    0x03, 0x0c, 0x03, 0x0b, 0x04, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x06, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x05, 0x02,
+    0x03, 0x04, 0x06, 0x02, 0x0f, 0x01, 0x0e, 0x02, 0x0d, 0x07, 0x06, 0x0a, 0x05, 0x0b, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x30, 0x02, 0x0d, 0x01, 0x20, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x0c,
+    0x04, 0x0b, 0x05, 0x0b, 0x0c, 0x05, 0x0b, 0x04, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x06,
+    0x09, 0x06, 0x08, 0x09, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x06, 0x06, 0x09,
+    0x06, 0x08, 0x07, 0x06, 0x05, 0x0a, 0x03, 0x0b, 0x04, 0x09, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x0c, 0x03, 0x0c, 0x03, 0x0d, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07,
+    0x09, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x00, 0x0d, 0x02, 0x0e, 0x01, 0x0f,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03,
+    0x0b, 0x04, 0x09, 0x04, 0x0b, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x36, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x07,
+    0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03,
+    0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05, 0x02, 0x0b, 0x05,
+    0x09, 0x06, 0x09, 0x30, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07,
+    0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05, 0x02, 0x0d, 0x03, 0x0c, 0x03, 0x0c, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x09, 0x04, 0x0b, 0x03, 0x0a, 0x05, 0x06, 0x07, 0x08, 0x06, 0x09, 0x06,
+    0x33, 0x14, 0x02, 0x03, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x03, 0x02, 0x16, 0x02, 0x03, 0x04, 0x01,
+    0x0c, 0x01, 0x04, 0x03, 0x02, 0x26, 0x14, 0x02, 0x03, 0x04, 0x01, 0x0c, 0x01, 0x04, 0x03, 0x02,
+    0x14, 0x04, 0x02, 0x05, 0x01, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x03,
+    0x15, 0x09, 0x03, 0x09, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08,
+    0x03, 0x08, 0x04, 0x06, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0b, 0x04, 0x09, 0x03, 0x09, 0x04, 0x0a,
+    0x04, 0x09, 0x03, 0x09, 0x04, 0x0a, 0x04, 0x09, 0x03, 0x09, 0x03, 0x24, 0x5a, 0x2d, 0x2d, 0x2d,
+    0x87, 0x00, 0x03, 0x09, 0x03, 0x09, 0x04, 0x0a, 0x04, 0x09, 0x03, 0x09, 0x04, 0x0a, 0x04, 0x09,
+    0x03, 0x09, 0x04, 0x0b, 0x03, 0x09, 0x03, 0x09, 0x03, 0x06, 0x04, 0x08, 0x03, 0x08, 0x04, 0x06,
+    0x04, 0x08, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x09, 0x03, 0x2d, 0x03, 0x09, 0x06, 0x09,
+    0x05, 0x0b, 0x02, 0x05, 0x05, 0x08, 0x08, 0x07, 0x09, 0x03, 0x0c, 0x03, 0x0b, 0x04, 0x0b, 0x04,
+    0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x39, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x33, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x08, 0x08, 0x07, 0x09,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x05, 0x04, 0x03, 0x02,
+    0x07, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x02, 0x0b, 0x05, 0x09, 0x06,
+    0x09, 0x30, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x37, 0x05, 0x09, 0x07, 0x07,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x02, 0x0a, 0x04, 0x0b, 0x03, 0x0d, 0x02,
+    0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x11, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x12, 0x03,
+    0x0b, 0x05, 0x0a, 0x30, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x08, 0x06,
+    0x09, 0x06, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x09, 0x07, 0x08, 0x08, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09,
+    0x30, 0x02, 0x07, 0x07, 0x08, 0x06, 0x0a, 0x05, 0x05, 0x02, 0x05, 0x03, 0x04, 0x05, 0x03, 0x03,
+    0x03, 0x06, 0x04, 0x02, 0x03, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x08, 0x07, 0x08, 0x07, 0x06, 0x04, 0x02, 0x04, 0x05, 0x03, 0x03, 0x05, 0x02,
+    0x05, 0x03, 0x0a, 0x06, 0x08, 0x08, 0x07, 0x33, 0x02, 0x0d, 0x01, 0x22, 0x0a, 0x04, 0x0b, 0x03,
+    0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0a, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x05, 0x0a, 0x04,
+    0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0a, 0x0f, 0x01, 0x0e, 0x02, 0x0d, 0x2d, 0x02,
+    0x0d, 0x01, 0x22, 0x0a, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0a, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x05, 0x0a, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x39, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09,
+    0x08, 0x06, 0x09, 0x06, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x03, 0x07, 0x02, 0x03, 0x03, 0x08,
+    0x01, 0x03, 0x03, 0x0c, 0x07, 0x08, 0x08, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05,
+    0x02, 0x0d, 0x03, 0x0b, 0x04, 0x0a, 0x2f, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x37, 0x05, 0x09, 0x07, 0x07, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x00, 0x1b,
+    0x02, 0x05, 0x04, 0x05, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x05, 0x04, 0x05, 0x02, 0x1b,
+    0x1b, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x08, 0x05, 0x0a, 0x05, 0x0b, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x03,
+    0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x05, 0x02, 0x05, 0x05, 0x08, 0x08, 0x06, 0x09,
+    0x06, 0x33, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x06, 0x04, 0x02, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x05, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03,
+    0x06, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x04, 0x02, 0x03,
+    0x08, 0x07, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x00, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0a, 0x0f, 0x01, 0x0e, 0x02,
+    0x0d, 0x2d, 0x00, 0x03, 0x09, 0x06, 0x09, 0x07, 0x07, 0x0a, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x09,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x00, 0x03, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x07, 0x08, 0x07, 0x08, 0x09, 0x06, 0x09, 0x06, 0x0a, 0x05, 0x06, 0x03,
+    0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x05, 0x0a, 0x06, 0x09, 0x06,
+    0x09, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x03, 0x09,
+    0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07,
+    0x07, 0x09, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x02, 0x0a, 0x04, 0x0b, 0x03,
+    0x0d, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x12, 0x02,
+    0x0c, 0x03, 0x0c, 0x03, 0x05, 0x0a, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x39, 0x03, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09,
+    0x07, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x04,
+    0x05, 0x03, 0x03, 0x05, 0x04, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x2d, 0x02, 0x0a, 0x04, 0x0b, 0x03, 0x0d, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09,
+    0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x12, 0x02, 0x0c, 0x03, 0x0c, 0x03, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x05, 0x04, 0x03, 0x03, 0x06, 0x03, 0x03,
+    0x03, 0x06, 0x04, 0x02, 0x03, 0x08, 0x07, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x03, 0x0c, 0x03, 0x0c,
+    0x02, 0x12, 0x0a, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0b, 0x05, 0x0c, 0x0a, 0x06, 0x09,
+    0x06, 0x0a, 0x0c, 0x05, 0x0b, 0x04, 0x0c, 0x03, 0x0c, 0x03, 0x0b, 0x04, 0x0a, 0x12, 0x02, 0x0c,
+    0x03, 0x0c, 0x30, 0x00, 0x2d, 0x04, 0x07, 0x09, 0x05, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x33, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05,
+    0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x07, 0x07, 0x08, 0x07, 0x04, 0x02, 0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x08, 0x05, 0x0b, 0x03, 0x0c, 0x03, 0x33, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x03, 0x03,
+    0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03,
+    0x03, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0a, 0x07, 0x07, 0x09, 0x06,
+    0x09, 0x03, 0x2d, 0x00, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x08, 0x07,
+    0x04, 0x02, 0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x09, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x02,
+    0x04, 0x07, 0x08, 0x07, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x00, 0x03,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x08, 0x07, 0x04, 0x02, 0x04, 0x03, 0x04,
+    0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x08, 0x05, 0x0a, 0x05, 0x0b, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x33, 0x00, 0x0d, 0x02, 0x0e, 0x01, 0x0f, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x09, 0x04, 0x0b,
+    0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x0f, 0x01, 0x0e, 0x02, 0x0d, 0x2d, 0x02, 0x07, 0x01, 0x16,
+    0x04, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x05, 0x04, 0x09, 0x01, 0x08,
+    0x02, 0x07, 0x1b, 0x2d, 0x03, 0x0c, 0x03, 0x0c, 0x04, 0x0d, 0x04, 0x0c, 0x03, 0x0c, 0x04, 0x0d,
+    0x04, 0x0c, 0x03, 0x0c, 0x04, 0x0d, 0x04, 0x0c, 0x03, 0x0c, 0x04, 0x0d, 0x04, 0x0c, 0x03, 0x0c,
+    0x03, 0x5a, 0x00, 0x07, 0x02, 0x08, 0x01, 0x09, 0x04, 0x05, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x05, 0x04, 0x04, 0x16, 0x01, 0x07, 0x1d, 0x06, 0x03, 0x0c, 0x03, 0x0b, 0x05, 0x08,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x02, 0x04, 0x07, 0x07, 0x09,
+    0x06, 0x09, 0x03, 0xe1, 0xff, 0x0f, 0x2d, 0x2d, 0x02, 0x04, 0x01, 0x0e, 0x03, 0x03, 0x03, 0x03,
+    0x05, 0x04, 0x03, 0x03, 0x03, 0x03, 0x5a, 0x5d, 0x09, 0x06, 0x09, 0x06, 0x0a, 0x0e, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x03, 0x0c, 0x03, 0x0c, 0x02, 0x10, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x02,
+    0x0d, 0x03, 0x0b, 0x04, 0x0a, 0x2f, 0x00, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x07, 0x02, 0x08,
+    0x02, 0x0b, 0x05, 0x0a, 0x06, 0x07, 0x08, 0x07, 0x08, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09,
+    0x05, 0x12, 0x03, 0x0b, 0x05, 0x0a, 0x30, 0x5d, 0x09, 0x06, 0x09, 0x05, 0x0a, 0x03, 0x05, 0x0a,
+    0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x09, 0x07, 0x08, 0x08, 0x05,
+    0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x02, 0x07, 0x03, 0x08,
+    0x02, 0x0c, 0x05, 0x09, 0x06, 0x09, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09,
+    0x05, 0x05, 0x02, 0x0d, 0x03, 0x0b, 0x04, 0x0a, 0x2f, 0x5d, 0x09, 0x06, 0x09, 0x05, 0x0b, 0x02,
+    0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x20, 0x01, 0x0d, 0x02, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0e,
+    0x0a, 0x06, 0x09, 0x06, 0x09, 0x30, 0x06, 0x06, 0x09, 0x06, 0x08, 0x08, 0x05, 0x05, 0x02, 0x05,
+    0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x0b, 0x05, 0x0a, 0x05, 0x08, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x08, 0x05, 0x0a, 0x05, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x36, 0x30, 0x0a, 0x05, 0x0b, 0x03, 0x12, 0x05, 0x09, 0x07,
+    0x07, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05, 0x02, 0x0d, 0x03, 0x0c, 0x03, 0x0c, 0x0c,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x03, 0x0a, 0x05, 0x09, 0x06, 0x09, 0x30, 0x00, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x07, 0x02, 0x08, 0x02, 0x0b, 0x05, 0x0a, 0x06, 0x07, 0x08, 0x07, 0x08, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x03,
+    0x03, 0x06, 0x03, 0x06, 0x03, 0x1e, 0x04, 0x05, 0x05, 0x04, 0x06, 0x05, 0x04, 0x05, 0x04, 0x06,
+    0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x05, 0x04, 0x05, 0x02, 0x1b, 0x1b,
+    0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x2a, 0x04, 0x08, 0x05, 0x07, 0x06, 0x08, 0x04, 0x08, 0x04,
+    0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x06, 0x06, 0x06, 0x05, 0x09, 0x02, 0x05, 0x02, 0x08,
+    0x05, 0x06, 0x06, 0x06, 0x27, 0x00, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09,
+    0x03, 0x09, 0x03, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x03, 0x04, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x04, 0x02, 0x03, 0x05, 0x07, 0x06, 0x06, 0x06, 0x03, 0x24, 0x00, 0x04,
+    0x05, 0x05, 0x04, 0x06, 0x05, 0x04, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03,
+    0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x05,
+    0x04, 0x05, 0x02, 0x1b, 0x1b, 0x5c, 0x04, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x04, 0x02, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x5a, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06,
+    0x03, 0x03, 0x03, 0x07, 0x02, 0x08, 0x02, 0x0b, 0x05, 0x0a, 0x06, 0x07, 0x08, 0x07, 0x08, 0x06,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x5d,
+    0x09, 0x06, 0x09, 0x05, 0x0b, 0x02, 0x05, 0x05, 0x09, 0x07, 0x07, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x09, 0x05, 0x05, 0x02, 0x0b, 0x05, 0x09, 0x06, 0x09, 0x30,
+    0x5c, 0x0a, 0x04, 0x0b, 0x03, 0x0d, 0x02, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x10, 0x02, 0x0c,
+    0x03, 0x0c, 0x03, 0x05, 0x0a, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x39, 0x5d,
+    0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x02, 0x07, 0x03, 0x06, 0x07, 0x08, 0x06, 0x09, 0x06,
+    0x06, 0x02, 0x0d, 0x03, 0x0c, 0x03, 0x0c, 0x0a, 0x05, 0x0b, 0x04, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x0c, 0x03, 0x2d, 0x5a, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x07,
+    0x02, 0x08, 0x02, 0x0b, 0x06, 0x09, 0x06, 0x07, 0x0b, 0x04, 0x0b, 0x03, 0x0c, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x39, 0x5d, 0x09, 0x06, 0x09, 0x05, 0x0a, 0x03,
+    0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0e, 0x0a, 0x06, 0x09, 0x06, 0x0a, 0x0e, 0x03, 0x0c, 0x03, 0x0c,
+    0x10, 0x02, 0x0c, 0x03, 0x0c, 0x30, 0x03, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x0b, 0x05,
+    0x0a, 0x05, 0x08, 0x09, 0x06, 0x09, 0x06, 0x09, 0x08, 0x05, 0x0a, 0x05, 0x0b, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x03, 0x06, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03, 0x05, 0x02, 0x05,
+    0x05, 0x08, 0x08, 0x06, 0x09, 0x06, 0x30, 0x5a, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x08, 0x07, 0x08, 0x07, 0x06, 0x0a, 0x05, 0x0b, 0x02,
+    0x08, 0x02, 0x07, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x2d, 0x5a, 0x03,
+    0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x07, 0x07, 0x08,
+    0x07, 0x04, 0x02, 0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x08, 0x05,
+    0x0b, 0x03, 0x0c, 0x03, 0x33, 0x5a, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x06, 0x09, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+    0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x03, 0x04, 0x05,
+    0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x30, 0x5a, 0x03, 0x09, 0x06, 0x09, 0x07, 0x07, 0x04,
+    0x02, 0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0c, 0x03,
+    0x0c, 0x03, 0x09, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x02, 0x04,
+    0x07, 0x07, 0x09, 0x06, 0x09, 0x03, 0x2d, 0x5a, 0x03, 0x09, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09,
+    0x07, 0x07, 0x09, 0x05, 0x05, 0x02, 0x0d, 0x03, 0x0c, 0x03, 0x0c, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x03, 0x03, 0x0a, 0x05, 0x09, 0x06, 0x09, 0x30, 0x5a, 0x2d, 0x09, 0x04, 0x0b, 0x03, 0x0c, 0x03,
+    0x09, 0x04, 0x0b, 0x03, 0x0b, 0x04, 0x09, 0x03, 0x0c, 0x03, 0x0b, 0x04, 0x09, 0x2d, 0x2d, 0x06,
+    0x03, 0x06, 0x03, 0x05, 0x04, 0x03, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05,
+    0x04, 0x03, 0x03, 0x06, 0x03, 0x06, 0x03, 0x08, 0x04, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06,
+    0x04, 0x05, 0x04, 0x07, 0x04, 0x06, 0x03, 0x06, 0x03, 0x1b, 0x00, 0x3f, 0x09, 0x00, 0x03, 0x06,
+    0x03, 0x06, 0x04, 0x07, 0x04, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x04, 0x08,
+    0x03, 0x06, 0x03, 0x06, 0x03, 0x03, 0x04, 0x05, 0x04, 0x05, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05,
+    0x04, 0x03, 0x04, 0x05, 0x03, 0x06, 0x03, 0x21, 0x8a, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03,
+    0x02, 0x07, 0x03, 0x08, 0x02, 0x06, 0x02, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x8a,
+};
+
+const tft_font_builtin_t tft_font_builtins[] = {
+    {"small", tft_font_small_data, sizeof(tft_font_small_data)},
+    {"medium", tft_font_medium_data, sizeof(tft_font_medium_data)},
+    {"large", tft_font_large_data, sizeof(tft_font_large_data)},
+};
+const int tft_font_builtin_count = sizeof(tft_font_builtins) / sizeof(tft_font_builtins[0]);
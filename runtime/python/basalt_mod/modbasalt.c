@@ -1,17 +1,158 @@
 #include "py/obj.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
+#include "py/binary.h"
+#include "py/mperrno.h"
 
 #include "board_config.h"
-#include "tft_console.h"
+#include "basalt_res.h"
+#include "micropython_embed.h"
+#include "modui.h"
+#include "runtime_api.h"
+#include "rt_kv.h"
 
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
+#include "driver/i2c.h"
+
+#ifndef BASALT_ENABLE_RTC
+#define BASALT_ENABLE_RTC 0
+#endif
+#ifndef BASALT_ENABLE_I2C
+#define BASALT_ENABLE_I2C 0
+#endif
+#ifndef BASALT_ENABLE_ADC
+#define BASALT_ENABLE_ADC 0
+#endif
+#if BASALT_ENABLE_ADC
+#include "hal/hal_adc.h"
+#endif
+#ifndef BASALT_ENABLE_IMU
+#define BASALT_ENABLE_IMU 0
+#endif
+#ifndef BASALT_ENABLE_BME280
+#define BASALT_ENABLE_BME280 0
+#endif
+#ifndef BASALT_CFG_IMU_ADDRESS
+#define BASALT_CFG_IMU_ADDRESS "0x68"
+#endif
+#ifndef BASALT_CFG_BME280_I2C_ADDRESS
+#define BASALT_CFG_BME280_I2C_ADDRESS "0x76"
+#endif
+#ifndef BASALT_PIN_I2C_SDA
+#define BASALT_PIN_I2C_SDA -1
+#endif
+#ifndef BASALT_PIN_I2C_SCL
+#define BASALT_PIN_I2C_SCL -1
+#endif
+#ifndef BASALT_CFG_RTC_ADDRESS
+#define BASALT_CFG_RTC_ADDRESS "0x68"
+#endif
+#ifndef BASALT_ENABLE_DISPLAY_SSD1306
+#define BASALT_ENABLE_DISPLAY_SSD1306 0
+#endif
+#ifndef BASALT_DISPLAY_SSD1306_ADDRESS
+#ifdef BASALT_CFG_DISPLAY_SSD1306_ADDRESS
+#define BASALT_DISPLAY_SSD1306_ADDRESS BASALT_CFG_DISPLAY_SSD1306_ADDRESS
+#else
+#define BASALT_DISPLAY_SSD1306_ADDRESS "0x3C"
+#endif
+#endif
+#ifndef BASALT_DISPLAY_SSD1306_WIDTH
+#ifdef BASALT_CFG_DISPLAY_SSD1306_WIDTH
+#define BASALT_DISPLAY_SSD1306_WIDTH BASALT_CFG_DISPLAY_SSD1306_WIDTH
+#else
+#define BASALT_DISPLAY_SSD1306_WIDTH 128
+#endif
+#endif
+#ifndef BASALT_DISPLAY_SSD1306_HEIGHT
+#ifdef BASALT_CFG_DISPLAY_SSD1306_HEIGHT
+#define BASALT_DISPLAY_SSD1306_HEIGHT BASALT_CFG_DISPLAY_SSD1306_HEIGHT
+#else
+#define BASALT_DISPLAY_SSD1306_HEIGHT 64
+#endif
+#endif
+#ifndef BASALT_DISPLAY_SSD1306_I2C_HZ
+#ifdef BASALT_CFG_DISPLAY_SSD1306_I2C_HZ
+#define BASALT_DISPLAY_SSD1306_I2C_HZ BASALT_CFG_DISPLAY_SSD1306_I2C_HZ
+#else
+#define BASALT_DISPLAY_SSD1306_I2C_HZ 400000
+#endif
+#endif
+
+static const char *TAG = "modbasalt";
+
+#if BASALT_ENABLE_I2C
+static bool s_i2c0_ready = false;
+static esp_err_t basalt_i2c0_ensure(int speed_hz) {
+    if (s_i2c0_ready) {
+        return ESP_OK;
+    }
+    if (BASALT_PIN_I2C_SDA < 0 || BASALT_PIN_I2C_SCL < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (speed_hz <= 0) speed_hz = 100000;
+
+    i2c_config_t cfg = {
+        .mode = I2C_MODE_MASTER,
+        .sda_io_num = BASALT_PIN_I2C_SDA,
+        .scl_io_num = BASALT_PIN_I2C_SCL,
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,
+        .master.clk_speed = (uint32_t)speed_hz,
+    };
+
+    esp_err_t err = i2c_param_config(I2C_NUM_0, &cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = i2c_driver_install(I2C_NUM_0, I2C_MODE_MASTER, 0, 0, 0);
+    if (err == ESP_ERR_INVALID_STATE) {
+        s_i2c0_ready = true;
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+    s_i2c0_ready = true;
+    return ESP_OK;
+}
+#endif
+
+// Pins an app drove as outputs; reset to their default state at app exit so
+// a stopped app doesn't leave anything switched on.
+static uint64_t s_gpio_claimed;
+static int s_gpio_res = -1;
+
+static void basalt_gpio_release(void *handle) {
+    (void)handle;
+    for (int pin = 0; pin < 64; pin++) {
+        if (s_gpio_claimed & (1ULL << pin)) {
+            gpio_reset_pin(pin);
+        }
+    }
+    s_gpio_claimed = 0;
+    s_gpio_res = -1;
+}
 
 // basalt.gpio.mode(pin, mode) where mode: 0=input, 1=output
 static mp_obj_t basalt_gpio_mode(mp_obj_t pin_obj, mp_obj_t mode_obj) {
     int pin = mp_obj_get_int(pin_obj);
     int mode = mp_obj_get_int(mode_obj);
+    if (mode && pin >= 0 && pin < 64) {
+        if (s_gpio_res < 0) {
+            s_gpio_res = basalt_res_track(basalt_gpio_release, NULL);
+        }
+        s_gpio_claimed |= 1ULL << pin;
+    }
     gpio_config_t io_conf = {
         .pin_bit_mask = (1ULL << pin),
         .mode = (mode ? GPIO_MODE_OUTPUT : GPIO_MODE_INPUT),
@@ -41,15 +182,299 @@ static mp_obj_t basalt_gpio_get(mp_obj_t pin_obj) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(basalt_gpio_get_obj, basalt_gpio_get);
 
-// basalt.timer.sleep_ms(ms)
+// Paced loops for the buffer APIs: wait until `deadline` (esp_timer µs),
+// sleeping through long gaps so the task watchdog and other tasks still run,
+// and let a stop request through every so often.
+#define BASALT_SEQ_PENDING_EVERY 256
+
+static void basalt_seq_wait_until(int64_t deadline) {
+    int64_t left = deadline - esp_timer_get_time();
+    if (left > 2000) {
+        vTaskDelay(pdMS_TO_TICKS((uint32_t)((left - 1000) / 1000)));
+    }
+    while (esp_timer_get_time() < deadline) {
+    }
+}
+
+// basalt.gpio.write_seq(pin, buf, period_us): drive pin to each byte of buf
+// (nonzero = high), one every period_us. Set the pin as an output first.
+static mp_obj_t basalt_gpio_write_seq(mp_obj_t pin_obj, mp_obj_t buf_obj, mp_obj_t period_obj) {
+    int pin = mp_obj_get_int(pin_obj);
+    mp_int_t period = mp_obj_get_int(period_obj);
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(buf_obj, &info, MP_BUFFER_READ);
+    if (period < 0) period = 0;
+    const uint8_t *levels = (const uint8_t *)info.buf;
+    int64_t next = esp_timer_get_time();
+    for (size_t i = 0; i < info.len; ++i) {
+        if (period > 0) {
+            basalt_seq_wait_until(next);
+            next += period;
+        }
+        gpio_set_level(pin, levels[i] ? 1 : 0);
+        if ((i + 1) % BASALT_SEQ_PENDING_EVERY == 0) {
+            mp_handle_pending(true);
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(basalt_gpio_write_seq_obj, basalt_gpio_write_seq);
+
+#if BASALT_ENABLE_ADC
+// One oneshot unit, re-targeted when an app reads a different pin and
+// released at app exit.
+static hal_adc_t s_adc;
+static int s_adc_pin = -1;
+static int s_adc_res = -1;
+static int s_adc_streams;  // basalt.stream samplers pinning the unit to s_adc_pin
+
+static void basalt_stream_stop_adc(void);
+
+// Resources are released newest slot first, but slots are reused, so an ADC
+// stream may still be sampling here; stop it before the unit goes away.
+static void basalt_adc_release(void *handle) {
+    (void)handle;
+    if (s_adc_streams > 0) {
+        basalt_stream_stop_adc();
+    }
+    if (s_adc_pin >= 0) {
+        hal_adc_deinit(&s_adc);
+    }
+    s_adc_pin = -1;
+    s_adc_res = -1;
+}
+
+static void basalt_adc_ensure(int pin) {
+    if (pin == s_adc_pin) return;
+    if (s_adc_streams > 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    if (s_adc_pin >= 0) {
+        hal_adc_deinit(&s_adc);
+        s_adc_pin = -1;
+    }
+    int rc = hal_adc_init_pin(&s_adc, pin, HAL_ADC_ATTEN_DB_11, 12);
+    if (rc != 0) {
+        mp_raise_OSError(rc < 0 ? -rc : rc);
+    }
+    s_adc_pin = pin;
+    if (s_adc_res < 0) {
+        s_adc_res = basalt_res_track(basalt_adc_release, NULL);
+    }
+}
+
+static int basalt_adc_sample(void) {
+    int raw = 0;
+    int rc = hal_adc_read_raw(&s_adc, &raw);
+    if (rc != 0) {
+        mp_raise_OSError(rc < 0 ? -rc : rc);
+    }
+    return raw;
+}
+
+// basalt.adc.read(pin): one raw 12-bit sample.
+static mp_obj_t basalt_adc_read(mp_obj_t pin_obj) {
+    basalt_adc_ensure(mp_obj_get_int(pin_obj));
+    return MP_OBJ_NEW_SMALL_INT(basalt_adc_sample());
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_adc_read_obj, basalt_adc_read);
+
+// basalt.adc.read_into(pin, buf[, period_us]): fill buf (array('H'),
+// array('h'), array('i'), ...) with raw samples, one every period_us;
+// returns the sample count. Nothing is allocated.
+static mp_obj_t basalt_adc_read_into(size_t n_args, const mp_obj_t *args) {
+    int pin = mp_obj_get_int(args[0]);
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(args[1], &info, MP_BUFFER_WRITE);
+    mp_int_t period = (n_args >= 3) ? mp_obj_get_int(args[2]) : 0;
+    if (period < 0) period = 0;
+    if (info.typecode != BYTEARRAY_TYPECODE && (info.typecode == 0 || !strchr("bBhHiIlL", info.typecode))) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer must hold integers"));
+    }
+    size_t item = mp_binary_get_size('@', info.typecode, NULL);
+    size_t count = info.len / item;
+    basalt_adc_ensure(pin);
+    int64_t next = esp_timer_get_time();
+    for (size_t i = 0; i < count; ++i) {
+        if (period > 0) {
+            basalt_seq_wait_until(next);
+            next += period;
+        }
+        mp_binary_set_val_array_from_int(info.typecode, info.buf, i, basalt_adc_sample());
+        if ((i + 1) % BASALT_SEQ_PENDING_EVERY == 0) {
+            mp_handle_pending(true);
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_adc_read_into_obj, 2, 3, basalt_adc_read_into);
+#endif // BASALT_ENABLE_ADC
+
+// basalt.timer.sleep_ms(ms). A stop request notifies the app task, which cuts
+// the sleep short so the pending KeyboardInterrupt is raised right away.
 static mp_obj_t basalt_timer_sleep_ms(mp_obj_t ms_obj) {
     int ms = mp_obj_get_int(ms_obj);
     if (ms < 0) ms = 0;
-    vTaskDelay(pdMS_TO_TICKS(ms));
+    TickType_t start = xTaskGetTickCount();
+    TickType_t total = pdMS_TO_TICKS(ms);
+    for (;;) {
+        TickType_t spent = xTaskGetTickCount() - start;
+        if (spent >= total) break;
+        ulTaskNotifyTake(pdTRUE, total - spent);
+        mp_handle_pending(true);
+    }
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(basalt_timer_sleep_ms_obj, basalt_timer_sleep_ms);
 
+// basalt.timer.ticks_us() -> microsecond counter that wraps at the small-int
+// range; compare two readings with ticks_diff(end, start).
+#define BASALT_TICKS_MASK MP_SMALL_INT_POSITIVE_MASK
+static mp_obj_t basalt_timer_ticks_us(void) {
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(esp_timer_get_time() & BASALT_TICKS_MASK));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_timer_ticks_us_obj, basalt_timer_ticks_us);
+
+static mp_obj_t basalt_timer_ticks_diff(mp_obj_t end_obj, mp_obj_t start_obj) {
+    mp_uint_t diff = ((mp_uint_t)mp_obj_get_int(end_obj) - (mp_uint_t)mp_obj_get_int(start_obj)) & BASALT_TICKS_MASK;
+    // Fold the upper half of the range into negative differences.
+    mp_int_t half = (BASALT_TICKS_MASK >> 1) + 1;
+    return MP_OBJ_NEW_SMALL_INT(((mp_int_t)diff ^ half) - half);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_timer_ticks_diff_obj, basalt_timer_ticks_diff);
+
+// basalt.events.poll([timeout_ms]) -> (type, code, a, b) or None on timeout.
+// The asyncio loop idles here: the VM task sleeps in rt_event_poll until an
+// event is posted, the next timer is due, or a stop request wakes it.
+static mp_obj_t basalt_events_poll(size_t n_args, const mp_obj_t *args) {
+    int timeout = n_args > 0 ? mp_obj_get_int(args[0]) : -1;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t total = timeout > 0 ? pdMS_TO_TICKS(timeout) : 0;
+    // Round sub-tick timeouts up rather than spinning through them.
+    if (timeout > 0 && total == 0) total = 1;
+    rt_event_t ev;
+    for (;;) {
+        uint32_t wait = RT_EVENT_WAIT_FOREVER;
+        if (timeout >= 0) {
+            TickType_t spent = xTaskGetTickCount() - start;
+            wait = spent >= total ? 0 : (uint32_t)((total - spent) * portTICK_PERIOD_MS);
+        }
+        int rc = rt_event_poll(&ev, wait);
+        mp_handle_pending(true);
+        if (rc < 0) mp_raise_OSError(-rc);
+        if (rc > 0) break;
+        if (wait == 0) return mp_const_none;
+    }
+    mp_obj_t items[4] = {
+        MP_OBJ_NEW_SMALL_INT(ev.type),
+        mp_obj_new_int((int32_t)ev.code),
+        mp_obj_new_int((int32_t)ev.a),
+        mp_obj_new_int((int32_t)ev.b),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_poll_obj, 0, 1, basalt_events_poll);
+
+// basalt.events.post(type[, code, a, b]): queue an event for any loop
+// waiting on that type. Never blocks; a full queue drops its oldest entry.
+static mp_obj_t basalt_events_post(size_t n_args, const mp_obj_t *args) {
+    rt_event_t ev = {
+        .type = (rt_event_type_t)mp_obj_get_int(args[0]),
+        .code = n_args > 1 ? (uint32_t)mp_obj_get_int(args[1]) : 0,
+        .a = n_args > 2 ? (uint32_t)mp_obj_get_int(args[2]) : 0,
+        .b = n_args > 3 ? (uint32_t)mp_obj_get_int(args[3]) : 0,
+    };
+    if (ev.type <= RT_EVT_NONE || ev.type >= RT_EVT_TYPE_COUNT) mp_raise_ValueError(MP_ERROR_TEXT("invalid event type"));
+    int rc = rt_event_post(&ev);
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_post_obj, 1, 4, basalt_events_post);
+
+// basalt.sys.stats() -> dict of this app's GC telemetry: collections, pause
+// times (pause_hist buckets: <250 us, <1, <4, <16, <64 ms, the rest), heap
+// size/use/high-water, largest free block, and allocation volume and rate.
+static mp_obj_t basalt_sys_stats(void) {
+    mp_embed_gc_stats_t gc;
+    mp_embed_gc_stats(&gc);
+    mp_obj_t hist[MP_EMBED_GC_PAUSE_BUCKETS];
+    for (int i = 0; i < MP_EMBED_GC_PAUSE_BUCKETS; ++i) {
+        hist[i] = mp_obj_new_int_from_uint(gc.pause_hist[i]);
+    }
+    mp_obj_t d = mp_obj_new_dict(13);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_collections), mp_obj_new_int_from_uint(gc.collections));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_max_us), mp_obj_new_int_from_uint(gc.max_pause_us));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_avg_us),
+        mp_obj_new_int_from_uint(gc.collections ? (mp_uint_t)(gc.total_pause_us / gc.collections) : 0));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_hist), mp_obj_new_tuple(MP_EMBED_GC_PAUSE_BUCKETS, hist));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_total), mp_obj_new_int_from_uint(gc.heap_total));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_used), mp_obj_new_int_from_uint(gc.heap_used));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_peak), mp_obj_new_int_from_uint(gc.heap_peak));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_max_free), mp_obj_new_int_from_uint(gc.heap_max_free));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_areas), mp_obj_new_int_from_uint(gc.areas));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_alloc_kb), mp_obj_new_int_from_uint((mp_uint_t)(gc.alloc_bytes / 1024)));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_alloc_rate),
+        mp_obj_new_int_from_uint(gc.elapsed_ms ? (mp_uint_t)(gc.alloc_bytes * 1000 / gc.elapsed_ms) : 0));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_elapsed_ms), mp_obj_new_int_from_uint(gc.elapsed_ms));
+    return d;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_sys_stats_obj, basalt_sys_stats);
+
+// basalt.kv: small persistent values (rt_kv_*). Keys are up to 15 chars and
+// values up to BASALT_KV_VALUE_MAX bytes; set/delete stay in RAM until
+// commit(), and commits are coalesced so frequent ones don't wear flash.
+static mp_obj_t basalt_kv_get(size_t n_args, const mp_obj_t *args) {
+    uint8_t buf[BASALT_KV_VALUE_MAX];
+    size_t len = sizeof(buf);
+    int rc = rt_kv_get(mp_obj_str_get_str(args[0]), buf, &len);
+    if (rc == RUNTIME_ENOENT) return n_args > 1 ? args[1] : mp_const_none;
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_obj_new_bytes(buf, len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_kv_get_obj, 1, 2, basalt_kv_get);
+
+static mp_obj_t basalt_kv_set(mp_obj_t key_obj, mp_obj_t value_obj) {
+    mp_buffer_info_t value;
+    mp_get_buffer_raise(value_obj, &value, MP_BUFFER_READ);
+    int rc = rt_kv_set(mp_obj_str_get_str(key_obj), value.buf, value.len);
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_kv_set_obj, basalt_kv_set);
+
+static mp_obj_t basalt_kv_delete(mp_obj_t key_obj) {
+    int rc = rt_kv_del(mp_obj_str_get_str(key_obj));
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_kv_delete_obj, basalt_kv_delete);
+
+static mp_obj_t basalt_kv_commit(void) {
+    int rc = rt_kv_commit();
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_kv_commit_obj, basalt_kv_commit);
+
+// basalt.kv.stats() -> dict; flash_commits against sets shows the wear saved.
+static mp_obj_t basalt_kv_stats(void) {
+    rt_kv_stats_t st;
+    rt_kv_get_stats(&st);
+    mp_obj_t d = mp_obj_new_dict(9);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_backend),
+        st.backend ? mp_obj_new_str(st.backend, strlen(st.backend)) : mp_const_none);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_sets), mp_obj_new_int_from_uint(st.sets));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_commits), mp_obj_new_int_from_uint(st.commits));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_flash_commits), mp_obj_new_int_from_uint(st.flash_commits));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_flash_ops), mp_obj_new_int_from_uint(st.flash_ops));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_written), mp_obj_new_int_from_uint(st.bytes_written));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_cached), mp_obj_new_int_from_uint(st.cached));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_dirty), mp_obj_new_int_from_uint(st.dirty));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pending), mp_obj_new_bool(st.commit_pending));
+    return d;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_kv_stats_obj, basalt_kv_stats);
+
 static void basalt_led_init(void) {
     gpio_config_t io_conf = {
         .pin_bit_mask = 0,
@@ -58,9 +483,15 @@ static void basalt_led_init(void) {
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
         .intr_type = GPIO_INTR_DISABLE,
     };
-    if (BASALT_LED_R_PIN >= 0) io_conf.pin_bit_mask |= (1ULL << BASALT_LED_R_PIN);
-    if (BASALT_LED_G_PIN >= 0) io_conf.pin_bit_mask |= (1ULL << BASALT_LED_G_PIN);
-    if (BASALT_LED_B_PIN >= 0) io_conf.pin_bit_mask |= (1ULL << BASALT_LED_B_PIN);
+#if BASALT_LED_R_PIN >= 0
+    io_conf.pin_bit_mask |= (1ULL << BASALT_LED_R_PIN);
+#endif
+#if BASALT_LED_G_PIN >= 0
+    io_conf.pin_bit_mask |= (1ULL << BASALT_LED_G_PIN);
+#endif
+#if BASALT_LED_B_PIN >= 0
+    io_conf.pin_bit_mask |= (1ULL << BASALT_LED_B_PIN);
+#endif
     if (io_conf.pin_bit_mask) {
         gpio_config(&io_conf);
     }
@@ -105,200 +536,1277 @@ static mp_obj_t basalt_led_off(void) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(basalt_led_off_obj, basalt_led_off);
 
-// basalt.ui.ready() -> bool
-static mp_obj_t basalt_ui_ready(void) {
-    return mp_obj_new_bool(tft_console_is_ready());
+// ------------------------
+// RTC helper API (DS3231-compatible over I2C)
+// ------------------------
+#if BASALT_ENABLE_RTC
+static uint8_t basalt_rtc_address(void) {
+    long addr = strtol(BASALT_CFG_RTC_ADDRESS, NULL, 0);
+    if (addr <= 0 || addr > 0x7F) {
+        addr = 0x68;
+    }
+    return (uint8_t)addr;
+}
+
+static inline uint8_t bcd_to_dec(uint8_t v) {
+    return (uint8_t)(((v >> 4) * 10) + (v & 0x0F));
+}
+
+static esp_err_t basalt_rtc_i2c_ensure(void) {
+#if !(BASALT_ENABLE_RTC && BASALT_ENABLE_I2C)
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    return basalt_i2c0_ensure(100000);
+#endif
 }
-static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ui_ready_obj, basalt_ui_ready);
 
-// basalt.ui.clear()
-static mp_obj_t basalt_ui_clear(void) {
-    if (tft_console_is_ready()) {
-        tft_console_clear();
+static esp_err_t basalt_rtc_read_regs(uint8_t reg, uint8_t *buf, size_t len) {
+    esp_err_t err = basalt_rtc_i2c_ensure();
+    if (err != ESP_OK) {
+        return err;
     }
-    return mp_const_none;
+    const uint8_t addr = basalt_rtc_address();
+    return i2c_master_write_read_device(I2C_NUM_0, addr, &reg, 1, buf, len, pdMS_TO_TICKS(50));
 }
-static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ui_clear_obj, basalt_ui_clear);
 
-// basalt.ui.text(msg)
-static mp_obj_t basalt_ui_text(mp_obj_t msg_obj) {
-    const char *msg = mp_obj_str_get_str(msg_obj);
-    if (tft_console_is_ready() && msg) {
-        tft_console_write(msg);
-        tft_console_write("\n");
+// basalt.rtc.available()
+static mp_obj_t basalt_rtc_available(void) {
+#if BASALT_ENABLE_RTC && BASALT_ENABLE_I2C
+    uint8_t sec = 0;
+    esp_err_t err = basalt_rtc_read_regs(0x00, &sec, 1);
+    return mp_obj_new_bool(err == ESP_OK);
+#else
+    return mp_const_false;
+#endif
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_rtc_available_obj, basalt_rtc_available);
+
+// basalt.rtc.now() -> (year, month, day, hour, minute, second, weekday)
+static mp_obj_t basalt_rtc_now(void) {
+#if !(BASALT_ENABLE_RTC && BASALT_ENABLE_I2C)
+    mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("rtc unavailable (enable rtc+i2c modules)"));
+#else
+    uint8_t regs[7] = {0};
+    esp_err_t err = basalt_rtc_read_regs(0x00, regs, sizeof(regs));
+    if (err != ESP_OK) {
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("rtc read failed (%d)"), (int)err);
     }
-    return mp_const_none;
+
+    int second = bcd_to_dec(regs[0] & 0x7F);
+    int minute = bcd_to_dec(regs[1] & 0x7F);
+
+    int hour = 0;
+    if (regs[2] & 0x40) {
+        hour = bcd_to_dec(regs[2] & 0x1F);
+        if (regs[2] & 0x20) {
+            hour = (hour % 12) + 12;
+        } else if (hour == 12) {
+            hour = 0;
+        }
+    } else {
+        hour = bcd_to_dec(regs[2] & 0x3F);
+    }
+
+    int weekday = bcd_to_dec(regs[3] & 0x07);
+    int day = bcd_to_dec(regs[4] & 0x3F);
+    int month = bcd_to_dec(regs[5] & 0x1F);
+    int year = 2000 + bcd_to_dec(regs[6]);
+
+    mp_obj_t out[7] = {
+        mp_obj_new_int(year),
+        mp_obj_new_int(month),
+        mp_obj_new_int(day),
+        mp_obj_new_int(hour),
+        mp_obj_new_int(minute),
+        mp_obj_new_int(second),
+        mp_obj_new_int(weekday),
+    };
+    return mp_obj_new_tuple(7, out);
+#endif
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_rtc_now_obj, basalt_rtc_now);
+
+// basalt.rtc.address()
+static mp_obj_t basalt_rtc_address_obj(void) {
+    return mp_obj_new_int((int)basalt_rtc_address());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_rtc_address_fun_obj, basalt_rtc_address_obj);
+#endif // BASALT_ENABLE_RTC
+
+#if BASALT_ENABLE_DISPLAY_SSD1306
+static bool s_ssd_inited = false;
+static int s_ssd_color = 1;
+static uint8_t s_ssd_fb[1024];
+static int s_ssd_text_x = 0;
+static int s_ssd_text_y = 0;
+static uint8_t s_ssd_addr = 0;
+
+static int basalt_ssd_width(void) {
+    int w = BASALT_DISPLAY_SSD1306_WIDTH;
+    if (w < 1) w = 1;
+    if (w > 128) w = 128;
+    return w;
+}
+
+static int basalt_ssd_height(void) {
+    int h = BASALT_DISPLAY_SSD1306_HEIGHT;
+    if (h < 8) h = 8;
+    if (h > 64) h = 64;
+    // page-aligned rows
+    h = (h / 8) * 8;
+    return h;
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(basalt_ui_text_obj, basalt_ui_text);
 
-// basalt.ui.text_at(x, y, msg)
-static mp_obj_t basalt_ui_text_at(mp_obj_t x_obj, mp_obj_t y_obj, mp_obj_t msg_obj) {
-    int x = mp_obj_get_int(x_obj);
-    int y = mp_obj_get_int(y_obj);
-    const char *msg = mp_obj_str_get_str(msg_obj);
-    if (tft_console_is_ready() && msg) {
-        tft_console_write_at(x, y, msg);
+static int basalt_ssd_fb_bytes(void) {
+    return (basalt_ssd_width() * basalt_ssd_height()) / 8;
+}
+
+static uint8_t basalt_ssd_address_configured(void) {
+    long addr = strtol(BASALT_DISPLAY_SSD1306_ADDRESS, NULL, 0);
+    if (addr <= 0 || addr > 0x7F) {
+        addr = 0x3C;
     }
-    return mp_const_none;
+    return (uint8_t)addr;
+}
+
+static uint8_t basalt_ssd_address(void) {
+    return s_ssd_addr ? s_ssd_addr : basalt_ssd_address_configured();
+}
+
+static esp_err_t basalt_i2c_probe_addr(uint8_t addr) {
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    if (!cmd) return ESP_ERR_NO_MEM;
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (uint8_t)((addr << 1) | I2C_MASTER_WRITE), true);
+    i2c_master_stop(cmd);
+    esp_err_t err = i2c_master_cmd_begin(I2C_NUM_0, cmd, pdMS_TO_TICKS(40));
+    i2c_cmd_link_delete(cmd);
+    return err;
+}
+
+static void basalt_i2c_log_scan(void) {
+    char line[160];
+    size_t off = 0;
+    off += (size_t)snprintf(line + off, sizeof(line) - off, "ssd1306: i2c scan:");
+    bool found = false;
+    for (int a = 0x08; a <= 0x77; ++a) {
+        if (basalt_i2c_probe_addr((uint8_t)a) == ESP_OK) {
+            found = true;
+            if (off < sizeof(line) - 6) {
+                off += (size_t)snprintf(line + off, sizeof(line) - off, " 0x%02X", a);
+            }
+        }
+    }
+    if (!found) {
+        ESP_LOGW(TAG, "ssd1306: i2c scan found no devices");
+    } else {
+        ESP_LOGW(TAG, "%s", line);
+    }
+}
+
+static esp_err_t basalt_ssd_i2c_ensure(void) {
+#if !BASALT_ENABLE_I2C
+    ESP_LOGW(TAG, "ssd1306: I2C disabled at build time");
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    int hz = BASALT_DISPLAY_SSD1306_I2C_HZ;
+    if (hz < 100000) hz = 100000;
+    if (hz > 400000) hz = 400000;
+    esp_err_t err = basalt_i2c0_ensure(hz);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "ssd1306: I2C ensure failed (%s)", esp_err_to_name(err));
+    }
+    return err;
+#endif
+}
+
+static esp_err_t basalt_ssd_write_cmds(const uint8_t *cmds, size_t len) {
+    if (!cmds || len == 0) return ESP_OK;
+    uint8_t buf[17];
+    size_t off = 0;
+    while (off < len) {
+        size_t n = len - off;
+        if (n > 16) n = 16;
+        buf[0] = 0x00;
+        memcpy(&buf[1], &cmds[off], n);
+        esp_err_t err = i2c_master_write_to_device(I2C_NUM_0, basalt_ssd_address(), buf, n + 1, pdMS_TO_TICKS(50));
+        if (err != ESP_OK) return err;
+        off += n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t basalt_ssd_write_data(const uint8_t *data, size_t len) {
+    if (!data || len == 0) return ESP_OK;
+    uint8_t buf[17];
+    size_t off = 0;
+    while (off < len) {
+        size_t n = len - off;
+        if (n > 16) n = 16;
+        buf[0] = 0x40;
+        memcpy(&buf[1], &data[off], n);
+        esp_err_t err = i2c_master_write_to_device(I2C_NUM_0, basalt_ssd_address(), buf, n + 1, pdMS_TO_TICKS(50));
+        if (err != ESP_OK) return err;
+        off += n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t basalt_ssd_init(void) {
+    if (s_ssd_inited) return ESP_OK;
+    esp_err_t err = basalt_ssd_i2c_ensure();
+    if (err != ESP_OK) return err;
+
+    const uint8_t preferred = basalt_ssd_address_configured();
+    const uint8_t alt = (preferred == 0x3C) ? 0x3D : 0x3C;
+    if (basalt_i2c_probe_addr(preferred) == ESP_OK) {
+        s_ssd_addr = preferred;
+    } else if (basalt_i2c_probe_addr(alt) == ESP_OK) {
+        s_ssd_addr = alt;
+        ESP_LOGW(TAG, "ssd1306: configured addr 0x%02X not responding, using 0x%02X",
+            preferred, alt);
+    } else {
+        s_ssd_addr = preferred;
+        ESP_LOGW(TAG, "ssd1306: no device ACK at 0x%02X or 0x%02X", preferred, alt);
+        basalt_i2c_log_scan();
+    }
+
+    const int h = basalt_ssd_height();
+    const uint8_t com_pins = (h > 32) ? 0x12 : 0x02;
+    const uint8_t seq[] = {
+        0xAE, // display off
+        0x20, 0x00, // horizontal addressing mode
+        0x40, // display start line
+        0xA1, // segment remap
+        0xC8, // COM scan dec
+        0x81, 0x8F, // contrast
+        0xA8, (uint8_t)(h - 1), // multiplex ratio
+        0xD3, 0x00, // display offset
+        0xDA, com_pins, // COM pins
+        0xD5, 0x80, // display clock
+        0xD9, 0xF1, // pre-charge
+        0xDB, 0x40, // VCOM detect
+        0x8D, 0x14, // charge pump on
+        0xA4, // display follows RAM
+        0xA6, // normal display
+        0x2E, // deactivate scroll
+        0xAF, // display on
+    };
+    err = basalt_ssd_write_cmds(seq, sizeof(seq));
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "ssd1306: init command sequence failed addr=0x%02X (%s)",
+            basalt_ssd_address(), esp_err_to_name(err));
+        return err;
+    }
+
+    memset(s_ssd_fb, 0, sizeof(s_ssd_fb));
+    s_ssd_inited = true;
+    ESP_LOGI(TAG, "ssd1306: init OK addr=0x%02X %dx%d",
+        basalt_ssd_address(), basalt_ssd_width(), basalt_ssd_height());
+    return ESP_OK;
+}
+
+static void basalt_ssd_put_pixel(int x, int y, int color) {
+    const int w = basalt_ssd_width();
+    const int h = basalt_ssd_height();
+    if (x < 0 || y < 0 || x >= w || y >= h) return;
+    const int idx = x + (y / 8) * w;
+    const uint8_t bit = (uint8_t)(1u << (y & 7));
+    if (color) s_ssd_fb[idx] |= bit;
+    else s_ssd_fb[idx] &= (uint8_t)~bit;
+}
+
+static void basalt_ssd_hline(int x, int y, int len, int color) {
+    if (len <= 0) return;
+    for (int i = 0; i < len; ++i) basalt_ssd_put_pixel(x + i, y, color);
+}
+
+static void basalt_ssd_vline(int x, int y, int len, int color) {
+    if (len <= 0) return;
+    for (int i = 0; i < len; ++i) basalt_ssd_put_pixel(x, y + i, color);
+}
+
+static const uint8_t *basalt_ssd_debug_glyph(char ch) {
+    // 5x7 debug glyph rows (bit4..bit0 are pixels left..right).
+    static const uint8_t g_space[7] = {0,0,0,0,0,0,0};
+    static const uint8_t g_dash[7]  = {0,0,0,31,0,0,0};
+    static const uint8_t g_dot[7]   = {0,0,0,0,0,12,12};
+    static const uint8_t g_colon[7] = {0,12,12,0,12,12,0};
+    static const uint8_t g_slash[7] = {1,2,4,8,16,0,0};
+    static const uint8_t g_qmark[7] = {14,17,1,2,4,0,4};
+    static const uint8_t g_box[7]   = {31,17,17,17,17,17,31};
+
+    static const uint8_t g_digits[10][7] = {
+        {14,17,19,21,25,17,14}, // 0
+        {4,12,4,4,4,4,14},      // 1
+        {14,17,1,2,4,8,31},     // 2
+        {30,1,1,14,1,1,30},     // 3
+        {2,6,10,18,31,2,2},     // 4
+        {31,16,16,30,1,1,30},   // 5
+        {14,16,16,30,17,17,14}, // 6
+        {31,1,2,4,8,8,8},       // 7
+        {14,17,17,14,17,17,14}, // 8
+        {14,17,17,15,1,1,14},   // 9
+    };
+
+    static const uint8_t g_upper[26][7] = {
+        {14,17,17,31,17,17,17}, // A
+        {30,17,17,30,17,17,30}, // B
+        {14,17,16,16,16,17,14}, // C
+        {30,17,17,17,17,17,30}, // D
+        {31,16,16,30,16,16,31}, // E
+        {31,16,16,30,16,16,16}, // F
+        {14,17,16,16,19,17,14}, // G
+        {17,17,17,31,17,17,17}, // H
+        {14,4,4,4,4,4,14},      // I
+        {1,1,1,1,17,17,14},     // J
+        {17,18,20,24,20,18,17}, // K
+        {16,16,16,16,16,16,31}, // L
+        {17,27,21,21,17,17,17}, // M
+        {17,25,21,19,17,17,17}, // N
+        {14,17,17,17,17,17,14}, // O
+        {30,17,17,30,16,16,16}, // P
+        {14,17,17,17,21,18,13}, // Q
+        {30,17,17,30,20,18,17}, // R
+        {15,16,16,14,1,1,30},   // S
+        {31,4,4,4,4,4,4},       // T
+        {17,17,17,17,17,17,14}, // U
+        {17,17,17,17,17,10,4},  // V
+        {17,17,17,21,21,21,10}, // W
+        {17,17,10,4,10,17,17},  // X
+        {17,17,10,4,4,4,4},     // Y
+        {31,1,2,4,8,16,31},     // Z
+    };
+
+    if (ch >= 'a' && ch <= 'z') {
+        ch = (char)(ch - 'a' + 'A');
+    }
+    if (ch >= '0' && ch <= '9') {
+        return g_digits[ch - '0'];
+    }
+    if (ch >= 'A' && ch <= 'Z') {
+        return g_upper[ch - 'A'];
+    }
+    switch (ch) {
+        case ' ': return g_space;
+        case '-': return g_dash;
+        case '.': return g_dot;
+        case ':': return g_colon;
+        case '/': return g_slash;
+        case '?': return g_qmark;
+        default: return g_box;
+    }
+}
+
+static void basalt_ssd_draw_char(int x, int y, char ch, int color) {
+    const uint8_t *rows = basalt_ssd_debug_glyph(ch);
+    for (int ry = 0; ry < 7; ++ry) {
+        uint8_t row = rows[ry];
+        for (int rx = 0; rx < 5; ++rx) {
+            if (row & (1u << (4 - rx))) {
+                basalt_ssd_put_pixel(x + rx, y + ry, color);
+            }
+        }
+    }
+}
+
+static mp_obj_t basalt_ssd_ready(void) {
+    return mp_obj_new_bool(basalt_ssd_init() == ESP_OK);
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ssd_ready_obj, basalt_ssd_ready);
+
+static mp_obj_t basalt_ssd_width_obj(void) {
+    return mp_obj_new_int(basalt_ssd_width());
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ssd_width_fun_obj, basalt_ssd_width_obj);
+
+static mp_obj_t basalt_ssd_height_obj(void) {
+    return mp_obj_new_int(basalt_ssd_height());
 }
-static MP_DEFINE_CONST_FUN_OBJ_3(basalt_ui_text_at_obj, basalt_ui_text_at);
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ssd_height_fun_obj, basalt_ssd_height_obj);
 
-// basalt.ui.color(rgb565_int)
-static mp_obj_t basalt_ui_color(mp_obj_t color_obj) {
-    int c = mp_obj_get_int(color_obj);
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    if (tft_console_is_ready()) {
-        tft_console_set_color((uint16_t)c);
+static mp_obj_t basalt_ssd_show(void) {
+    esp_err_t err = basalt_ssd_init();
+    if (err != ESP_OK) {
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("ssd1306 init failed (%d)"), (int)err);
+    }
+    const int w = basalt_ssd_width();
+    const int pages = basalt_ssd_height() / 8;
+    for (int p = 0; p < pages; ++p) {
+        const uint8_t cmds[] = { (uint8_t)(0xB0 + p), 0x00, 0x10 };
+        err = basalt_ssd_write_cmds(cmds, sizeof(cmds));
+        if (err != ESP_OK) {
+            mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("ssd1306 cmd failed (%d)"), (int)err);
+        }
+        err = basalt_ssd_write_data(&s_ssd_fb[p * w], (size_t)w);
+        if (err != ESP_OK) {
+            mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("ssd1306 data failed (%d)"), (int)err);
+        }
     }
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(basalt_ui_color_obj, basalt_ui_color);
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ssd_show_obj, basalt_ssd_show);
+
+static mp_obj_t basalt_ssd_clear(size_t n_args, const mp_obj_t *args) {
+    int color = 0;
+    if (n_args >= 1) color = mp_obj_is_true(args[0]) ? 1 : 0;
+    memset(s_ssd_fb, color ? 0xFF : 0x00, (size_t)basalt_ssd_fb_bytes());
+    s_ssd_text_x = 0;
+    s_ssd_text_y = 0;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_clear_obj, 0, 1, basalt_ssd_clear);
 
-// basalt.ui.pixel(x, y, color)
-static mp_obj_t basalt_ui_pixel(mp_obj_t x_obj, mp_obj_t y_obj, mp_obj_t color_obj) {
-    int x = mp_obj_get_int(x_obj);
-    int y = mp_obj_get_int(y_obj);
-    int c = mp_obj_get_int(color_obj);
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    tft_console_draw_pixel(x, y, (uint16_t)c);
+static mp_obj_t basalt_ssd_color(mp_obj_t color_obj) {
+    s_ssd_color = mp_obj_get_int(color_obj) ? 1 : 0;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_ssd_color_obj, basalt_ssd_color);
+
+static mp_obj_t basalt_ssd_pixel(size_t n_args, const mp_obj_t *args) {
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    int c = (n_args >= 3) ? (mp_obj_get_int(args[2]) ? 1 : 0) : s_ssd_color;
+    basalt_ssd_put_pixel(x, y, c);
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_3(basalt_ui_pixel_obj, basalt_ui_pixel);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_pixel_obj, 2, 3, basalt_ssd_pixel);
 
-// basalt.ui.line(x0, y0, x1, y1, color)
-static mp_obj_t basalt_ui_line(size_t n_args, const mp_obj_t *args) {
-    (void)n_args;
+static mp_obj_t basalt_ssd_line(size_t n_args, const mp_obj_t *args) {
     int x0 = mp_obj_get_int(args[0]);
     int y0 = mp_obj_get_int(args[1]);
     int x1 = mp_obj_get_int(args[2]);
     int y1 = mp_obj_get_int(args[3]);
-    int c = mp_obj_get_int(args[4]);
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    tft_console_draw_line(x0, y0, x1, y1, (uint16_t)c);
+    int c = (n_args >= 5) ? (mp_obj_get_int(args[4]) ? 1 : 0) : s_ssd_color;
+
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    while (true) {
+        basalt_ssd_put_pixel(x0, y0, c);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_line_obj, 5, 5, basalt_ui_line);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_line_obj, 4, 5, basalt_ssd_line);
 
-// basalt.ui.rect(x, y, w, h, color[, fill])
-static mp_obj_t basalt_ui_rect(size_t n_args, const mp_obj_t *args) {
+static mp_obj_t basalt_ssd_rect(size_t n_args, const mp_obj_t *args) {
     int x = mp_obj_get_int(args[0]);
     int y = mp_obj_get_int(args[1]);
     int w = mp_obj_get_int(args[2]);
     int h = mp_obj_get_int(args[3]);
-    int c = mp_obj_get_int(args[4]);
+    int c = (n_args >= 5) ? (mp_obj_get_int(args[4]) ? 1 : 0) : s_ssd_color;
     bool fill = (n_args >= 6) ? mp_obj_is_true(args[5]) : false;
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    tft_console_draw_rect(x, y, w, h, (uint16_t)c, fill);
+    if (w <= 0 || h <= 0) return mp_const_none;
+
+    if (fill) {
+        for (int yy = 0; yy < h; ++yy) {
+            basalt_ssd_hline(x, y + yy, w, c);
+        }
+    } else {
+        basalt_ssd_hline(x, y, w, c);
+        basalt_ssd_hline(x, y + h - 1, w, c);
+        basalt_ssd_vline(x, y, h, c);
+        basalt_ssd_vline(x + w - 1, y, h, c);
+    }
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_rect_obj, 5, 6, basalt_ui_rect);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_rect_obj, 4, 6, basalt_ssd_rect);
 
-// basalt.ui.circle(cx, cy, r, color[, fill])
-static mp_obj_t basalt_ui_circle(size_t n_args, const mp_obj_t *args) {
+static mp_obj_t basalt_ssd_circle(size_t n_args, const mp_obj_t *args) {
     int cx = mp_obj_get_int(args[0]);
     int cy = mp_obj_get_int(args[1]);
     int r = mp_obj_get_int(args[2]);
-    int c = mp_obj_get_int(args[3]);
+    int c = (n_args >= 4) ? (mp_obj_get_int(args[3]) ? 1 : 0) : s_ssd_color;
     bool fill = (n_args >= 5) ? mp_obj_is_true(args[4]) : false;
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    tft_console_draw_circle(cx, cy, r, (uint16_t)c, fill);
+    if (r < 0) return mp_const_none;
+
+    int x = r;
+    int y = 0;
+    int err = 1 - x;
+    while (x >= y) {
+        if (fill) {
+            basalt_ssd_hline(cx - x, cy + y, 2 * x + 1, c);
+            basalt_ssd_hline(cx - x, cy - y, 2 * x + 1, c);
+            basalt_ssd_hline(cx - y, cy + x, 2 * y + 1, c);
+            basalt_ssd_hline(cx - y, cy - x, 2 * y + 1, c);
+        } else {
+            basalt_ssd_put_pixel(cx + x, cy + y, c);
+            basalt_ssd_put_pixel(cx + y, cy + x, c);
+            basalt_ssd_put_pixel(cx - y, cy + x, c);
+            basalt_ssd_put_pixel(cx - x, cy + y, c);
+            basalt_ssd_put_pixel(cx - x, cy - y, c);
+            basalt_ssd_put_pixel(cx - y, cy - x, c);
+            basalt_ssd_put_pixel(cx + y, cy - x, c);
+            basalt_ssd_put_pixel(cx + x, cy - y, c);
+        }
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x + 1);
+        }
+    }
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_circle_obj, 4, 5, basalt_ui_circle);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_circle_obj, 3, 5, basalt_ssd_circle);
 
-// basalt.ui.ellipse(cx, cy, rx, ry, color[, fill])
-static mp_obj_t basalt_ui_ellipse(size_t n_args, const mp_obj_t *args) {
+static mp_obj_t basalt_ssd_ellipse(size_t n_args, const mp_obj_t *args) {
     int cx = mp_obj_get_int(args[0]);
     int cy = mp_obj_get_int(args[1]);
     int rx = mp_obj_get_int(args[2]);
     int ry = mp_obj_get_int(args[3]);
-    int c = mp_obj_get_int(args[4]);
+    int c = (n_args >= 5) ? (mp_obj_get_int(args[4]) ? 1 : 0) : s_ssd_color;
     bool fill = (n_args >= 6) ? mp_obj_is_true(args[5]) : false;
-    if (c < 0) c = 0;
-    if (c > 0xFFFF) c = 0xFFFF;
-    tft_console_draw_ellipse(cx, cy, rx, ry, (uint16_t)c, fill);
+    if (rx < 0 || ry < 0) return mp_const_none;
+
+    long rx2 = (long)rx * rx;
+    long ry2 = (long)ry * ry;
+    long tworx2 = 2 * rx2;
+    long twory2 = 2 * ry2;
+    long x = 0;
+    long y = ry;
+    long px = 0;
+    long py = tworx2 * y;
+    long p = ry2 - (rx2 * ry) + (rx2 / 4);
+
+    while (px < py) {
+        if (fill) {
+            basalt_ssd_hline(cx - (int)x, cy + (int)y, (int)(2 * x + 1), c);
+            basalt_ssd_hline(cx - (int)x, cy - (int)y, (int)(2 * x + 1), c);
+        } else {
+            basalt_ssd_put_pixel(cx + (int)x, cy + (int)y, c);
+            basalt_ssd_put_pixel(cx - (int)x, cy + (int)y, c);
+            basalt_ssd_put_pixel(cx + (int)x, cy - (int)y, c);
+            basalt_ssd_put_pixel(cx - (int)x, cy - (int)y, c);
+        }
+        x++;
+        px += twory2;
+        if (p < 0) {
+            p += ry2 + px;
+        } else {
+            y--;
+            py -= tworx2;
+            p += ry2 + px - py;
+        }
+    }
+
+    p = ry2 * (x * x + x) + rx2 * (y - 1) * (y - 1) - rx2 * ry2 + (rx2 / 4);
+    while (y >= 0) {
+        if (fill) {
+            basalt_ssd_hline(cx - (int)x, cy + (int)y, (int)(2 * x + 1), c);
+            basalt_ssd_hline(cx - (int)x, cy - (int)y, (int)(2 * x + 1), c);
+        } else {
+            basalt_ssd_put_pixel(cx + (int)x, cy + (int)y, c);
+            basalt_ssd_put_pixel(cx - (int)x, cy + (int)y, c);
+            basalt_ssd_put_pixel(cx + (int)x, cy - (int)y, c);
+            basalt_ssd_put_pixel(cx - (int)x, cy - (int)y, c);
+        }
+        y--;
+        py -= tworx2;
+        if (p > 0) {
+            p += rx2 - py;
+        } else {
+            x++;
+            px += twory2;
+            p += rx2 - py + px;
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_ellipse_obj, 4, 6, basalt_ssd_ellipse);
+
+static mp_obj_t basalt_ssd_text_at(size_t n_args, const mp_obj_t *args) {
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    size_t slen = 0;
+    const char *s = mp_obj_str_get_data(args[2], &slen);
+    int color = (n_args >= 4) ? (mp_obj_get_int(args[3]) ? 1 : 0) : s_ssd_color;
+    const int w = basalt_ssd_width();
+    const int h = basalt_ssd_height();
+
+    int cx = x;
+    int cy = y;
+    for (size_t i = 0; i < slen; ++i) {
+        char ch = s[i];
+        if (ch == '\r') continue;
+        if (ch == '\n') {
+            cx = x;
+            cy += 8;
+            if (cy + 7 >= h) break;
+            continue;
+        }
+        if (cx + 5 > w) {
+            cx = x;
+            cy += 8;
+            if (cy + 7 >= h) break;
+        }
+        basalt_ssd_draw_char(cx, cy, ch, color);
+        cx += 6;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_text_at_obj, 3, 4, basalt_ssd_text_at);
+
+static mp_obj_t basalt_ssd_text(size_t n_args, const mp_obj_t *args) {
+    int color = (n_args >= 2) ? (mp_obj_get_int(args[1]) ? 1 : 0) : s_ssd_color;
+    mp_obj_t at_args[4] = {
+        mp_obj_new_int(s_ssd_text_x),
+        mp_obj_new_int(s_ssd_text_y),
+        args[0],
+        mp_obj_new_int(color),
+    };
+    basalt_ssd_text_at(4, at_args);
+
+    size_t slen = 0;
+    const char *s = mp_obj_str_get_data(args[0], &slen);
+    int lines = 1;
+    int last_line_chars = 0;
+    for (size_t i = 0; i < slen; ++i) {
+        if (s[i] == '\n') {
+            lines++;
+            last_line_chars = 0;
+        } else if (s[i] != '\r') {
+            last_line_chars++;
+        }
+    }
+    if (lines > 1) {
+        s_ssd_text_x = 0;
+        s_ssd_text_y += lines * 8;
+    } else {
+        s_ssd_text_x += last_line_chars * 6;
+    }
+    if (s_ssd_text_x + 5 >= basalt_ssd_width()) {
+        s_ssd_text_x = 0;
+        s_ssd_text_y += 8;
+    }
+    if (s_ssd_text_y + 7 >= basalt_ssd_height()) {
+        s_ssd_text_x = 0;
+        s_ssd_text_y = 0;
+    }
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_ellipse_obj, 5, 6, basalt_ui_ellipse);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_text_obj, 1, 2, basalt_ssd_text);
+#endif // BASALT_ENABLE_DISPLAY_SSD1306
+
+// ------------------------
+// basalt.stream: background samplers into caller-owned int16 rings
+// ------------------------
+// An esp_timer per stream wakes one sampler task, which reads the source and
+// writes a frame of int16 values into the app's array('h')/array('H') ring.
+// The VM never runs and nothing is allocated per sample; the app reads the
+// ring by index using count()/head(). Rings stay reachable through a root
+// pointer while a stream runs, and every stream stops when the app ends.
+#define BASALT_STREAM_IMU (BASALT_ENABLE_I2C && BASALT_ENABLE_IMU)
+#define BASALT_STREAM_BME280 (BASALT_ENABLE_I2C && BASALT_ENABLE_BME280)
+#define BASALT_STREAM_ENABLED (BASALT_ENABLE_ADC || BASALT_STREAM_IMU || BASALT_STREAM_BME280)
+
+#if BASALT_STREAM_ENABLED
+#ifndef BASALT_STREAM_MAX_HZ
+#define BASALT_STREAM_MAX_HZ 10000
+#endif
+#ifndef BASALT_STREAM_TASK_PRIO
+#define BASALT_STREAM_TASK_PRIO 10
+#endif
+#define BASALT_STREAM_TASK_STACK 3072
+
+typedef enum {
+    BASALT_STREAM_SRC_ADC = 1,
+    BASALT_STREAM_SRC_IMU,
+    BASALT_STREAM_SRC_BME280,
+} basalt_stream_src_t;
+
+// The sampler writes into a ring it owns (`ring`, outside the GC heap), never
+// into the app's array: an append or extend can move the array's storage at
+// any time. The VM copies new frames across (basalt_stream_sync) whenever the
+// app asks a Stream for its count or head.
+typedef struct {
+    bool active;
+    basalt_stream_src_t src;
+    int16_t *ring;
+    size_t ring_len;       // int16 values, a whole number of frames
+    uint32_t synced;       // frames copied into the app's ring
+    uint8_t channels;      // values per frame
+    esp_timer_handle_t timer;
+    int res;
+    uint32_t pending;      // timer ticks not yet sampled (atomic)
+    uint32_t count;        // frames written (atomic, release)
+    uint32_t dropped;      // ticks that found the sampler still busy
+    uint32_t errors;       // failed source reads
+} basalt_stream_slot_t;
+
+static basalt_stream_slot_t s_streams[BASALT_STREAM_MAX];
+static TaskHandle_t s_stream_task;
+static SemaphoreHandle_t s_stream_lock;
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t basalt_stream_rings[BASALT_STREAM_MAX]);
+
+#if BASALT_STREAM_IMU || BASALT_STREAM_BME280
+static uint8_t basalt_stream_i2c_addr(const char *cfg, uint8_t fallback) {
+    long v = strtol(cfg, NULL, 0);
+    return (v > 0 && v <= 0x7F) ? (uint8_t)v : fallback;
+}
 
-// basalt.ui.touch() -> (pressed, x, y, raw_x, raw_y)
-static mp_obj_t basalt_ui_touch(void) {
-    int pressed = 0;
-    int x = -1;
-    int y = -1;
-    int raw_x = -1;
-    int raw_y = -1;
-    tft_console_touch_read(&pressed, &x, &y, &raw_x, &raw_y);
+static esp_err_t basalt_stream_i2c_write(uint8_t addr, uint8_t reg, uint8_t val) {
+    uint8_t payload[2] = { reg, val };
+    return i2c_master_write_to_device(I2C_NUM_0, addr, payload, sizeof(payload), pdMS_TO_TICKS(20));
+}
+#endif
+
+// Reads one frame; false counts as an error and leaves the ring untouched.
+// Runs on the sampler task, never the VM.
+static bool basalt_stream_read(const basalt_stream_slot_t *st, int16_t *frame) {
+    switch (st->src) {
+#if BASALT_ENABLE_ADC
+        case BASALT_STREAM_SRC_ADC: {
+            int raw = 0;
+            if (hal_adc_read_raw(&s_adc, &raw) != 0) return false;
+            frame[0] = (int16_t)raw;
+            return true;
+        }
+#endif
+#if BASALT_STREAM_IMU
+        case BASALT_STREAM_SRC_IMU: {
+            // MPU6050/MPU6886 ACCEL_XOUT_H..GYRO_ZOUT_L, skipping the temperature.
+            uint8_t reg = 0x3B;
+            uint8_t d[14];
+            uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_IMU_ADDRESS, 0x68);
+            if (i2c_master_write_read_device(I2C_NUM_0, addr, &reg, 1, d, sizeof(d), pdMS_TO_TICKS(10)) != ESP_OK) {
+                return false;
+            }
+            static const uint8_t offs[6] = { 0, 2, 4, 8, 10, 12 };
+            for (int i = 0; i < 6; ++i) {
+                frame[i] = (int16_t)((d[offs[i]] << 8) | d[offs[i] + 1]);
+            }
+            return true;
+        }
+#endif
+#if BASALT_STREAM_BME280
+        case BASALT_STREAM_SRC_BME280: {
+            // Raw, uncompensated: temperature and pressure keep their top 16
+            // of 20 bits, humidity is 16-bit; read them as array('H').
+            uint8_t reg = 0xF7;
+            uint8_t d[8];
+            uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_BME280_I2C_ADDRESS, 0x76);
+            if (i2c_master_write_read_device(I2C_NUM_0, addr, &reg, 1, d, sizeof(d), pdMS_TO_TICKS(10)) != ESP_OK) {
+                return false;
+            }
+            frame[0] = (int16_t)((d[3] << 8) | d[4]);
+            frame[1] = (int16_t)((d[0] << 8) | d[1]);
+            frame[2] = (int16_t)((d[6] << 8) | d[7]);
+            return true;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+static void basalt_stream_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        uint32_t due = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &due, portMAX_DELAY);
+        xSemaphoreTake(s_stream_lock, portMAX_DELAY);
+        for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+            basalt_stream_slot_t *st = &s_streams[i];
+            if (!(due & (1U << i)) || !st->active) continue;
+            uint32_t ticks = __atomic_exchange_n(&st->pending, 0, __ATOMIC_ACQ_REL);
+            if (ticks > 1) st->dropped += ticks - 1;
+            int16_t frame[6];
+            if (!basalt_stream_read(st, frame)) {
+                st->errors++;
+                continue;
+            }
+            uint32_t n = st->count;
+            int16_t *dst = st->ring + ((size_t)n * st->channels) % st->ring_len;
+            memcpy(dst, frame, st->channels * sizeof(int16_t));
+            __atomic_store_n(&st->count, n + 1, __ATOMIC_RELEASE);
+        }
+        xSemaphoreGive(s_stream_lock);
+    }
+}
+
+static void basalt_stream_tick(void *arg) {
+    basalt_stream_slot_t *st = (basalt_stream_slot_t *)arg;
+    __atomic_fetch_add(&st->pending, 1, __ATOMIC_RELAXED);
+    xTaskNotify(s_stream_task, 1U << (st - s_streams), eSetBits);
+}
 
-    mp_obj_t items[5];
-    items[0] = mp_obj_new_int(pressed);
-    items[1] = mp_obj_new_int(x);
-    items[2] = mp_obj_new_int(y);
-    items[3] = mp_obj_new_int(raw_x);
-    items[4] = mp_obj_new_int(raw_y);
-    return mp_obj_new_tuple(5, items);
+// Stops the sampler for a slot; once this returns the ring is no longer written.
+static void basalt_stream_stop_slot(basalt_stream_slot_t *st) {
+    if (!st->active) return;
+    esp_timer_stop(st->timer);
+    esp_timer_delete(st->timer);
+    st->timer = NULL;
+    xSemaphoreTake(s_stream_lock, portMAX_DELAY);
+    st->active = false;
+    xSemaphoreGive(s_stream_lock);
+    free(st->ring);
+    st->ring = NULL;
+#if BASALT_ENABLE_ADC
+    if (st->src == BASALT_STREAM_SRC_ADC) {
+        s_adc_streams--;
+    }
+#endif
+    MP_STATE_VM(basalt_stream_rings)[st - s_streams] = MP_OBJ_NULL;
+}
+
+static void basalt_stream_release(void *handle) {
+    basalt_stream_slot_t *st = (basalt_stream_slot_t *)handle;
+    st->res = -1;
+    basalt_stream_stop_slot(st);
+}
+
+static void basalt_stream_stop_all(void) {
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        basalt_stream_slot_t *st = &s_streams[i];
+        if (st->active) {
+            if (st->res >= 0) basalt_res_untrack(st->res);
+            st->res = -1;
+            basalt_stream_stop_slot(st);
+        }
+        MP_STATE_VM(basalt_stream_rings)[i] = MP_OBJ_NULL;
+    }
+}
+
+#if BASALT_ENABLE_ADC
+static void basalt_stream_stop_adc(void) {
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        basalt_stream_slot_t *st = &s_streams[i];
+        if (st->active && st->src == BASALT_STREAM_SRC_ADC) {
+            if (st->res >= 0) basalt_res_untrack(st->res);
+            st->res = -1;
+            basalt_stream_stop_slot(st);
+        }
+    }
 }
-static MP_DEFINE_CONST_FUN_OBJ_0(basalt_ui_touch_obj, basalt_ui_touch);
+#endif
+
+// Copies the frames written since the last call into the app's ring. Runs on
+// the VM, so the array can't move underneath; if the app resized it, the
+// stream is stopped rather than guessing where the frames go.
+static void basalt_stream_sync(basalt_stream_slot_t *st) {
+    if (!st->active) return;
+    uint32_t n = __atomic_load_n(&st->count, __ATOMIC_ACQUIRE);
+    if (n == st->synced) return;
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(MP_STATE_VM(basalt_stream_rings)[st - s_streams], &info, MP_BUFFER_WRITE);
+    size_t len = info.len / 2;
+    if (len - len % st->channels != st->ring_len) {
+        if (st->res >= 0) basalt_res_untrack(st->res);
+        st->res = -1;
+        basalt_stream_stop_slot(st);
+        mp_raise_ValueError(MP_ERROR_TEXT("ring resized"));
+    }
+    size_t frames = st->ring_len / st->channels;
+    uint32_t from = n - st->synced > frames ? n - (uint32_t)frames : st->synced;
+    int16_t *dst = (int16_t *)info.buf;
+    for (; from != n; ++from) {
+        size_t at = ((size_t)from * st->channels) % st->ring_len;
+        memcpy(dst + at, st->ring + at, st->channels * sizeof(int16_t));
+    }
+    st->synced = n;
+}
+
+typedef struct _basalt_stream_obj_t {
+    mp_obj_base_t base;
+    basalt_stream_slot_t *slot;
+    uint32_t gen;  // slot generation, so a stale object can't touch a reused slot
+} basalt_stream_obj_t;
+
+static uint32_t s_stream_gen[BASALT_STREAM_MAX];
+extern const mp_obj_type_t basalt_stream_type;
+
+static basalt_stream_slot_t *basalt_stream_slot(mp_obj_t self_in) {
+    basalt_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t i = (size_t)(self->slot - s_streams);
+    if (s_stream_gen[i] != self->gen) {
+        mp_raise_ValueError(MP_ERROR_TEXT("stream closed"));
+    }
+    return self->slot;
+}
+
+static mp_obj_t basalt_stream_start(basalt_stream_src_t src, uint8_t channels, mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(ring_obj, &info, MP_BUFFER_WRITE);
+    if ((info.typecode != 'h' && info.typecode != 'H') || ((uintptr_t)info.buf & 1U) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ring must be array('h') or array('H')"));
+    }
+    size_t len = info.len / 2;
+    len -= len % channels;
+    if (len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ring too small"));
+    }
+    mp_int_t hz = mp_obj_get_int(hz_obj);
+    if (hz < 1 || hz > BASALT_STREAM_MAX_HZ) {
+        mp_raise_ValueError(MP_ERROR_TEXT("rate out of range"));
+    }
+
+    int slot = -1;
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        if (!s_streams[i].active) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    if (!s_stream_lock) {
+        s_stream_lock = xSemaphoreCreateMutex();
+    }
+    if (!s_stream_task && xTaskCreate(basalt_stream_task, "basalt_stream", BASALT_STREAM_TASK_STACK, NULL,
+                                      BASALT_STREAM_TASK_PRIO, &s_stream_task) != pdPASS) {
+        s_stream_task = NULL;
+        mp_raise_OSError(MP_ENOMEM);
+    }
+
+    basalt_stream_obj_t *o = mp_obj_malloc(basalt_stream_obj_t, &basalt_stream_type);
+    basalt_stream_slot_t *st = &s_streams[slot];
+    memset(st, 0, sizeof(*st));
+    st->src = src;
+    st->ring = malloc(len * sizeof(int16_t));
+    if (!st->ring) {
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    st->ring_len = len;
+    st->channels = channels;
+    st->res = -1;
+    const esp_timer_create_args_t args = {
+        .callback = basalt_stream_tick,
+        .arg = st,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "basalt_stream",
+    };
+    if (esp_timer_create(&args, &st->timer) != ESP_OK) {
+        free(st->ring);
+        st->ring = NULL;
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    MP_STATE_VM(basalt_stream_rings)[slot] = ring_obj;
+    st->active = true;
+    // An untracked stream would outlive the app, so a full resource table
+    // fails the start.
+    st->res = basalt_res_track(basalt_stream_release, st);
+    if (st->res < 0) {
+        basalt_stream_stop_slot(st);
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    esp_timer_start_periodic(st->timer, 1000000ULL / (uint64_t)hz);
+
+    o->slot = st;
+    o->gen = ++s_stream_gen[slot];
+    return MP_OBJ_FROM_PTR(o);
+}
+
+#if BASALT_ENABLE_ADC
+// basalt.stream.adc(pin, ring, hz): one raw 12-bit sample per frame.
+static mp_obj_t basalt_stream_adc(mp_obj_t pin_obj, mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    basalt_adc_ensure(mp_obj_get_int(pin_obj));
+    mp_obj_t o = basalt_stream_start(BASALT_STREAM_SRC_ADC, 1, ring_obj, hz_obj);
+    s_adc_streams++;
+    return o;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(basalt_stream_adc_obj, basalt_stream_adc);
+#endif
+
+#if BASALT_STREAM_IMU
+// basalt.stream.imu(ring, hz): frames of ax, ay, az, gx, gy, gz (raw, +/-2 g).
+static mp_obj_t basalt_stream_imu(mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    esp_err_t err = basalt_i2c0_ensure(400000);
+    uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_IMU_ADDRESS, 0x68);
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0x6B, 0x00);  // PWR_MGMT_1: wake
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0x1C, 0x00);  // ACCEL_CONFIG: +/-2 g
+    if (err != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return basalt_stream_start(BASALT_STREAM_SRC_IMU, 6, ring_obj, hz_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_stream_imu_obj, basalt_stream_imu);
+#endif
+
+#if BASALT_STREAM_BME280
+// basalt.stream.bme280(ring, hz): frames of raw temperature, pressure, humidity.
+static mp_obj_t basalt_stream_bme280(mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    esp_err_t err = basalt_i2c0_ensure(400000);
+    uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_BME280_I2C_ADDRESS, 0x76);
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0xF2, 0x01);  // ctrl_hum: x1
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0xF4, 0x27);  // ctrl_meas: x1/x1, normal mode
+    if (err != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return basalt_stream_start(BASALT_STREAM_SRC_BME280, 3, ring_obj, hz_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_stream_bme280_obj, basalt_stream_bme280);
+#endif
+
+// Stream.count(): frames copied into the ring so far, after copying any new
+// ones. The newest frame starts at
+// ((count() - 1) * channels) % len(ring).
+static mp_obj_t basalt_stream_count(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    basalt_stream_sync(st);
+    uint32_t n = st->synced;
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(n & MP_SMALL_INT_POSITIVE_MASK));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_count_obj, basalt_stream_count);
+
+// Stream.head(): ring index the next frame will be written to.
+static mp_obj_t basalt_stream_head(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    basalt_stream_sync(st);
+    uint32_t n = st->synced;
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(((size_t)n * st->channels) % st->ring_len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_head_obj, basalt_stream_head);
+
+// Stream.stats() -> (count, dropped, errors)
+static mp_obj_t basalt_stream_stats(mp_obj_t self_in) {
+    const basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    mp_obj_t items[3] = {
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->count & MP_SMALL_INT_POSITIVE_MASK)),
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->dropped & MP_SMALL_INT_POSITIVE_MASK)),
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->errors & MP_SMALL_INT_POSITIVE_MASK)),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_stats_obj, basalt_stream_stats);
+
+static mp_obj_t basalt_stream_stop(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    if (st->active) {
+        basalt_stream_sync(st);
+        if (st->res >= 0) basalt_res_untrack(st->res);
+        st->res = -1;
+        basalt_stream_stop_slot(st);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_stop_fn_obj, basalt_stream_stop);
+
+static const mp_rom_map_elem_t basalt_stream_locals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&basalt_stream_count_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_head),  MP_ROM_PTR(&basalt_stream_head_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&basalt_stream_stats_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_stop),  MP_ROM_PTR(&basalt_stream_stop_fn_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_stream_locals, basalt_stream_locals_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    basalt_stream_type,
+    MP_QSTR_Stream,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &basalt_stream_locals
+);
+#endif // BASALT_STREAM_ENABLED
+
+// Module tables live in flash: registering them costs no heap and no qstr
+// interning at launch, and `import basalt` resolves through the builtin
+// module table instead of a per-run dict.
+static const mp_rom_map_elem_t basalt_gpio_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_gpio) },
+    { MP_ROM_QSTR(MP_QSTR_mode), MP_ROM_PTR(&basalt_gpio_mode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set),  MP_ROM_PTR(&basalt_gpio_set_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_get),  MP_ROM_PTR(&basalt_gpio_get_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_write_seq), MP_ROM_PTR(&basalt_gpio_write_seq_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_gpio_globals, basalt_gpio_globals_table);
+
+static const mp_obj_module_t basalt_gpio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_gpio_globals,
+};
+
+static const mp_rom_map_elem_t basalt_timer_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),   MP_ROM_QSTR(MP_QSTR_basalt_timer) },
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms),   MP_ROM_PTR(&basalt_timer_sleep_ms_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_ticks_us),   MP_ROM_PTR(&basalt_timer_ticks_us_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff), MP_ROM_PTR(&basalt_timer_ticks_diff_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_timer_globals, basalt_timer_globals_table);
+
+static const mp_obj_module_t basalt_timer_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_timer_globals,
+};
+
+static const mp_rom_map_elem_t basalt_events_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_events) },
+    { MP_ROM_QSTR(MP_QSTR_poll),     MP_ROM_PTR(&basalt_events_poll_obj) },
+    { MP_ROM_QSTR(MP_QSTR_post),     MP_ROM_PTR(&basalt_events_post_obj) },
+    { MP_ROM_QSTR(MP_QSTR_KEY),      MP_ROM_INT(RT_EVT_KEY)   },
+    { MP_ROM_QSTR(MP_QSTR_TIMER),    MP_ROM_INT(RT_EVT_TIMER) },
+    { MP_ROM_QSTR(MP_QSTR_USER),     MP_ROM_INT(RT_EVT_USER)  },
+    { MP_ROM_QSTR(MP_QSTR_TOUCH),    MP_ROM_INT(RT_EVT_TOUCH) },
+};
+static MP_DEFINE_CONST_DICT(basalt_events_globals, basalt_events_globals_table);
+
+static const mp_obj_module_t basalt_events_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_events_globals,
+};
+
+static const mp_rom_map_elem_t basalt_sys_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_sys) },
+    { MP_ROM_QSTR(MP_QSTR_stats),    MP_ROM_PTR(&basalt_sys_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_sys_globals, basalt_sys_globals_table);
+
+static const mp_obj_module_t basalt_sys_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_sys_globals,
+};
+
+static const mp_rom_map_elem_t basalt_kv_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_kv) },
+    { MP_ROM_QSTR(MP_QSTR_get),      MP_ROM_PTR(&basalt_kv_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set),      MP_ROM_PTR(&basalt_kv_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delete),   MP_ROM_PTR(&basalt_kv_delete_obj) },
+    { MP_ROM_QSTR(MP_QSTR_commit),   MP_ROM_PTR(&basalt_kv_commit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats),    MP_ROM_PTR(&basalt_kv_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_kv_globals, basalt_kv_globals_table);
+
+static const mp_obj_module_t basalt_kv_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_kv_globals,
+};
+
+static const mp_rom_map_elem_t basalt_led_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_led) },
+    { MP_ROM_QSTR(MP_QSTR_set), MP_ROM_PTR(&basalt_led_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_off), MP_ROM_PTR(&basalt_led_off_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_led_globals, basalt_led_globals_table);
+
+static const mp_obj_module_t basalt_led_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_led_globals,
+};
+
+#if BASALT_ENABLE_ADC
+static const mp_rom_map_elem_t basalt_adc_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),  MP_ROM_QSTR(MP_QSTR_basalt_adc) },
+    { MP_ROM_QSTR(MP_QSTR_read),      MP_ROM_PTR(&basalt_adc_read_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_read_into), MP_ROM_PTR(&basalt_adc_read_into_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_adc_globals, basalt_adc_globals_table);
+
+static const mp_obj_module_t basalt_adc_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_adc_globals,
+};
+#endif
+
+#if BASALT_STREAM_ENABLED
+static const mp_rom_map_elem_t basalt_stream_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_stream) },
+    { MP_ROM_QSTR(MP_QSTR_Stream),   MP_ROM_PTR(&basalt_stream_type)     },
+#if BASALT_ENABLE_ADC
+    { MP_ROM_QSTR(MP_QSTR_adc),      MP_ROM_PTR(&basalt_stream_adc_obj)    },
+#endif
+#if BASALT_STREAM_IMU
+    { MP_ROM_QSTR(MP_QSTR_imu),      MP_ROM_PTR(&basalt_stream_imu_obj)    },
+#endif
+#if BASALT_STREAM_BME280
+    { MP_ROM_QSTR(MP_QSTR_bme280),   MP_ROM_PTR(&basalt_stream_bme280_obj) },
+#endif
+};
+static MP_DEFINE_CONST_DICT(basalt_stream_globals, basalt_stream_globals_table);
+
+static const mp_obj_module_t basalt_stream_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_stream_globals,
+};
+#endif
+
+#if BASALT_ENABLE_RTC
+static const mp_rom_map_elem_t basalt_rtc_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),  MP_ROM_QSTR(MP_QSTR_basalt_rtc) },
+    { MP_ROM_QSTR(MP_QSTR_available), MP_ROM_PTR(&basalt_rtc_available_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_now),       MP_ROM_PTR(&basalt_rtc_now_obj)         },
+    { MP_ROM_QSTR(MP_QSTR_address),   MP_ROM_PTR(&basalt_rtc_address_fun_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_rtc_globals, basalt_rtc_globals_table);
+
+static const mp_obj_module_t basalt_rtc_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_rtc_globals,
+};
+#endif
+
+#if BASALT_ENABLE_DISPLAY_SSD1306
+static const mp_rom_map_elem_t basalt_ssd_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_ssd1306) },
+    { MP_ROM_QSTR(MP_QSTR_ready),   MP_ROM_PTR(&basalt_ssd_ready_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_width),   MP_ROM_PTR(&basalt_ssd_width_fun_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_height),  MP_ROM_PTR(&basalt_ssd_height_fun_obj) },
+    { MP_ROM_QSTR(MP_QSTR_show),    MP_ROM_PTR(&basalt_ssd_show_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_clear),   MP_ROM_PTR(&basalt_ssd_clear_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_color),   MP_ROM_PTR(&basalt_ssd_color_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_pixel),   MP_ROM_PTR(&basalt_ssd_pixel_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_line),    MP_ROM_PTR(&basalt_ssd_line_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_rect),    MP_ROM_PTR(&basalt_ssd_rect_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_circle),  MP_ROM_PTR(&basalt_ssd_circle_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_ellipse), MP_ROM_PTR(&basalt_ssd_ellipse_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_text_at), MP_ROM_PTR(&basalt_ssd_text_at_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_text),    MP_ROM_PTR(&basalt_ssd_text_obj)       },
+};
+static MP_DEFINE_CONST_DICT(basalt_ssd_globals, basalt_ssd_globals_table);
+
+static const mp_obj_module_t basalt_ssd_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_ssd_globals,
+};
+#endif
+
+static const mp_rom_map_elem_t basalt_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt) },
+    { MP_ROM_QSTR(MP_QSTR_gpio),  MP_ROM_PTR(&basalt_gpio_module)  },
+    { MP_ROM_QSTR(MP_QSTR_timer), MP_ROM_PTR(&basalt_timer_module) },
+    { MP_ROM_QSTR(MP_QSTR_events), MP_ROM_PTR(&basalt_events_module) },
+    { MP_ROM_QSTR(MP_QSTR_sys),   MP_ROM_PTR(&basalt_sys_module)   },
+    { MP_ROM_QSTR(MP_QSTR_kv),    MP_ROM_PTR(&basalt_kv_module)    },
+    { MP_ROM_QSTR(MP_QSTR_led),   MP_ROM_PTR(&basalt_led_module)   },
+#if BASALT_ENABLE_ADC
+    { MP_ROM_QSTR(MP_QSTR_adc),   MP_ROM_PTR(&basalt_adc_module)   },
+#endif
+#if BASALT_STREAM_ENABLED
+    { MP_ROM_QSTR(MP_QSTR_stream), MP_ROM_PTR(&basalt_stream_module) },
+#endif
+#if BASALT_ENABLE_RTC
+    { MP_ROM_QSTR(MP_QSTR_rtc),   MP_ROM_PTR(&basalt_rtc_module)   },
+#endif
+#if BASALT_ENABLE_DISPLAY_SSD1306
+    { MP_ROM_QSTR(MP_QSTR_ssd1306), MP_ROM_PTR(&basalt_ssd_module) },
+#endif
+    { MP_ROM_QSTR(MP_QSTR_ui),    MP_ROM_PTR(&basalt_ui_module)    },
+};
+static MP_DEFINE_CONST_DICT(basalt_globals, basalt_globals_table);
+
+const mp_obj_module_t mp_module_basalt = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_basalt, mp_module_basalt);
 
 void basalt_module_init(void) {
-    qstr q_basalt = qstr_from_str("basalt");
-    mp_obj_module_t *mod = mp_obj_new_module(q_basalt);
-
-    mp_obj_module_t *gpio_mod = mp_obj_new_module(qstr_from_str("basalt_gpio"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("mode")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_mode_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("set")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_set_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("get")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_get_obj));
-
-    mp_obj_module_t *timer_mod = mp_obj_new_module(qstr_from_str("basalt_timer"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(timer_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("sleep_ms")),
-        MP_OBJ_FROM_PTR(&basalt_timer_sleep_ms_obj));
-
-    mp_obj_module_t *led_mod = mp_obj_new_module(qstr_from_str("basalt_led"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(led_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("set")),
-        MP_OBJ_FROM_PTR(&basalt_led_set_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(led_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("off")),
-        MP_OBJ_FROM_PTR(&basalt_led_off_obj));
-
-    mp_obj_module_t *ui_mod = mp_obj_new_module(qstr_from_str("basalt_ui"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ready")),
-        MP_OBJ_FROM_PTR(&basalt_ui_ready_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("clear")),
-        MP_OBJ_FROM_PTR(&basalt_ui_clear_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("text")),
-        MP_OBJ_FROM_PTR(&basalt_ui_text_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("text_at")),
-        MP_OBJ_FROM_PTR(&basalt_ui_text_at_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("color")),
-        MP_OBJ_FROM_PTR(&basalt_ui_color_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("pixel")),
-        MP_OBJ_FROM_PTR(&basalt_ui_pixel_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("line")),
-        MP_OBJ_FROM_PTR(&basalt_ui_line_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("rect")),
-        MP_OBJ_FROM_PTR(&basalt_ui_rect_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("circle")),
-        MP_OBJ_FROM_PTR(&basalt_ui_circle_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ellipse")),
-        MP_OBJ_FROM_PTR(&basalt_ui_ellipse_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ui_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("touch")),
-        MP_OBJ_FROM_PTR(&basalt_ui_touch_obj));
-
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("gpio")),
-        MP_OBJ_FROM_PTR(gpio_mod));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("timer")),
-        MP_OBJ_FROM_PTR(timer_mod));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("led")),
-        MP_OBJ_FROM_PTR(led_mod));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ui")),
-        MP_OBJ_FROM_PTR(ui_mod));
-
-    mp_store_global(q_basalt, MP_OBJ_FROM_PTR(mod));
+    // Per-launch state only; the module itself is const.
+    basalt_ui_init();
+#if BASALT_STREAM_ENABLED
+    basalt_stream_stop_all();
+#endif
+    // Drop events queued while no loop was polling (e.g. the previous app's).
+    rt_event_t stale;
+    while (rt_event_poll(&stale, 0) > 0) {
+    }
+
+    // Older scripts use `basalt` without importing it.
+    mp_store_global(MP_QSTR_basalt, MP_OBJ_FROM_PTR(&mp_module_basalt));
 }
@@ -0,0 +1,206 @@
+# Cooperative scheduler for BasaltOS apps. Tasks are `async def` coroutines;
+# when none is runnable the loop blocks in basalt.events.poll() until the next
+# OS event (touch, posted events) or sleep deadline, so an idle app costs no
+# wakeups and a touch reaches the waiting task without a polling interval.
+# Frozen into firmware builds by tools/freeze_mpy.py.
+#
+#   import asyncio
+#   import basalt
+#
+#   async def blink():
+#       while True:
+#           basalt.led.set(0, 0, 40); await asyncio.sleep_ms(250)
+#           basalt.led.off(); await asyncio.sleep_ms(250)
+#
+#   async def main():
+#       asyncio.create_task(blink())
+#       while True:
+#           kind, x, y = await asyncio.touch()
+#           ...
+#
+#   asyncio.run(main())
+
+from basalt import events, timer
+
+# Events that arrive while nobody waits on their type are kept up to this
+# many per type, so a task that is busy between two awaits doesn't miss input.
+_BACKLOG = 8
+
+_cur = None
+_ready = []
+_sleeping = []
+_waiting = {}
+_backlog = {}
+
+
+class CancelledError(BaseException):
+    pass
+
+
+class Task:
+    def __init__(self, coro):
+        self.coro = coro
+        self.done = False
+        self.result = None
+        self.exc = None
+        self.value = None
+        self.joiners = []
+        self.joined = None
+        self.start = 0
+        self.delay = 0
+
+    def __iter__(self):
+        if not self.done:
+            _cur.joined = self
+            self.joiners.append(_cur)
+            yield
+        if self.exc is not None:
+            raise self.exc
+        return self.result
+
+    def cancel(self):
+        if self.done:
+            return False
+        _unpark(self)
+        self.value = CancelledError()
+        _ready.append(self)
+        return True
+
+
+def _unpark(task):
+    if task in _sleeping:
+        _sleeping.remove(task)
+    if task.joined is not None:
+        task.joined.joiners.remove(task)
+        task.joined = None
+    # Drop emptied lists too: run() treats any entry as a task that can wake.
+    for kind in list(_waiting):
+        waiters = _waiting[kind]
+        if task in waiters:
+            waiters.remove(task)
+            if not waiters:
+                del _waiting[kind]
+    if task in _ready:
+        _ready.remove(task)
+
+
+def create_task(coro):
+    task = Task(coro)
+    _ready.append(task)
+    return task
+
+
+def sleep_ms(ms):
+    ms = int(ms)
+    _cur.start = timer.ticks_us()
+    _cur.delay = ms * 1000 if ms > 0 else 0
+    _sleeping.append(_cur)
+    yield
+
+
+def sleep(seconds):
+    return sleep_ms(seconds * 1000)
+
+
+def wait_event(kind):
+    """Next (type, code, a, b) posted with this type."""
+    queued = _backlog.get(kind)
+    if queued:
+        return queued.pop(0)
+    _waiting.setdefault(kind, []).append(_cur)
+    return (yield)
+
+
+def touch():
+    """Next touch as (kind, x, y); kind 1 press, 2 move, 3 release."""
+    ev = yield from wait_event(events.TOUCH)
+    return ev[1], ev[2], ev[3]
+
+
+def gather(*coros):
+    tasks = [c if isinstance(c, Task) else create_task(c) for c in coros]
+    results = []
+    for task in tasks:
+        results.append((yield from task))
+    return results
+
+
+def _step(task):
+    global _cur
+    _cur = task
+    value, task.value = task.value, None
+    try:
+        if isinstance(value, BaseException):
+            task.coro.throw(value)
+        else:
+            task.coro.send(value)
+    except StopIteration as e:
+        task.result = e.value
+        task.done = True
+    except CancelledError as e:
+        task.exc = e
+        task.done = True
+    except Exception as e:
+        task.exc = e
+        task.done = True
+        if not task.joiners:
+            raise
+    finally:
+        _cur = None
+    if task.done:
+        for joiner in task.joiners:
+            joiner.joined = None
+            _ready.append(joiner)
+        task.joiners = []
+
+
+def _dispatch(ev):
+    waiters = _waiting.pop(ev[0], None)
+    if not waiters:
+        queued = _backlog.setdefault(ev[0], [])
+        if len(queued) >= _BACKLOG:
+            queued.pop(0)
+        queued.append(ev)
+        return
+    for task in waiters:
+        task.value = ev
+        _ready.append(task)
+
+
+def run(coro):
+    main = create_task(coro)
+    try:
+        while not main.done:
+            while _ready:
+                _step(_ready.pop(0))
+            if main.done:
+                break
+            # Wake due sleepers; otherwise block until the nearest deadline.
+            timeout = -1
+            now = timer.ticks_us()
+            for task in list(_sleeping):
+                left = task.delay - timer.ticks_diff(now, task.start)
+                if left <= 0:
+                    _sleeping.remove(task)
+                    _ready.append(task)
+                elif timeout < 0 or left < timeout:
+                    timeout = left
+            if _ready:
+                timeout = 0
+            elif timeout < 0 and not _waiting:
+                raise RuntimeError("deadlock: no task can wake")
+            ev = events.poll(-1 if timeout < 0 else (timeout + 999) // 1000)
+            if ev is not None:
+                _dispatch(ev)
+    finally:
+        _reset()
+    if main.exc is not None:
+        raise main.exc
+    return main.result
+
+
+def _reset():
+    _ready.clear()
+    _sleeping.clear()
+    _waiting.clear()
+    _backlog.clear()
@@ -0,0 +1,50 @@
+# Helpers first-party apps otherwise redefine one by one (see flappy_bird.app).
+# Frozen into firmware builds by tools/freeze_mpy.py, so `import basalt_util`
+# costs no heap for code and no parse time.
+
+import basalt
+
+_seed = None
+
+
+def ticks_us():
+    return basalt.timer.ticks_us()
+
+
+def ticks_ms():
+    return basalt.timer.ticks_us() // 1000
+
+
+def ticks_diff(end, start):
+    return basalt.timer.ticks_diff(end, start)
+
+
+def sleep_ms(ms):
+    basalt.timer.sleep_ms(int(ms))
+
+
+def seed(value):
+    global _seed
+    _seed = value & 0xFFFF
+
+
+def randint(a, b):
+    # Full-period 16-bit LCG (multiplier 1 mod 4, odd increment); seeded from
+    # the clock on first use. Low bits of an LCG cycle with short periods, so
+    # the result scales the whole state instead of taking it modulo the span.
+    global _seed
+    if _seed is None:
+        _seed = basalt.timer.ticks_us() & 0xFFFF
+    _seed = (_seed * 25173 + 13849) & 0xFFFF
+    span = b - a + 1
+    if span <= 0:
+        return a
+    return a + ((_seed * span) >> 16)
+
+
+def clamp(value, lo, hi):
+    if value < lo:
+        return lo
+    if value > hi:
+        return hi
+    return value
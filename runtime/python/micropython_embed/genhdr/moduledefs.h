@@ -4,6 +4,14 @@ extern const struct _mp_obj_module_t mp_module___main__;
 #undef MODULE_DEF___MAIN__
 #define MODULE_DEF___MAIN__ { MP_ROM_QSTR(MP_QSTR___main__), MP_ROM_PTR(&mp_module___main__) },
 
+extern const struct _mp_obj_module_t mp_module_array;
+#undef MODULE_DEF_ARRAY
+#define MODULE_DEF_ARRAY { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&mp_module_array) },
+
+extern const struct _mp_obj_module_t mp_module_basalt;
+#undef MODULE_DEF_BASALT
+#define MODULE_DEF_BASALT { MP_ROM_QSTR(MP_QSTR_basalt), MP_ROM_PTR(&mp_module_basalt) },
+
 extern const struct _mp_obj_module_t mp_module_builtins;
 #undef MODULE_DEF_BUILTINS
 #define MODULE_DEF_BUILTINS { MP_ROM_QSTR(MP_QSTR_builtins), MP_ROM_PTR(&mp_module_builtins) },
@@ -18,13 +26,18 @@ extern const struct _mp_obj_module_t mp_module_sys;
 
 
 #define MICROPY_REGISTERED_MODULES \
+    MODULE_DEF_BASALT \
     MODULE_DEF_BUILTINS \
     MODULE_DEF_GC \
     MODULE_DEF_SYS \
     MODULE_DEF___MAIN__ \
 // MICROPY_REGISTERED_MODULES
 
-#define MICROPY_HAVE_REGISTERED_EXTENSIBLE_MODULES  0
+#define MICROPY_REGISTERED_EXTENSIBLE_MODULES \
+    MODULE_DEF_ARRAY \
+// MICROPY_REGISTERED_EXTENSIBLE_MODULES
+
+#define MICROPY_HAVE_REGISTERED_EXTENSIBLE_MODULES  1
 
 extern void mp_module_sys_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
 #define MICROPY_MODULE_DELEGATIONS \
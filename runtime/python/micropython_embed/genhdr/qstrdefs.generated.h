@@ -241,3 +241,122 @@ QDEF0(MP_QSTR_x, 46557, 1, "x")
 QDEF0(MP_QSTR_y, 46556, 1, "y")
 QDEF0(MP_QSTR_w, 46546, 1, "w")
 QDEF0(MP_QSTR_h, 46541, 1, "h")
+// Native/viper emitters (BASALT_MPY_NATIVE builds)
+QDEF0(MP_QSTR_None, 53615, 4, "None")
+QDEF0(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF0(MP_QSTR_native, 2948, 6, "native")
+QDEF0(MP_QSTR_viper, 9053, 5, "viper")
+QDEF0(MP_QSTR_uint, 15843, 4, "uint")
+QDEF0(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF0(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF0(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF0(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF0(MP_QSTR_bcc, 18215, 3, "bcc")
+QDEF0(MP_QSTR_bccz, 11389, 4, "bccz")
+QDEF0(MP_QSTR_bit_branch, 51825, 10, "bit_branch")
+QDEF0(MP_QSTR_call0, 61047, 5, "call0")
+QDEF0(MP_QSTR_l32r, 36698, 4, "l32r")
+QDEF0(MP_QSTR_location, 3992, 8, "location")
+QDEF0(MP_QSTR_target, 14068, 6, "target")
+// Frozen modules and external import (BASALT_MPY_FROZEN builds)
+QDEF0(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF0(MP_QSTR__dot_frozen, 62593, 7, ".frozen")
+// basalt module ROM tables
+QDEF0(MP_QSTR_basalt, 51308, 6, "basalt")
+QDEF0(MP_QSTR_basalt_gpio, 55650, 11, "basalt_gpio")
+QDEF0(MP_QSTR_basalt_timer, 57140, 12, "basalt_timer")
+QDEF0(MP_QSTR_basalt_led, 41758, 10, "basalt_led")
+QDEF0(MP_QSTR_basalt_rtc, 14326, 10, "basalt_rtc")
+QDEF0(MP_QSTR_basalt_ssd1306, 14643, 14, "basalt_ssd1306")
+QDEF0(MP_QSTR_basalt_ui, 6479, 9, "basalt_ui")
+QDEF0(MP_QSTR_gpio, 55380, 4, "gpio")
+QDEF0(MP_QSTR_timer, 65410, 5, "timer")
+QDEF0(MP_QSTR_led, 16488, 3, "led")
+QDEF0(MP_QSTR_rtc, 35136, 3, "rtc")
+QDEF0(MP_QSTR_ssd1306, 39557, 7, "ssd1306")
+QDEF0(MP_QSTR_ui, 28601, 2, "ui")
+QDEF0(MP_QSTR_mode, 49190, 4, "mode")
+QDEF0(MP_QSTR_sleep_ms, 25355, 8, "sleep_ms")
+QDEF0(MP_QSTR_ticks_us, 12634, 8, "ticks_us")
+QDEF0(MP_QSTR_ticks_diff, 57521, 10, "ticks_diff")
+QDEF0(MP_QSTR_off, 23690, 3, "off")
+QDEF0(MP_QSTR_available, 28572, 9, "available")
+QDEF0(MP_QSTR_now, 22451, 3, "now")
+QDEF0(MP_QSTR_address, 21363, 7, "address")
+QDEF0(MP_QSTR_ready, 12526, 5, "ready")
+QDEF0(MP_QSTR_width, 29987, 5, "width")
+QDEF0(MP_QSTR_height, 13306, 6, "height")
+QDEF0(MP_QSTR_color, 1752, 5, "color")
+QDEF0(MP_QSTR_pixel, 61517, 5, "pixel")
+QDEF0(MP_QSTR_line, 7371, 4, "line")
+QDEF0(MP_QSTR_rect, 63973, 4, "rect")
+QDEF0(MP_QSTR_circle, 56759, 6, "circle")
+QDEF0(MP_QSTR_ellipse, 56335, 7, "ellipse")
+QDEF0(MP_QSTR_text_at, 29938, 7, "text_at")
+QDEF0(MP_QSTR_touch, 58752, 5, "touch")
+QDEF0(MP_QSTR_touch_event, 1235, 11, "touch_event")
+QDEF0(MP_QSTR_touch_calibrate, 46744, 15, "touch_calibrate")
+QDEF0(MP_QSTR_blit, 20726, 4, "blit")
+QDEF0(MP_QSTR_blit_indexed, 5558, 12, "blit_indexed")
+QDEF0(MP_QSTR_blit_rle, 46066, 8, "blit_rle")
+QDEF0(MP_QSTR_canvas, 63693, 6, "canvas")
+QDEF0(MP_QSTR_flush, 49505, 5, "flush")
+QDEF0(MP_QSTR_font, 11158, 4, "font")
+QDEF0(MP_QSTR_draw_text, 61831, 9, "draw_text")
+QDEF0(MP_QSTR_text_width, 18721, 10, "text_width")
+QDEF0(MP_QSTR_pixels, 63902, 6, "pixels")
+QDEF0(MP_QSTR_write_seq, 46368, 9, "write_seq")
+QDEF0(MP_QSTR_adc, 12867, 3, "adc")
+QDEF0(MP_QSTR_basalt_adc, 30197, 10, "basalt_adc")
+QDEF0(MP_QSTR_read_into, 45876, 9, "read_into")
+// array module and memoryview
+QDEF0(MP_QSTR_array, 29308, 5, "array")
+QDEF0(MP_QSTR_memoryview, 17513, 10, "memoryview")
+// basalt.stream
+QDEF0(MP_QSTR_stream, 54361, 6, "stream")
+QDEF0(MP_QSTR_basalt_stream, 30959, 13, "basalt_stream")
+QDEF0(MP_QSTR_Stream, 55353, 6, "Stream")
+QDEF0(MP_QSTR_imu, 21300, 3, "imu")
+QDEF0(MP_QSTR_bme280, 60149, 6, "bme280")
+QDEF0(MP_QSTR_head, 24045, 4, "head")
+QDEF0(MP_QSTR_stats, 61636, 5, "stats")
+QDEF0(MP_QSTR_events, 41626, 6, "events")
+QDEF0(MP_QSTR_basalt_events, 36140, 13, "basalt_events")
+QDEF0(MP_QSTR_poll, 55706, 4, "poll")
+QDEF0(MP_QSTR_post, 55357, 4, "post")
+QDEF0(MP_QSTR_KEY, 61714, 3, "KEY")
+QDEF0(MP_QSTR_TIMER, 8098, 5, "TIMER")
+QDEF0(MP_QSTR_USER, 61780, 4, "USER")
+QDEF0(MP_QSTR_TOUCH, 18080, 5, "TOUCH")
+QDEF0(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF0(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF0(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF0(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF0(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF0(MP_QSTR_basalt_sys, 6986, 10, "basalt_sys")
+QDEF0(MP_QSTR_collections, 51424, 11, "collections")
+QDEF0(MP_QSTR_pause_max_us, 2309, 12, "pause_max_us")
+QDEF0(MP_QSTR_pause_avg_us, 61473, 12, "pause_avg_us")
+QDEF0(MP_QSTR_pause_hist, 29390, 10, "pause_hist")
+QDEF0(MP_QSTR_heap_total, 23076, 10, "heap_total")
+QDEF0(MP_QSTR_heap_used, 16641, 9, "heap_used")
+QDEF0(MP_QSTR_heap_peak, 14969, 9, "heap_peak")
+QDEF0(MP_QSTR_heap_max_free, 50297, 13, "heap_max_free")
+QDEF0(MP_QSTR_areas, 39073, 5, "areas")
+QDEF0(MP_QSTR_alloc_kb, 46238, 8, "alloc_kb")
+QDEF0(MP_QSTR_alloc_rate, 53493, 10, "alloc_rate")
+QDEF0(MP_QSTR_elapsed_ms, 7982, 10, "elapsed_ms")
+QDEF0(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF0(MP_QSTR_kv, 28664, 2, "kv")
+QDEF0(MP_QSTR_basalt_kv, 6926, 9, "basalt_kv")
+QDEF0(MP_QSTR_delete, 59292, 6, "delete")
+QDEF0(MP_QSTR_commit, 8628, 6, "commit")
+QDEF0(MP_QSTR_backend, 50305, 7, "backend")
+QDEF0(MP_QSTR_sets, 29812, 4, "sets")
+QDEF0(MP_QSTR_commits, 22599, 7, "commits")
+QDEF0(MP_QSTR_flash_commits, 44392, 13, "flash_commits")
+QDEF0(MP_QSTR_flash_ops, 26342, 9, "flash_ops")
+QDEF0(MP_QSTR_bytes_written, 63076, 13, "bytes_written")
+QDEF0(MP_QSTR_cached, 65197, 6, "cached")
+QDEF0(MP_QSTR_dirty, 51319, 5, "dirty")
+QDEF0(MP_QSTR_pending, 21434, 7, "pending")
@@ -2,3 +2,7 @@
 
 mp_obj_list_t mp_sys_argv_obj;
 mp_obj_t sys_mutable[MP_SYS_MUTABLE_NUM];
+#if (MICROPY_EMIT_INLINE_ASM || MICROPY_ENABLE_NATIVE_CODE) && (MICROPY_PERSISTENT_CODE_TRACK_FUN_DATA || MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA)
+mp_obj_t persistent_code_root_pointers;
+#endif
+mp_obj_t basalt_stream_rings[BASALT_STREAM_MAX];
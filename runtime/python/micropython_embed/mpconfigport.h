@@ -1,14 +1,73 @@
 // Basalt OS MicroPython embed config
+#include <stddef.h>
 #include <port/mpconfigport_common.h>
 
 #define MICROPY_CONFIG_ROM_LEVEL                (MICROPY_CONFIG_ROM_LEVEL_MINIMUM)
 
 #define MICROPY_ENABLE_COMPILER                 (1)
+#define MICROPY_PERSISTENT_CODE_LOAD            (1)
+#define MICROPY_PERSISTENT_CODE_SAVE            (1)
 #define MICROPY_ENABLE_GC                       (1)
 #define MICROPY_PY_GC                           (1)
+
+// The GC heap is a fixed primary area plus areas the port adds at launch or
+// on demand (see mp_embed_heap_alloc in main/mpy_runtime.c). Empty added
+// areas are handed back to the system heap after a collection.
+#define MICROPY_GC_SPLIT_HEAP                   (1)
+#define MICROPY_GC_SPLIT_HEAP_AUTO              (1)
+// Counts allocated blocks between collections; the port's GC telemetry
+// (mp_embed_gc_stats) derives the allocation rate and heap high-water from it.
+#define MICROPY_GC_ALLOC_THRESHOLD              (1)
+#define MP_PLAT_ALLOC_HEAP(size)                mp_embed_heap_alloc(size)
+#define MP_PLAT_FREE_HEAP(ptr)                  mp_embed_heap_free(ptr)
+void *mp_embed_heap_alloc(size_t size);
+void mp_embed_heap_free(void *ptr);
 #define MICROPY_PY_SYS                          (1)
+#define MICROPY_PY_BUILTINS_BYTEARRAY           (1)
+// array('h') and memoryview for basalt.stream rings and the buffer APIs.
+#define MICROPY_PY_ARRAY                        (1)
+#define MICROPY_PY_BUILTINS_MEMORYVIEW          (1)
+// Concurrent basalt.stream samplers; their rings are GC roots while running.
+#ifndef BASALT_STREAM_MAX
+#define BASALT_STREAM_MAX                       (4)
+#endif
+// async/await for the asyncio module (runtime/python/lib/asyncio.py).
+#define MICROPY_PY_ASYNC_AWAIT                  (1)
+// Cooperative stop: KeyboardInterrupt first, then an uncatchable VM abort.
+#define MICROPY_KBD_EXCEPTION                   (1)
+#define MICROPY_ENABLE_VM_ABORT                 (1)
 #define MICROPY_PY_USR_C_MODULES                (1)
 
+// Native/viper code emitters, enabled with idf.py -DBASALT_MPY_NATIVE_EMIT=ON.
+// Xtensa cores use the windowed-ABI emitter, RISC-V cores the RV32 one. Code
+// is emitted into the GC heap, then copied to executable RAM by
+// mp_embed_native_commit; a soft reset frees it.
+#if BASALT_MPY_NATIVE
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ARCH_RISCV
+#define MICROPY_EMIT_RV32                       (1)
+#elif CONFIG_IDF_TARGET_ARCH_XTENSA
+#define MICROPY_EMIT_XTENSAWIN                  (1)
+#endif
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc)    mp_embed_native_commit(buf, len, reloc)
+void *mp_embed_native_commit(void *buf, size_t len, void *reloc);
+#define MP_STATE_PORT                           MP_STATE_VM
+#endif
+
+// Frozen modules: library modules and bundled app scripts compiled to ROM
+// bytecode by tools/freeze_mpy.py as a build step, with their qstrs in an
+// extra const pool. CMakeLists.txt sets BASALT_MPY_FROZEN unless the build is
+// configured with -DBASALT_MPY_FROZEN=OFF. `import` searches sys.path ("", ".frozen").
+// The frozen pool must use the firmware's qstr layout, so it is pinned here
+// and tools/freeze_mpy.py reads it. ROM_LEVEL_MINIMUM stores no hashes.
+#define MICROPY_QSTR_BYTES_IN_LEN               (1)
+#define MICROPY_QSTR_BYTES_IN_HASH              (0)
+#if BASALT_MPY_FROZEN
+#define MICROPY_MODULE_FROZEN_MPY               (1)
+#define MICROPY_QSTR_EXTRA_POOL                 mp_qstr_frozen_const_pool
+#define MICROPY_ENABLE_EXTERNAL_IMPORT          (1)
+#endif
+
 #define MICROPY_PY_SYS_PLATFORM                 "BasaltOS-ESP32"
 #define MICROPY_GCREGS_SETJMP                   (1)
 #define MICROPY_NLR_SETJMP                      (1)
@@ -0,0 +1,57 @@
+#include "basalt_res.h"
+
+#include <stdbool.h>
+
+#include "esp_log.h"
+
+#define BASALT_RES_MAX 16
+
+typedef struct {
+    basalt_res_release_t release;
+    void *handle;
+} basalt_res_t;
+
+static const char *TAG = "basalt_res";
+static basalt_res_t s_res[BASALT_RES_MAX];
+
+int basalt_res_track(basalt_res_release_t release, void *handle) {
+    for (int i = 0; i < BASALT_RES_MAX; i++) {
+        if (!s_res[i].release) {
+            s_res[i].release = release;
+            s_res[i].handle = handle;
+            return i;
+        }
+    }
+    ESP_LOGW(TAG, "resource table full; %p is not tracked", handle);
+    return -1;
+}
+
+void basalt_res_untrack(int slot) {
+    if (slot < 0 || slot >= BASALT_RES_MAX) return;
+    s_res[slot].release = NULL;
+    s_res[slot].handle = NULL;
+}
+
+void basalt_res_release_all(void) {
+    size_t released = 0;
+    for (int i = BASALT_RES_MAX - 1; i >= 0; i--) {
+        basalt_res_release_t release = s_res[i].release;
+        void *handle = s_res[i].handle;
+        if (!release) continue;
+        // Clear first: a release callback may untrack its own slot.
+        basalt_res_untrack(i);
+        release(handle);
+        released++;
+    }
+    if (released) {
+        ESP_LOGI(TAG, "released %u app resource(s)", (unsigned)released);
+    }
+}
+
+size_t basalt_res_count(void) {
+    size_t n = 0;
+    for (int i = 0; i < BASALT_RES_MAX; i++) {
+        if (s_res[i].release) n++;
+    }
+    return n;
+}
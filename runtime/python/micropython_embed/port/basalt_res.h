@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stddef.h>
+
+// Per-app resources held outside the GC heap (open files, driver handles,
+// claimed pins). The soft reset only clears the heap, so anything an app
+// opens is tracked here and released when the app ends, however it ends.
+typedef void (*basalt_res_release_t)(void *handle);
+
+// Returns a slot for basalt_res_untrack, or -1 if the table is full (the
+// resource then lives until its owner closes it).
+int basalt_res_track(basalt_res_release_t release, void *handle);
+void basalt_res_untrack(int slot);
+// Releases every tracked resource.
+void basalt_res_release_all(void);
+size_t basalt_res_count(void);
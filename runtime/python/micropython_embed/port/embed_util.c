@@ -24,22 +24,317 @@
  * THE SOFTWARE.
  */
 
+#include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 #include "py/compile.h"
+#include "py/frozenmod.h"
+#include "py/mperrno.h"
 #include "py/gc.h"
 #include "py/persistentcode.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
 #include "shared/runtime/gchelper.h"
 #include "port/micropython_embed.h"
+#include "port/basalt_res.h"
+#include "esp_timer.h"
+#if defined(MP_PLAT_COMMIT_EXEC)
+#include "esp_heap_caps.h"
+#endif
+
+// Upper bound on executable RAM handed to native/viper code per run.
+#ifndef BASALT_MPY_NATIVE_EXEC_KB
+#define BASALT_MPY_NATIVE_EXEC_KB 16
+#endif
+
+static void *embed_gc_heap;
+static size_t embed_gc_heap_size;
+
+// Collection telemetry since the last (re)start. Heap figures are refreshed
+// after each collection so other tasks can read them without a heap walk.
+static uint32_t embed_gc_count;
+static uint32_t embed_gc_last_us;
+static uint32_t embed_gc_max_us;
+static uint64_t embed_gc_total_us;
+static uint32_t embed_gc_hist[MP_EMBED_GC_PAUSE_BUCKETS];
+static uint32_t embed_gc_alloc_blocks;  // collected allocation, in GC blocks
+static size_t embed_gc_used;
+static size_t embed_gc_peak;
+static size_t embed_gc_max_free;
+static int64_t embed_gc_start_us;
+
+#if defined(MP_PLAT_COMMIT_EXEC)
+// Committed native code, newest first. Blocks live outside the GC heap, so
+// they are chained here and all freed together on soft reset.
+typedef struct _mp_embed_exec_t {
+    struct _mp_embed_exec_t *next;
+    uint32_t text[];
+} mp_embed_exec_t;
+
+static mp_embed_exec_t *embed_exec_head;
+static size_t embed_exec_used;
+
+static void mp_embed_exec_free_all(void) {
+    while (embed_exec_head) {
+        mp_embed_exec_t *next = embed_exec_head->next;
+        heap_caps_free(embed_exec_head);
+        embed_exec_head = next;
+    }
+    embed_exec_used = 0;
+}
+#endif
+
+void mp_embed_gc_stats_reset(void) {
+    embed_gc_count = 0;
+    embed_gc_last_us = 0;
+    embed_gc_max_us = 0;
+    embed_gc_total_us = 0;
+    memset(embed_gc_hist, 0, sizeof(embed_gc_hist));
+    embed_gc_alloc_blocks = 0;
+    embed_gc_used = 0;
+    embed_gc_peak = 0;
+    embed_gc_max_free = 0;
+    embed_gc_start_us = esp_timer_get_time();
+    #if MICROPY_GC_ALLOC_THRESHOLD
+    MP_STATE_MEM(gc_alloc_amount) = 0;
+    #endif
+}
 
 // Initialise the runtime.
 void mp_embed_init(void *gc_heap, size_t gc_heap_size, void *stack_top) {
+    embed_gc_heap = gc_heap;
+    embed_gc_heap_size = gc_heap_size;
+    mp_embed_gc_stats_reset();
     mp_stack_set_top(stack_top);
     gc_init(gc_heap, (uint8_t *)gc_heap + gc_heap_size);
     mp_init();
 }
 
+// Restart the VM on the heap it already owns: every heap object, the globals
+// and the loaded-module dict are dropped and mp_init runs again. Modules in
+// ROM survive; anything registered at runtime must be registered again.
+// Areas added on top of the primary one go back to the system heap.
+void mp_embed_soft_reset(void *stack_top) {
+    mp_deinit();
+    // A task killed mid-run leaves its NLR frames behind on a dead stack.
+    MP_STATE_THREAD(nlr_top) = NULL;
+    MP_STATE_THREAD(nlr_jump_callback_top) = NULL;
+    MP_STATE_VM(nlr_abort) = NULL;
+    MP_STATE_VM(vm_abort) = false;
+    mp_state_mem_area_t *area = MP_STATE_MEM(area).next;
+    MP_STATE_MEM(area).next = NULL;
+    while (area) {
+        mp_state_mem_area_t *next = area->next;
+        MP_PLAT_FREE_HEAP(area);
+        area = next;
+    }
+    #if defined(MP_PLAT_COMMIT_EXEC)
+    mp_embed_exec_free_all();
+    #endif
+    mp_embed_gc_stats_reset();
+    mp_stack_set_top(stack_top);
+    gc_init(embed_gc_heap, (uint8_t *)embed_gc_heap + embed_gc_heap_size);
+    mp_init();
+}
+
+// Adds a `size`-byte area from MP_PLAT_ALLOC_HEAP to the GC heap.
+bool mp_embed_add_heap(size_t size) {
+    uint8_t *area = MP_PLAT_ALLOC_HEAP(size);
+    if (!area) {
+        return false;
+    }
+    gc_add(area, area + size);
+    return true;
+}
+
+#if defined(MP_PLAT_COMMIT_EXEC)
+// MP_PLAT_COMMIT_EXEC: the emitters and the .mpy loader build machine code in
+// the GC heap, which isn't executable. Copy it into MALLOC_CAP_EXEC RAM,
+// applying relocations first; instruction RAM only takes 32-bit stores.
+void *mp_embed_native_commit(void *buf, size_t len, void *reloc) {
+    size_t words = (len + 3) / 4;
+    if (embed_exec_used + words * 4 > BASALT_MPY_NATIVE_EXEC_KB * 1024) {
+        m_malloc_fail(len);
+    }
+    mp_embed_exec_t *blk = heap_caps_malloc(sizeof(*blk) + words * 4, MALLOC_CAP_EXEC | MALLOC_CAP_32BIT);
+    if (!blk) {
+        m_malloc_fail(len);
+    }
+    #if MICROPY_PERSISTENT_CODE_LOAD
+    if (reloc) {
+        mp_native_relocate(reloc, buf, (uintptr_t)blk->text);
+    }
+    #endif
+    // GC blocks are 16-byte granular, so the last word never reads past buf.
+    const uint8_t *src = buf;
+    for (size_t i = 0; i < words; i++) {
+        uint32_t w;
+        memcpy(&w, src + i * 4, 4);
+        blk->text[i] = w;
+    }
+    blk->next = embed_exec_head;
+    embed_exec_head = blk;
+    embed_exec_used += words * 4;
+    return blk->text;
+}
+#endif
+
+// Blocks allocated since the last collection (gc_collect_start zeroes it).
+static size_t mp_embed_gc_pending_blocks(void) {
+    #if MICROPY_GC_ALLOC_THRESHOLD
+    return MP_STATE_MEM(gc_alloc_amount);
+    #else
+    return 0;
+    #endif
+}
+
+void mp_embed_gc_stats_peek(mp_embed_gc_stats_t *out) {
+    out->heap_total = 0;
+    out->areas = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area; area = area->next) {
+        out->heap_total += (area->gc_pool_end - area->gc_pool_start);
+        out->areas++;
+    }
+    out->heap_used = embed_gc_used;
+    out->heap_peak = embed_gc_peak;
+    out->heap_max_free = embed_gc_max_free;
+    out->collections = embed_gc_count;
+    out->last_pause_us = embed_gc_last_us;
+    out->max_pause_us = embed_gc_max_us;
+    out->total_pause_us = embed_gc_total_us;
+    memcpy(out->pause_hist, embed_gc_hist, sizeof(out->pause_hist));
+    out->alloc_bytes = (uint64_t)embed_gc_alloc_blocks * MICROPY_BYTES_PER_GC_BLOCK;
+    out->elapsed_ms = (uint32_t)((esp_timer_get_time() - embed_gc_start_us) / 1000);
+}
+
+void mp_embed_gc_stats(mp_embed_gc_stats_t *out) {
+    mp_embed_gc_stats_peek(out);
+    gc_info_t info;
+    gc_info(&info);
+    out->heap_total = info.total;
+    out->heap_used = info.used;
+    out->heap_max_free = info.max_free * MICROPY_BYTES_PER_GC_BLOCK;
+    if (info.used > out->heap_peak) {
+        out->heap_peak = info.used;
+    }
+    out->alloc_bytes += (uint64_t)mp_embed_gc_pending_blocks() * MICROPY_BYTES_PER_GC_BLOCK;
+}
+
+// Asks the running script to stop: KeyboardInterrupt is raised at its next
+// branch (or wait that polls pending events), so finally blocks and context
+// managers run. Safe to call from another task.
+void mp_embed_interrupt(void) {
+    mp_sched_keyboard_interrupt();
+}
+
+// Escalation for scripts that swallow KeyboardInterrupt: unwinds straight to
+// the top-level call without running any handlers.
+void mp_embed_abort(void) {
+    mp_sched_vm_abort();
+}
+
+// Re-point stack scanning at the calling task before running code there.
+void mp_embed_set_stack_top(void *stack_top) {
+    mp_stack_set_top(stack_top);
+}
+
+// stdio-backed mp_reader_t: scripts and .mpy data stream from the filesystem
+// in small chunks instead of being loaded into one contiguous buffer.
+typedef struct _mp_embed_file_reader_t {
+    FILE *fp;
+    int res; // tracked, so a killed load doesn't leak the file
+    uint16_t len;
+    uint16_t pos;
+    byte buf[128];
+} mp_embed_file_reader_t;
+
+static mp_uint_t mp_embed_file_readbyte(void *data) {
+    mp_embed_file_reader_t *rd = data;
+    if (rd->pos >= rd->len) {
+        rd->len = (uint16_t)fread(rd->buf, 1, sizeof(rd->buf), rd->fp);
+        rd->pos = 0;
+        if (rd->len == 0) {
+            return MP_READER_EOF;
+        }
+    }
+    return rd->buf[rd->pos++];
+}
+
+static void mp_embed_file_close(void *data) {
+    mp_embed_file_reader_t *rd = data;
+    basalt_res_untrack(rd->res);
+    fclose(rd->fp);
+    m_del_obj(mp_embed_file_reader_t, rd);
+}
+
+static void mp_embed_file_release(void *fp) {
+    fclose(fp);
+}
+
+// Opens `path` at `offset`; on success the reader owns the file.
+static bool mp_embed_reader_open(mp_reader_t *reader, const char *path, long offset) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return false;
+    }
+    mp_embed_file_reader_t *rd = NULL;
+    if ((offset > 0 && fseek(fp, offset, SEEK_SET) != 0)
+        || (rd = m_new_obj_maybe(mp_embed_file_reader_t)) == NULL) {
+        fclose(fp);
+        return false;
+    }
+    rd->fp = fp;
+    rd->res = basalt_res_track(mp_embed_file_release, fp);
+    rd->len = rd->pos = 0;
+    reader->data = rd;
+    reader->readbyte = mp_embed_file_readbyte;
+    reader->close = mp_embed_file_close;
+    return true;
+}
+
+#if MICROPY_ENABLE_EXTERNAL_IMPORT
+// Filesystem side of `import`; ".frozen" entries never reach here. Only .py
+// sources load from files (a .mpy would need MICROPY_HAS_FILE_READER).
+mp_import_stat_t mp_import_stat(const char *path) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return MP_IMPORT_STAT_NO_EXIST;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        return MP_IMPORT_STAT_DIR;
+    }
+    size_t n = strlen(path);
+    if (n >= 4 && strcmp(path + n - 4, ".mpy") == 0) {
+        return MP_IMPORT_STAT_NO_EXIST;
+    }
+    return MP_IMPORT_STAT_FILE;
+}
+
+mp_lexer_t *mp_lexer_new_from_file(qstr filename) {
+    mp_reader_t reader;
+    if (!mp_embed_reader_open(&reader, qstr_str(filename), 0)) {
+        mp_raise_OSError(MP_ENOENT);
+    }
+    return mp_lexer_new(filename, reader);
+}
+#endif
+
+// Runs a module body with the VM-abort point set. A KeyboardInterrupt (a stop
+// request) ends the script quietly; other uncaught exceptions are printed.
+static void mp_embed_call_top(mp_obj_t f) {
+    nlr_buf_t nlr;
+    nlr.ret_val = NULL;
+    if (nlr_push(&nlr) == 0) {
+        nlr_set_abort(&nlr);
+        mp_call_function_0(f);
+        nlr_pop();
+    } else if (nlr.ret_val != NULL
+               && !mp_obj_exception_match(MP_OBJ_FROM_PTR(nlr.ret_val), MP_OBJ_FROM_PTR(&mp_type_KeyboardInterrupt))) {
+        mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
+    }
+    nlr_set_abort(NULL);
+}
+
 #if MICROPY_ENABLE_COMPILER
 // Compile and execute the given source script (Python text).
 void mp_embed_exec_str(const char *src) {
@@ -77,19 +372,177 @@ void mp_embed_exec_mpy(const uint8_t *mpy, size_t len) {
         mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
     }
 }
+
+// Execute .mpy data stored in `path` starting at byte `offset`. Returns false,
+// without running anything, if the file is missing or its bytecode can't be
+// loaded (e.g. built for another MPY version); exceptions raised by the module
+// itself are printed and still count as a load.
+bool mp_embed_exec_mpy_file(const char *path, long offset) {
+    mp_module_context_t *ctx = m_new_obj_maybe(mp_module_context_t);
+    mp_reader_t reader;
+    if (!ctx || !mp_embed_reader_open(&reader, path, offset)) {
+        return false;
+    }
+    ctx->module.globals = mp_globals_get();
+
+    mp_obj_t f;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // The reader closes the file on success and on error.
+        mp_compiled_module_t cm;
+        cm.context = ctx;
+        mp_raw_code_load(&reader, &cm);
+        f = mp_make_function_from_proto_fun(cm.rc, ctx, MP_OBJ_NULL);
+        nlr_pop();
+    } else {
+        return false;
+    }
+    mp_embed_call_top(f);
+    return true;
+}
+#endif
+
+#if MICROPY_MODULE_FROZEN_MPY
+extern const mp_embed_frozen_app_t mp_embed_frozen_apps[];
+
+const char *mp_embed_frozen_app(uint32_t src_len, uint32_t src_hash) {
+    for (const mp_embed_frozen_app_t *app = mp_embed_frozen_apps; app->name; ++app) {
+        if (app->src_len == src_len && app->src_hash == src_hash) {
+            return app->name;
+        }
+    }
+    return NULL;
+}
+
+// Run frozen module `name` as the top-level script. Its code objects and
+// qstrs stay in flash; only the module function is allocated.
+bool mp_embed_exec_frozen(const char *name) {
+    void *data;
+    int type;
+    if (mp_find_frozen_module(name, &type, &data) != MP_IMPORT_STAT_FILE || type != MP_FROZEN_MPY) {
+        return false;
+    }
+    const mp_frozen_module_t *frozen = data;
+    mp_obj_t f;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_module_context_t *ctx = m_new_obj(mp_module_context_t);
+        ctx->module.globals = mp_globals_get();
+        ctx->constants = frozen->constants;
+        f = mp_make_function_from_proto_fun(frozen->proto_fun, ctx, MP_OBJ_NULL);
+        nlr_pop();
+    } else {
+        return false;
+    }
+    mp_embed_call_top(f);
+    return true;
+}
+#else
+const char *mp_embed_frozen_app(uint32_t src_len, uint32_t src_hash) {
+    (void)src_len;
+    (void)src_hash;
+    return NULL;
+}
+
+bool mp_embed_exec_frozen(const char *name) {
+    (void)name;
+    return false;
+}
+#endif
+
+#if MICROPY_ENABLE_COMPILER && MICROPY_PERSISTENT_CODE_SAVE
+// Compile the script at `path`, streaming it through the lexer, optionally
+// write the resulting .mpy to `save`, then optionally run it. Returns false if
+// the file can't be opened or doesn't compile; compile errors are printed.
+bool mp_embed_compile_file(const char *path, mp_embed_write_t save, void *save_ctx, bool run) {
+    mp_reader_t reader;
+    if (!mp_embed_reader_open(&reader, path, 0)) {
+        return false;
+    }
+    mp_obj_t f = MP_OBJ_NULL;
+    volatile bool reader_owned = true;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        qstr name = qstr_from_str(path);
+        mp_lexer_t *lex = mp_lexer_new(name, reader);
+        reader_owned = false; // freed along with the lexer
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_module_context_t *ctx = m_new_obj(mp_module_context_t);
+        ctx->module.globals = mp_globals_get();
+        mp_compiled_module_t cm;
+        cm.context = ctx;
+        mp_compile_to_raw_code(&parse_tree, name, false, &cm);
+        if (save) {
+            mp_print_t print = { save_ctx, save };
+            mp_raw_code_save(&cm, &print);
+        }
+        if (run) {
+            f = mp_make_function_from_proto_fun(cm.rc, ctx, MP_OBJ_NULL);
+        }
+        nlr_pop();
+    } else {
+        if (reader_owned) {
+            reader.close(reader.data);
+        }
+        mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
+        return false;
+    }
+    if (f != MP_OBJ_NULL) {
+        mp_embed_call_top(f);
+    }
+    return true;
+}
 #endif
 
 // Deinitialise the runtime.
 void mp_embed_deinit(void) {
     mp_deinit();
+    #if defined(MP_PLAT_COMMIT_EXEC)
+    mp_embed_exec_free_all();
+    #endif
 }
 
 #if MICROPY_ENABLE_GC
 // Run a garbage collection cycle.
 void gc_collect(void) {
+    // Everything allocated since the previous collection is still counted
+    // as used, so this is the high-water mark up to now. Reallocs count
+    // twice, hence the clamp to the heap size.
+    size_t pending = mp_embed_gc_pending_blocks();
+    size_t peak = embed_gc_used + pending * MICROPY_BYTES_PER_GC_BLOCK;
+    size_t total = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area; area = area->next) {
+        total += area->gc_pool_end - area->gc_pool_start;
+    }
+    if (peak > total) {
+        peak = total;
+    }
+    int64_t t0 = esp_timer_get_time();
     gc_collect_start();
     gc_helper_collect_regs_and_stack();
     gc_collect_end();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    embed_gc_count++;
+    embed_gc_last_us = us;
+    embed_gc_total_us += us;
+    if (us > embed_gc_max_us) {
+        embed_gc_max_us = us;
+    }
+    int bucket = 0;
+    while (bucket < MP_EMBED_GC_PAUSE_BUCKETS - 1 && us >= MP_EMBED_GC_PAUSE_BUCKET_US(bucket)) {
+        bucket++;
+    }
+    embed_gc_hist[bucket]++;
+    embed_gc_alloc_blocks += pending;
+    if (peak > embed_gc_peak) {
+        embed_gc_peak = peak;
+    }
+    // Outside the timed pause: one walk of the allocation table for the
+    // figures mp_embed_gc_stats_peek reports between collections.
+    gc_info_t info;
+    gc_info(&info);
+    embed_gc_used = info.used;
+    embed_gc_max_free = info.max_free * MICROPY_BYTES_PER_GC_BLOCK;
 }
 #endif
 
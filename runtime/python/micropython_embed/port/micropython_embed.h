@@ -26,16 +26,72 @@
 #ifndef MICROPY_INCLUDED_MICROPYTHON_EMBED_H
 #define MICROPY_INCLUDED_MICROPYTHON_EMBED_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+// Receives serialized .mpy bytes; same shape as mp_print_strn_t.
+typedef void (*mp_embed_write_t)(void *ctx, const char *data, size_t len);
+
 void mp_embed_init(void *gc_heap, size_t gc_heap_size, void *stack_top);
 void mp_embed_deinit(void);
+void mp_embed_soft_reset(void *stack_top);
+void mp_embed_set_stack_top(void *stack_top);
+bool mp_embed_add_heap(size_t size);
+void mp_embed_interrupt(void);
+void mp_embed_abort(void);
+
+// Collection pause histogram: bucket i counts pauses under
+// MP_EMBED_GC_PAUSE_BUCKET_US(i) (250 us, 1, 4, 16, 64 ms); the last bucket
+// takes the rest.
+#define MP_EMBED_GC_PAUSE_BUCKETS 6
+#define MP_EMBED_GC_PAUSE_BUCKET_US(i) (250u << (2 * (i)))
+
+typedef struct {
+    size_t heap_total;     // bytes across all GC areas
+    size_t heap_used;
+    size_t heap_peak;      // most bytes in use seen, sampled at each collection
+    size_t heap_max_free;  // largest free block
+    size_t areas;
+    uint32_t collections;  // everything below counts since the last (re)start
+    uint32_t last_pause_us;
+    uint32_t max_pause_us;
+    uint64_t total_pause_us;
+    uint32_t pause_hist[MP_EMBED_GC_PAUSE_BUCKETS];
+    uint64_t alloc_bytes;  // allocated, including what was collected since
+    uint32_t elapsed_ms;
+} mp_embed_gc_stats_t;
+
+// Walks the heap for current figures; call from the task running the VM.
+void mp_embed_gc_stats(mp_embed_gc_stats_t *out);
+// Safe from any task while a script runs: heap_used, heap_max_free and
+// alloc_bytes are as of the last collection.
+void mp_embed_gc_stats_peek(mp_embed_gc_stats_t *out);
+// Starts a new accounting window, e.g. per app launch.
+void mp_embed_gc_stats_reset(void);
 
 // Only available if MICROPY_ENABLE_COMPILER is enabled.
 void mp_embed_exec_str(const char *src);
 
 // Only available if MICROPY_PERSISTENT_CODE_LOAD is enabled.
 void mp_embed_exec_mpy(const uint8_t *mpy, size_t len);
+bool mp_embed_exec_mpy_file(const char *path, long offset);
+
+// Only available if MICROPY_ENABLE_COMPILER and MICROPY_PERSISTENT_CODE_SAVE
+// are enabled.
+bool mp_embed_compile_file(const char *path, mp_embed_write_t save, void *save_ctx, bool run);
+
+// Frozen app entry scripts, keyed by the source length and FNV-1a hash that
+// main/mpy_runtime.c computes for its bytecode cache. The table is generated
+// by tools/freeze_mpy.py and ends with a NULL name.
+typedef struct {
+    const char *name;
+    uint32_t src_len;
+    uint32_t src_hash;
+} mp_embed_frozen_app_t;
+
+// Without frozen modules these find nothing.
+const char *mp_embed_frozen_app(uint32_t src_len, uint32_t src_hash);
+bool mp_embed_exec_frozen(const char *name);
 
 #endif // MICROPY_INCLUDED_MICROPYTHON_EMBED_H
@@ -1,16 +1,25 @@
 #include "py/obj.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
+#include "py/binary.h"
+#include "py/mperrno.h"
 
 #include "board_config.h"
+#include "basalt_res.h"
+#include "micropython_embed.h"
 #include "modui.h"
+#include "runtime_api.h"
+#include "rt_kv.h"
 
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 
@@ -20,6 +29,24 @@
 #ifndef BASALT_ENABLE_I2C
 #define BASALT_ENABLE_I2C 0
 #endif
+#ifndef BASALT_ENABLE_ADC
+#define BASALT_ENABLE_ADC 0
+#endif
+#if BASALT_ENABLE_ADC
+#include "hal/hal_adc.h"
+#endif
+#ifndef BASALT_ENABLE_IMU
+#define BASALT_ENABLE_IMU 0
+#endif
+#ifndef BASALT_ENABLE_BME280
+#define BASALT_ENABLE_BME280 0
+#endif
+#ifndef BASALT_CFG_IMU_ADDRESS
+#define BASALT_CFG_IMU_ADDRESS "0x68"
+#endif
+#ifndef BASALT_CFG_BME280_I2C_ADDRESS
+#define BASALT_CFG_BME280_I2C_ADDRESS "0x76"
+#endif
 #ifndef BASALT_PIN_I2C_SDA
 #define BASALT_PIN_I2C_SDA -1
 #endif
@@ -100,10 +127,32 @@ static esp_err_t basalt_i2c0_ensure(int speed_hz) {
 }
 #endif
 
+// Pins an app drove as outputs; reset to their default state at app exit so
+// a stopped app doesn't leave anything switched on.
+static uint64_t s_gpio_claimed;
+static int s_gpio_res = -1;
+
+static void basalt_gpio_release(void *handle) {
+    (void)handle;
+    for (int pin = 0; pin < 64; pin++) {
+        if (s_gpio_claimed & (1ULL << pin)) {
+            gpio_reset_pin(pin);
+        }
+    }
+    s_gpio_claimed = 0;
+    s_gpio_res = -1;
+}
+
 // basalt.gpio.mode(pin, mode) where mode: 0=input, 1=output
 static mp_obj_t basalt_gpio_mode(mp_obj_t pin_obj, mp_obj_t mode_obj) {
     int pin = mp_obj_get_int(pin_obj);
     int mode = mp_obj_get_int(mode_obj);
+    if (mode && pin >= 0 && pin < 64) {
+        if (s_gpio_res < 0) {
+            s_gpio_res = basalt_res_track(basalt_gpio_release, NULL);
+        }
+        s_gpio_claimed |= 1ULL << pin;
+    }
     gpio_config_t io_conf = {
         .pin_bit_mask = (1ULL << pin),
         .mode = (mode ? GPIO_MODE_OUTPUT : GPIO_MODE_INPUT),
@@ -133,15 +182,299 @@ static mp_obj_t basalt_gpio_get(mp_obj_t pin_obj) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(basalt_gpio_get_obj, basalt_gpio_get);
 
-// basalt.timer.sleep_ms(ms)
+// Paced loops for the buffer APIs: wait until `deadline` (esp_timer µs),
+// sleeping through long gaps so the task watchdog and other tasks still run,
+// and let a stop request through every so often.
+#define BASALT_SEQ_PENDING_EVERY 256
+
+static void basalt_seq_wait_until(int64_t deadline) {
+    int64_t left = deadline - esp_timer_get_time();
+    if (left > 2000) {
+        vTaskDelay(pdMS_TO_TICKS((uint32_t)((left - 1000) / 1000)));
+    }
+    while (esp_timer_get_time() < deadline) {
+    }
+}
+
+// basalt.gpio.write_seq(pin, buf, period_us): drive pin to each byte of buf
+// (nonzero = high), one every period_us. Set the pin as an output first.
+static mp_obj_t basalt_gpio_write_seq(mp_obj_t pin_obj, mp_obj_t buf_obj, mp_obj_t period_obj) {
+    int pin = mp_obj_get_int(pin_obj);
+    mp_int_t period = mp_obj_get_int(period_obj);
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(buf_obj, &info, MP_BUFFER_READ);
+    if (period < 0) period = 0;
+    const uint8_t *levels = (const uint8_t *)info.buf;
+    int64_t next = esp_timer_get_time();
+    for (size_t i = 0; i < info.len; ++i) {
+        if (period > 0) {
+            basalt_seq_wait_until(next);
+            next += period;
+        }
+        gpio_set_level(pin, levels[i] ? 1 : 0);
+        if ((i + 1) % BASALT_SEQ_PENDING_EVERY == 0) {
+            mp_handle_pending(true);
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(basalt_gpio_write_seq_obj, basalt_gpio_write_seq);
+
+#if BASALT_ENABLE_ADC
+// One oneshot unit, re-targeted when an app reads a different pin and
+// released at app exit.
+static hal_adc_t s_adc;
+static int s_adc_pin = -1;
+static int s_adc_res = -1;
+static int s_adc_streams;  // basalt.stream samplers pinning the unit to s_adc_pin
+
+static void basalt_stream_stop_adc(void);
+
+// Resources are released newest slot first, but slots are reused, so an ADC
+// stream may still be sampling here; stop it before the unit goes away.
+static void basalt_adc_release(void *handle) {
+    (void)handle;
+    if (s_adc_streams > 0) {
+        basalt_stream_stop_adc();
+    }
+    if (s_adc_pin >= 0) {
+        hal_adc_deinit(&s_adc);
+    }
+    s_adc_pin = -1;
+    s_adc_res = -1;
+}
+
+static void basalt_adc_ensure(int pin) {
+    if (pin == s_adc_pin) return;
+    if (s_adc_streams > 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    if (s_adc_pin >= 0) {
+        hal_adc_deinit(&s_adc);
+        s_adc_pin = -1;
+    }
+    int rc = hal_adc_init_pin(&s_adc, pin, HAL_ADC_ATTEN_DB_11, 12);
+    if (rc != 0) {
+        mp_raise_OSError(rc < 0 ? -rc : rc);
+    }
+    s_adc_pin = pin;
+    if (s_adc_res < 0) {
+        s_adc_res = basalt_res_track(basalt_adc_release, NULL);
+    }
+}
+
+static int basalt_adc_sample(void) {
+    int raw = 0;
+    int rc = hal_adc_read_raw(&s_adc, &raw);
+    if (rc != 0) {
+        mp_raise_OSError(rc < 0 ? -rc : rc);
+    }
+    return raw;
+}
+
+// basalt.adc.read(pin): one raw 12-bit sample.
+static mp_obj_t basalt_adc_read(mp_obj_t pin_obj) {
+    basalt_adc_ensure(mp_obj_get_int(pin_obj));
+    return MP_OBJ_NEW_SMALL_INT(basalt_adc_sample());
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_adc_read_obj, basalt_adc_read);
+
+// basalt.adc.read_into(pin, buf[, period_us]): fill buf (array('H'),
+// array('h'), array('i'), ...) with raw samples, one every period_us;
+// returns the sample count. Nothing is allocated.
+static mp_obj_t basalt_adc_read_into(size_t n_args, const mp_obj_t *args) {
+    int pin = mp_obj_get_int(args[0]);
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(args[1], &info, MP_BUFFER_WRITE);
+    mp_int_t period = (n_args >= 3) ? mp_obj_get_int(args[2]) : 0;
+    if (period < 0) period = 0;
+    if (info.typecode != BYTEARRAY_TYPECODE && (info.typecode == 0 || !strchr("bBhHiIlL", info.typecode))) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer must hold integers"));
+    }
+    size_t item = mp_binary_get_size('@', info.typecode, NULL);
+    size_t count = info.len / item;
+    basalt_adc_ensure(pin);
+    int64_t next = esp_timer_get_time();
+    for (size_t i = 0; i < count; ++i) {
+        if (period > 0) {
+            basalt_seq_wait_until(next);
+            next += period;
+        }
+        mp_binary_set_val_array_from_int(info.typecode, info.buf, i, basalt_adc_sample());
+        if ((i + 1) % BASALT_SEQ_PENDING_EVERY == 0) {
+            mp_handle_pending(true);
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_adc_read_into_obj, 2, 3, basalt_adc_read_into);
+#endif // BASALT_ENABLE_ADC
+
+// basalt.timer.sleep_ms(ms). A stop request notifies the app task, which cuts
+// the sleep short so the pending KeyboardInterrupt is raised right away.
 static mp_obj_t basalt_timer_sleep_ms(mp_obj_t ms_obj) {
     int ms = mp_obj_get_int(ms_obj);
     if (ms < 0) ms = 0;
-    vTaskDelay(pdMS_TO_TICKS(ms));
+    TickType_t start = xTaskGetTickCount();
+    TickType_t total = pdMS_TO_TICKS(ms);
+    for (;;) {
+        TickType_t spent = xTaskGetTickCount() - start;
+        if (spent >= total) break;
+        ulTaskNotifyTake(pdTRUE, total - spent);
+        mp_handle_pending(true);
+    }
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(basalt_timer_sleep_ms_obj, basalt_timer_sleep_ms);
 
+// basalt.timer.ticks_us() -> microsecond counter that wraps at the small-int
+// range; compare two readings with ticks_diff(end, start).
+#define BASALT_TICKS_MASK MP_SMALL_INT_POSITIVE_MASK
+static mp_obj_t basalt_timer_ticks_us(void) {
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(esp_timer_get_time() & BASALT_TICKS_MASK));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_timer_ticks_us_obj, basalt_timer_ticks_us);
+
+static mp_obj_t basalt_timer_ticks_diff(mp_obj_t end_obj, mp_obj_t start_obj) {
+    mp_uint_t diff = ((mp_uint_t)mp_obj_get_int(end_obj) - (mp_uint_t)mp_obj_get_int(start_obj)) & BASALT_TICKS_MASK;
+    // Fold the upper half of the range into negative differences.
+    mp_int_t half = (BASALT_TICKS_MASK >> 1) + 1;
+    return MP_OBJ_NEW_SMALL_INT(((mp_int_t)diff ^ half) - half);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_timer_ticks_diff_obj, basalt_timer_ticks_diff);
+
+// basalt.events.poll([timeout_ms]) -> (type, code, a, b) or None on timeout.
+// The asyncio loop idles here: the VM task sleeps in rt_event_poll until an
+// event is posted, the next timer is due, or a stop request wakes it.
+static mp_obj_t basalt_events_poll(size_t n_args, const mp_obj_t *args) {
+    int timeout = n_args > 0 ? mp_obj_get_int(args[0]) : -1;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t total = timeout > 0 ? pdMS_TO_TICKS(timeout) : 0;
+    // Round sub-tick timeouts up rather than spinning through them.
+    if (timeout > 0 && total == 0) total = 1;
+    rt_event_t ev;
+    for (;;) {
+        uint32_t wait = RT_EVENT_WAIT_FOREVER;
+        if (timeout >= 0) {
+            TickType_t spent = xTaskGetTickCount() - start;
+            wait = spent >= total ? 0 : (uint32_t)((total - spent) * portTICK_PERIOD_MS);
+        }
+        int rc = rt_event_poll(&ev, wait);
+        mp_handle_pending(true);
+        if (rc < 0) mp_raise_OSError(-rc);
+        if (rc > 0) break;
+        if (wait == 0) return mp_const_none;
+    }
+    mp_obj_t items[4] = {
+        MP_OBJ_NEW_SMALL_INT(ev.type),
+        mp_obj_new_int((int32_t)ev.code),
+        mp_obj_new_int((int32_t)ev.a),
+        mp_obj_new_int((int32_t)ev.b),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_poll_obj, 0, 1, basalt_events_poll);
+
+// basalt.events.post(type[, code, a, b]): queue an event for any loop
+// waiting on that type. Never blocks; a full queue drops its oldest entry.
+static mp_obj_t basalt_events_post(size_t n_args, const mp_obj_t *args) {
+    rt_event_t ev = {
+        .type = (rt_event_type_t)mp_obj_get_int(args[0]),
+        .code = n_args > 1 ? (uint32_t)mp_obj_get_int(args[1]) : 0,
+        .a = n_args > 2 ? (uint32_t)mp_obj_get_int(args[2]) : 0,
+        .b = n_args > 3 ? (uint32_t)mp_obj_get_int(args[3]) : 0,
+    };
+    if (ev.type <= RT_EVT_NONE || ev.type >= RT_EVT_TYPE_COUNT) mp_raise_ValueError(MP_ERROR_TEXT("invalid event type"));
+    int rc = rt_event_post(&ev);
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_post_obj, 1, 4, basalt_events_post);
+
+// basalt.sys.stats() -> dict of this app's GC telemetry: collections, pause
+// times (pause_hist buckets: <250 us, <1, <4, <16, <64 ms, the rest), heap
+// size/use/high-water, largest free block, and allocation volume and rate.
+static mp_obj_t basalt_sys_stats(void) {
+    mp_embed_gc_stats_t gc;
+    mp_embed_gc_stats(&gc);
+    mp_obj_t hist[MP_EMBED_GC_PAUSE_BUCKETS];
+    for (int i = 0; i < MP_EMBED_GC_PAUSE_BUCKETS; ++i) {
+        hist[i] = mp_obj_new_int_from_uint(gc.pause_hist[i]);
+    }
+    mp_obj_t d = mp_obj_new_dict(13);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_collections), mp_obj_new_int_from_uint(gc.collections));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_max_us), mp_obj_new_int_from_uint(gc.max_pause_us));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_avg_us),
+        mp_obj_new_int_from_uint(gc.collections ? (mp_uint_t)(gc.total_pause_us / gc.collections) : 0));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pause_hist), mp_obj_new_tuple(MP_EMBED_GC_PAUSE_BUCKETS, hist));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_total), mp_obj_new_int_from_uint(gc.heap_total));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_used), mp_obj_new_int_from_uint(gc.heap_used));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_peak), mp_obj_new_int_from_uint(gc.heap_peak));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_heap_max_free), mp_obj_new_int_from_uint(gc.heap_max_free));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_areas), mp_obj_new_int_from_uint(gc.areas));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_alloc_kb), mp_obj_new_int_from_uint((mp_uint_t)(gc.alloc_bytes / 1024)));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_alloc_rate),
+        mp_obj_new_int_from_uint(gc.elapsed_ms ? (mp_uint_t)(gc.alloc_bytes * 1000 / gc.elapsed_ms) : 0));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_elapsed_ms), mp_obj_new_int_from_uint(gc.elapsed_ms));
+    return d;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_sys_stats_obj, basalt_sys_stats);
+
+// basalt.kv: small persistent values (rt_kv_*). Keys are up to 15 chars and
+// values up to BASALT_KV_VALUE_MAX bytes; set/delete stay in RAM until
+// commit(), and commits are coalesced so frequent ones don't wear flash.
+static mp_obj_t basalt_kv_get(size_t n_args, const mp_obj_t *args) {
+    uint8_t buf[BASALT_KV_VALUE_MAX];
+    size_t len = sizeof(buf);
+    int rc = rt_kv_get(mp_obj_str_get_str(args[0]), buf, &len);
+    if (rc == RUNTIME_ENOENT) return n_args > 1 ? args[1] : mp_const_none;
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_obj_new_bytes(buf, len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_kv_get_obj, 1, 2, basalt_kv_get);
+
+static mp_obj_t basalt_kv_set(mp_obj_t key_obj, mp_obj_t value_obj) {
+    mp_buffer_info_t value;
+    mp_get_buffer_raise(value_obj, &value, MP_BUFFER_READ);
+    int rc = rt_kv_set(mp_obj_str_get_str(key_obj), value.buf, value.len);
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_kv_set_obj, basalt_kv_set);
+
+static mp_obj_t basalt_kv_delete(mp_obj_t key_obj) {
+    int rc = rt_kv_del(mp_obj_str_get_str(key_obj));
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_kv_delete_obj, basalt_kv_delete);
+
+static mp_obj_t basalt_kv_commit(void) {
+    int rc = rt_kv_commit();
+    if (rc < 0) mp_raise_OSError(-rc);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_kv_commit_obj, basalt_kv_commit);
+
+// basalt.kv.stats() -> dict; flash_commits against sets shows the wear saved.
+static mp_obj_t basalt_kv_stats(void) {
+    rt_kv_stats_t st;
+    rt_kv_get_stats(&st);
+    mp_obj_t d = mp_obj_new_dict(9);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_backend),
+        st.backend ? mp_obj_new_str(st.backend, strlen(st.backend)) : mp_const_none);
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_sets), mp_obj_new_int_from_uint(st.sets));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_commits), mp_obj_new_int_from_uint(st.commits));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_flash_commits), mp_obj_new_int_from_uint(st.flash_commits));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_flash_ops), mp_obj_new_int_from_uint(st.flash_ops));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_written), mp_obj_new_int_from_uint(st.bytes_written));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_cached), mp_obj_new_int_from_uint(st.cached));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_dirty), mp_obj_new_int_from_uint(st.dirty));
+    mp_obj_dict_store(d, MP_OBJ_NEW_QSTR(MP_QSTR_pending), mp_obj_new_bool(st.commit_pending));
+    return d;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_kv_stats_obj, basalt_kv_stats);
+
 static void basalt_led_init(void) {
     gpio_config_t io_conf = {
         .pin_bit_mask = 0,
@@ -860,86 +1193,620 @@ static mp_obj_t basalt_ssd_text(size_t n_args, const mp_obj_t *args) {
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ssd_text_obj, 1, 2, basalt_ssd_text);
 #endif // BASALT_ENABLE_DISPLAY_SSD1306
 
-void basalt_module_init(void) {
-    qstr q_basalt = qstr_from_str("basalt");
-    mp_obj_module_t *mod = mp_obj_new_module(q_basalt);
-
-    mp_obj_module_t *gpio_mod = mp_obj_new_module(qstr_from_str("basalt_gpio"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("mode")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_mode_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("set")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_set_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(gpio_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("get")),
-        MP_OBJ_FROM_PTR(&basalt_gpio_get_obj));
-
-    mp_obj_module_t *timer_mod = mp_obj_new_module(qstr_from_str("basalt_timer"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(timer_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("sleep_ms")),
-        MP_OBJ_FROM_PTR(&basalt_timer_sleep_ms_obj));
-
-    mp_obj_module_t *led_mod = mp_obj_new_module(qstr_from_str("basalt_led"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(led_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("set")),
-        MP_OBJ_FROM_PTR(&basalt_led_set_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(led_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("off")),
-        MP_OBJ_FROM_PTR(&basalt_led_off_obj));
+// ------------------------
+// basalt.stream: background samplers into caller-owned int16 rings
+// ------------------------
+// An esp_timer per stream wakes one sampler task, which reads the source and
+// writes a frame of int16 values into the app's array('h')/array('H') ring.
+// The VM never runs and nothing is allocated per sample; the app reads the
+// ring by index using count()/head(). Rings stay reachable through a root
+// pointer while a stream runs, and every stream stops when the app ends.
+#define BASALT_STREAM_IMU (BASALT_ENABLE_I2C && BASALT_ENABLE_IMU)
+#define BASALT_STREAM_BME280 (BASALT_ENABLE_I2C && BASALT_ENABLE_BME280)
+#define BASALT_STREAM_ENABLED (BASALT_ENABLE_ADC || BASALT_STREAM_IMU || BASALT_STREAM_BME280)
+
+#if BASALT_STREAM_ENABLED
+#ifndef BASALT_STREAM_MAX_HZ
+#define BASALT_STREAM_MAX_HZ 10000
+#endif
+#ifndef BASALT_STREAM_TASK_PRIO
+#define BASALT_STREAM_TASK_PRIO 10
+#endif
+#define BASALT_STREAM_TASK_STACK 3072
+
+typedef enum {
+    BASALT_STREAM_SRC_ADC = 1,
+    BASALT_STREAM_SRC_IMU,
+    BASALT_STREAM_SRC_BME280,
+} basalt_stream_src_t;
+
+// The sampler writes into a ring it owns (`ring`, outside the GC heap), never
+// into the app's array: an append or extend can move the array's storage at
+// any time. The VM copies new frames across (basalt_stream_sync) whenever the
+// app asks a Stream for its count or head.
+typedef struct {
+    bool active;
+    basalt_stream_src_t src;
+    int16_t *ring;
+    size_t ring_len;       // int16 values, a whole number of frames
+    uint32_t synced;       // frames copied into the app's ring
+    uint8_t channels;      // values per frame
+    esp_timer_handle_t timer;
+    int res;
+    uint32_t pending;      // timer ticks not yet sampled (atomic)
+    uint32_t count;        // frames written (atomic, release)
+    uint32_t dropped;      // ticks that found the sampler still busy
+    uint32_t errors;       // failed source reads
+} basalt_stream_slot_t;
+
+static basalt_stream_slot_t s_streams[BASALT_STREAM_MAX];
+static TaskHandle_t s_stream_task;
+static SemaphoreHandle_t s_stream_lock;
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t basalt_stream_rings[BASALT_STREAM_MAX]);
+
+#if BASALT_STREAM_IMU || BASALT_STREAM_BME280
+static uint8_t basalt_stream_i2c_addr(const char *cfg, uint8_t fallback) {
+    long v = strtol(cfg, NULL, 0);
+    return (v > 0 && v <= 0x7F) ? (uint8_t)v : fallback;
+}
+
+static esp_err_t basalt_stream_i2c_write(uint8_t addr, uint8_t reg, uint8_t val) {
+    uint8_t payload[2] = { reg, val };
+    return i2c_master_write_to_device(I2C_NUM_0, addr, payload, sizeof(payload), pdMS_TO_TICKS(20));
+}
+#endif
+
+// Reads one frame; false counts as an error and leaves the ring untouched.
+// Runs on the sampler task, never the VM.
+static bool basalt_stream_read(const basalt_stream_slot_t *st, int16_t *frame) {
+    switch (st->src) {
+#if BASALT_ENABLE_ADC
+        case BASALT_STREAM_SRC_ADC: {
+            int raw = 0;
+            if (hal_adc_read_raw(&s_adc, &raw) != 0) return false;
+            frame[0] = (int16_t)raw;
+            return true;
+        }
+#endif
+#if BASALT_STREAM_IMU
+        case BASALT_STREAM_SRC_IMU: {
+            // MPU6050/MPU6886 ACCEL_XOUT_H..GYRO_ZOUT_L, skipping the temperature.
+            uint8_t reg = 0x3B;
+            uint8_t d[14];
+            uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_IMU_ADDRESS, 0x68);
+            if (i2c_master_write_read_device(I2C_NUM_0, addr, &reg, 1, d, sizeof(d), pdMS_TO_TICKS(10)) != ESP_OK) {
+                return false;
+            }
+            static const uint8_t offs[6] = { 0, 2, 4, 8, 10, 12 };
+            for (int i = 0; i < 6; ++i) {
+                frame[i] = (int16_t)((d[offs[i]] << 8) | d[offs[i] + 1]);
+            }
+            return true;
+        }
+#endif
+#if BASALT_STREAM_BME280
+        case BASALT_STREAM_SRC_BME280: {
+            // Raw, uncompensated: temperature and pressure keep their top 16
+            // of 20 bits, humidity is 16-bit; read them as array('H').
+            uint8_t reg = 0xF7;
+            uint8_t d[8];
+            uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_BME280_I2C_ADDRESS, 0x76);
+            if (i2c_master_write_read_device(I2C_NUM_0, addr, &reg, 1, d, sizeof(d), pdMS_TO_TICKS(10)) != ESP_OK) {
+                return false;
+            }
+            frame[0] = (int16_t)((d[3] << 8) | d[4]);
+            frame[1] = (int16_t)((d[0] << 8) | d[1]);
+            frame[2] = (int16_t)((d[6] << 8) | d[7]);
+            return true;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+static void basalt_stream_task(void *arg) {
+    (void)arg;
+    for (;;) {
+        uint32_t due = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &due, portMAX_DELAY);
+        xSemaphoreTake(s_stream_lock, portMAX_DELAY);
+        for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+            basalt_stream_slot_t *st = &s_streams[i];
+            if (!(due & (1U << i)) || !st->active) continue;
+            uint32_t ticks = __atomic_exchange_n(&st->pending, 0, __ATOMIC_ACQ_REL);
+            if (ticks > 1) st->dropped += ticks - 1;
+            int16_t frame[6];
+            if (!basalt_stream_read(st, frame)) {
+                st->errors++;
+                continue;
+            }
+            uint32_t n = st->count;
+            int16_t *dst = st->ring + ((size_t)n * st->channels) % st->ring_len;
+            memcpy(dst, frame, st->channels * sizeof(int16_t));
+            __atomic_store_n(&st->count, n + 1, __ATOMIC_RELEASE);
+        }
+        xSemaphoreGive(s_stream_lock);
+    }
+}
+
+static void basalt_stream_tick(void *arg) {
+    basalt_stream_slot_t *st = (basalt_stream_slot_t *)arg;
+    __atomic_fetch_add(&st->pending, 1, __ATOMIC_RELAXED);
+    xTaskNotify(s_stream_task, 1U << (st - s_streams), eSetBits);
+}
+
+// Stops the sampler for a slot; once this returns the ring is no longer written.
+static void basalt_stream_stop_slot(basalt_stream_slot_t *st) {
+    if (!st->active) return;
+    esp_timer_stop(st->timer);
+    esp_timer_delete(st->timer);
+    st->timer = NULL;
+    xSemaphoreTake(s_stream_lock, portMAX_DELAY);
+    st->active = false;
+    xSemaphoreGive(s_stream_lock);
+    free(st->ring);
+    st->ring = NULL;
+#if BASALT_ENABLE_ADC
+    if (st->src == BASALT_STREAM_SRC_ADC) {
+        s_adc_streams--;
+    }
+#endif
+    MP_STATE_VM(basalt_stream_rings)[st - s_streams] = MP_OBJ_NULL;
+}
+
+static void basalt_stream_release(void *handle) {
+    basalt_stream_slot_t *st = (basalt_stream_slot_t *)handle;
+    st->res = -1;
+    basalt_stream_stop_slot(st);
+}
+
+static void basalt_stream_stop_all(void) {
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        basalt_stream_slot_t *st = &s_streams[i];
+        if (st->active) {
+            if (st->res >= 0) basalt_res_untrack(st->res);
+            st->res = -1;
+            basalt_stream_stop_slot(st);
+        }
+        MP_STATE_VM(basalt_stream_rings)[i] = MP_OBJ_NULL;
+    }
+}
+
+#if BASALT_ENABLE_ADC
+static void basalt_stream_stop_adc(void) {
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        basalt_stream_slot_t *st = &s_streams[i];
+        if (st->active && st->src == BASALT_STREAM_SRC_ADC) {
+            if (st->res >= 0) basalt_res_untrack(st->res);
+            st->res = -1;
+            basalt_stream_stop_slot(st);
+        }
+    }
+}
+#endif
+
+// Copies the frames written since the last call into the app's ring. Runs on
+// the VM, so the array can't move underneath; if the app resized it, the
+// stream is stopped rather than guessing where the frames go.
+static void basalt_stream_sync(basalt_stream_slot_t *st) {
+    if (!st->active) return;
+    uint32_t n = __atomic_load_n(&st->count, __ATOMIC_ACQUIRE);
+    if (n == st->synced) return;
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(MP_STATE_VM(basalt_stream_rings)[st - s_streams], &info, MP_BUFFER_WRITE);
+    size_t len = info.len / 2;
+    if (len - len % st->channels != st->ring_len) {
+        if (st->res >= 0) basalt_res_untrack(st->res);
+        st->res = -1;
+        basalt_stream_stop_slot(st);
+        mp_raise_ValueError(MP_ERROR_TEXT("ring resized"));
+    }
+    size_t frames = st->ring_len / st->channels;
+    uint32_t from = n - st->synced > frames ? n - (uint32_t)frames : st->synced;
+    int16_t *dst = (int16_t *)info.buf;
+    for (; from != n; ++from) {
+        size_t at = ((size_t)from * st->channels) % st->ring_len;
+        memcpy(dst + at, st->ring + at, st->channels * sizeof(int16_t));
+    }
+    st->synced = n;
+}
+
+typedef struct _basalt_stream_obj_t {
+    mp_obj_base_t base;
+    basalt_stream_slot_t *slot;
+    uint32_t gen;  // slot generation, so a stale object can't touch a reused slot
+} basalt_stream_obj_t;
+
+static uint32_t s_stream_gen[BASALT_STREAM_MAX];
+extern const mp_obj_type_t basalt_stream_type;
+
+static basalt_stream_slot_t *basalt_stream_slot(mp_obj_t self_in) {
+    basalt_stream_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t i = (size_t)(self->slot - s_streams);
+    if (s_stream_gen[i] != self->gen) {
+        mp_raise_ValueError(MP_ERROR_TEXT("stream closed"));
+    }
+    return self->slot;
+}
+
+static mp_obj_t basalt_stream_start(basalt_stream_src_t src, uint8_t channels, mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(ring_obj, &info, MP_BUFFER_WRITE);
+    if ((info.typecode != 'h' && info.typecode != 'H') || ((uintptr_t)info.buf & 1U) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ring must be array('h') or array('H')"));
+    }
+    size_t len = info.len / 2;
+    len -= len % channels;
+    if (len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ring too small"));
+    }
+    mp_int_t hz = mp_obj_get_int(hz_obj);
+    if (hz < 1 || hz > BASALT_STREAM_MAX_HZ) {
+        mp_raise_ValueError(MP_ERROR_TEXT("rate out of range"));
+    }
+
+    int slot = -1;
+    for (int i = 0; i < BASALT_STREAM_MAX; ++i) {
+        if (!s_streams[i].active) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    if (!s_stream_lock) {
+        s_stream_lock = xSemaphoreCreateMutex();
+    }
+    if (!s_stream_task && xTaskCreate(basalt_stream_task, "basalt_stream", BASALT_STREAM_TASK_STACK, NULL,
+                                      BASALT_STREAM_TASK_PRIO, &s_stream_task) != pdPASS) {
+        s_stream_task = NULL;
+        mp_raise_OSError(MP_ENOMEM);
+    }
+
+    basalt_stream_obj_t *o = mp_obj_malloc(basalt_stream_obj_t, &basalt_stream_type);
+    basalt_stream_slot_t *st = &s_streams[slot];
+    memset(st, 0, sizeof(*st));
+    st->src = src;
+    st->ring = malloc(len * sizeof(int16_t));
+    if (!st->ring) {
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    st->ring_len = len;
+    st->channels = channels;
+    st->res = -1;
+    const esp_timer_create_args_t args = {
+        .callback = basalt_stream_tick,
+        .arg = st,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "basalt_stream",
+    };
+    if (esp_timer_create(&args, &st->timer) != ESP_OK) {
+        free(st->ring);
+        st->ring = NULL;
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    MP_STATE_VM(basalt_stream_rings)[slot] = ring_obj;
+    st->active = true;
+    // An untracked stream would outlive the app, so a full resource table
+    // fails the start.
+    st->res = basalt_res_track(basalt_stream_release, st);
+    if (st->res < 0) {
+        basalt_stream_stop_slot(st);
+        mp_raise_OSError(MP_ENOMEM);
+    }
+    esp_timer_start_periodic(st->timer, 1000000ULL / (uint64_t)hz);
+
+    o->slot = st;
+    o->gen = ++s_stream_gen[slot];
+    return MP_OBJ_FROM_PTR(o);
+}
+
+#if BASALT_ENABLE_ADC
+// basalt.stream.adc(pin, ring, hz): one raw 12-bit sample per frame.
+static mp_obj_t basalt_stream_adc(mp_obj_t pin_obj, mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    basalt_adc_ensure(mp_obj_get_int(pin_obj));
+    mp_obj_t o = basalt_stream_start(BASALT_STREAM_SRC_ADC, 1, ring_obj, hz_obj);
+    s_adc_streams++;
+    return o;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(basalt_stream_adc_obj, basalt_stream_adc);
+#endif
+
+#if BASALT_STREAM_IMU
+// basalt.stream.imu(ring, hz): frames of ax, ay, az, gx, gy, gz (raw, +/-2 g).
+static mp_obj_t basalt_stream_imu(mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    esp_err_t err = basalt_i2c0_ensure(400000);
+    uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_IMU_ADDRESS, 0x68);
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0x6B, 0x00);  // PWR_MGMT_1: wake
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0x1C, 0x00);  // ACCEL_CONFIG: +/-2 g
+    if (err != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return basalt_stream_start(BASALT_STREAM_SRC_IMU, 6, ring_obj, hz_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_stream_imu_obj, basalt_stream_imu);
+#endif
+
+#if BASALT_STREAM_BME280
+// basalt.stream.bme280(ring, hz): frames of raw temperature, pressure, humidity.
+static mp_obj_t basalt_stream_bme280(mp_obj_t ring_obj, mp_obj_t hz_obj) {
+    esp_err_t err = basalt_i2c0_ensure(400000);
+    uint8_t addr = basalt_stream_i2c_addr(BASALT_CFG_BME280_I2C_ADDRESS, 0x76);
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0xF2, 0x01);  // ctrl_hum: x1
+    if (err == ESP_OK) err = basalt_stream_i2c_write(addr, 0xF4, 0x27);  // ctrl_meas: x1/x1, normal mode
+    if (err != ESP_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return basalt_stream_start(BASALT_STREAM_SRC_BME280, 3, ring_obj, hz_obj);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_stream_bme280_obj, basalt_stream_bme280);
+#endif
+
+// Stream.count(): frames copied into the ring so far, after copying any new
+// ones. The newest frame starts at
+// ((count() - 1) * channels) % len(ring).
+static mp_obj_t basalt_stream_count(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    basalt_stream_sync(st);
+    uint32_t n = st->synced;
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(n & MP_SMALL_INT_POSITIVE_MASK));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_count_obj, basalt_stream_count);
+
+// Stream.head(): ring index the next frame will be written to.
+static mp_obj_t basalt_stream_head(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    basalt_stream_sync(st);
+    uint32_t n = st->synced;
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(((size_t)n * st->channels) % st->ring_len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_head_obj, basalt_stream_head);
+
+// Stream.stats() -> (count, dropped, errors)
+static mp_obj_t basalt_stream_stats(mp_obj_t self_in) {
+    const basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    mp_obj_t items[3] = {
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->count & MP_SMALL_INT_POSITIVE_MASK)),
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->dropped & MP_SMALL_INT_POSITIVE_MASK)),
+        MP_OBJ_NEW_SMALL_INT((mp_int_t)(st->errors & MP_SMALL_INT_POSITIVE_MASK)),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_stats_obj, basalt_stream_stats);
+
+static mp_obj_t basalt_stream_stop(mp_obj_t self_in) {
+    basalt_stream_slot_t *st = basalt_stream_slot(self_in);
+    if (st->active) {
+        basalt_stream_sync(st);
+        if (st->res >= 0) basalt_res_untrack(st->res);
+        st->res = -1;
+        basalt_stream_stop_slot(st);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_stream_stop_fn_obj, basalt_stream_stop);
+
+static const mp_rom_map_elem_t basalt_stream_locals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&basalt_stream_count_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_head),  MP_ROM_PTR(&basalt_stream_head_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&basalt_stream_stats_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_stop),  MP_ROM_PTR(&basalt_stream_stop_fn_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_stream_locals, basalt_stream_locals_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    basalt_stream_type,
+    MP_QSTR_Stream,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &basalt_stream_locals
+);
+#endif // BASALT_STREAM_ENABLED
+
+// Module tables live in flash: registering them costs no heap and no qstr
+// interning at launch, and `import basalt` resolves through the builtin
+// module table instead of a per-run dict.
+static const mp_rom_map_elem_t basalt_gpio_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_gpio) },
+    { MP_ROM_QSTR(MP_QSTR_mode), MP_ROM_PTR(&basalt_gpio_mode_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set),  MP_ROM_PTR(&basalt_gpio_set_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_get),  MP_ROM_PTR(&basalt_gpio_get_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_write_seq), MP_ROM_PTR(&basalt_gpio_write_seq_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_gpio_globals, basalt_gpio_globals_table);
+
+static const mp_obj_module_t basalt_gpio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_gpio_globals,
+};
+
+static const mp_rom_map_elem_t basalt_timer_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),   MP_ROM_QSTR(MP_QSTR_basalt_timer) },
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms),   MP_ROM_PTR(&basalt_timer_sleep_ms_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_ticks_us),   MP_ROM_PTR(&basalt_timer_ticks_us_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff), MP_ROM_PTR(&basalt_timer_ticks_diff_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_timer_globals, basalt_timer_globals_table);
+
+static const mp_obj_module_t basalt_timer_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_timer_globals,
+};
+
+static const mp_rom_map_elem_t basalt_events_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_events) },
+    { MP_ROM_QSTR(MP_QSTR_poll),     MP_ROM_PTR(&basalt_events_poll_obj) },
+    { MP_ROM_QSTR(MP_QSTR_post),     MP_ROM_PTR(&basalt_events_post_obj) },
+    { MP_ROM_QSTR(MP_QSTR_KEY),      MP_ROM_INT(RT_EVT_KEY)   },
+    { MP_ROM_QSTR(MP_QSTR_TIMER),    MP_ROM_INT(RT_EVT_TIMER) },
+    { MP_ROM_QSTR(MP_QSTR_USER),     MP_ROM_INT(RT_EVT_USER)  },
+    { MP_ROM_QSTR(MP_QSTR_TOUCH),    MP_ROM_INT(RT_EVT_TOUCH) },
+};
+static MP_DEFINE_CONST_DICT(basalt_events_globals, basalt_events_globals_table);
+
+static const mp_obj_module_t basalt_events_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_events_globals,
+};
+
+static const mp_rom_map_elem_t basalt_sys_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_sys) },
+    { MP_ROM_QSTR(MP_QSTR_stats),    MP_ROM_PTR(&basalt_sys_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_sys_globals, basalt_sys_globals_table);
+
+static const mp_obj_module_t basalt_sys_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_sys_globals,
+};
+
+static const mp_rom_map_elem_t basalt_kv_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_kv) },
+    { MP_ROM_QSTR(MP_QSTR_get),      MP_ROM_PTR(&basalt_kv_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set),      MP_ROM_PTR(&basalt_kv_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delete),   MP_ROM_PTR(&basalt_kv_delete_obj) },
+    { MP_ROM_QSTR(MP_QSTR_commit),   MP_ROM_PTR(&basalt_kv_commit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats),    MP_ROM_PTR(&basalt_kv_stats_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_kv_globals, basalt_kv_globals_table);
+
+static const mp_obj_module_t basalt_kv_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_kv_globals,
+};
+
+static const mp_rom_map_elem_t basalt_led_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_led) },
+    { MP_ROM_QSTR(MP_QSTR_set), MP_ROM_PTR(&basalt_led_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_off), MP_ROM_PTR(&basalt_led_off_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_led_globals, basalt_led_globals_table);
+
+static const mp_obj_module_t basalt_led_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_led_globals,
+};
+
+#if BASALT_ENABLE_ADC
+static const mp_rom_map_elem_t basalt_adc_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),  MP_ROM_QSTR(MP_QSTR_basalt_adc) },
+    { MP_ROM_QSTR(MP_QSTR_read),      MP_ROM_PTR(&basalt_adc_read_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_read_into), MP_ROM_PTR(&basalt_adc_read_into_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_adc_globals, basalt_adc_globals_table);
+
+static const mp_obj_module_t basalt_adc_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_adc_globals,
+};
+#endif
+
+#if BASALT_STREAM_ENABLED
+static const mp_rom_map_elem_t basalt_stream_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_stream) },
+    { MP_ROM_QSTR(MP_QSTR_Stream),   MP_ROM_PTR(&basalt_stream_type)     },
+#if BASALT_ENABLE_ADC
+    { MP_ROM_QSTR(MP_QSTR_adc),      MP_ROM_PTR(&basalt_stream_adc_obj)    },
+#endif
+#if BASALT_STREAM_IMU
+    { MP_ROM_QSTR(MP_QSTR_imu),      MP_ROM_PTR(&basalt_stream_imu_obj)    },
+#endif
+#if BASALT_STREAM_BME280
+    { MP_ROM_QSTR(MP_QSTR_bme280),   MP_ROM_PTR(&basalt_stream_bme280_obj) },
+#endif
+};
+static MP_DEFINE_CONST_DICT(basalt_stream_globals, basalt_stream_globals_table);
+
+static const mp_obj_module_t basalt_stream_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_stream_globals,
+};
+#endif
 
 #if BASALT_ENABLE_RTC
-    mp_obj_module_t *rtc_mod = mp_obj_new_module(qstr_from_str("basalt_rtc"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(rtc_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("available")),
-        MP_OBJ_FROM_PTR(&basalt_rtc_available_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(rtc_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("now")),
-        MP_OBJ_FROM_PTR(&basalt_rtc_now_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(rtc_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("address")),
-        MP_OBJ_FROM_PTR(&basalt_rtc_address_fun_obj));
+static const mp_rom_map_elem_t basalt_rtc_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),  MP_ROM_QSTR(MP_QSTR_basalt_rtc) },
+    { MP_ROM_QSTR(MP_QSTR_available), MP_ROM_PTR(&basalt_rtc_available_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_now),       MP_ROM_PTR(&basalt_rtc_now_obj)         },
+    { MP_ROM_QSTR(MP_QSTR_address),   MP_ROM_PTR(&basalt_rtc_address_fun_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_rtc_globals, basalt_rtc_globals_table);
+
+static const mp_obj_module_t basalt_rtc_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_rtc_globals,
+};
 #endif
+
 #if BASALT_ENABLE_DISPLAY_SSD1306
-    mp_obj_module_t *ssd_mod = mp_obj_new_module(qstr_from_str("basalt_ssd1306"));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ready")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_ready_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("width")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_width_fun_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("height")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_height_fun_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("show")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_show_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("clear")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_clear_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("color")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_color_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("pixel")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_pixel_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("line")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_line_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("rect")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_rect_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("circle")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_circle_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ellipse")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_ellipse_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("text_at")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_text_at_obj));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(ssd_mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("text")),
-        MP_OBJ_FROM_PTR(&basalt_ssd_text_obj));
-#endif
-
-    mp_obj_module_t *ui_mod = mp_obj_new_module(qstr_from_str("basalt_ui"));
-    basalt_ui_init(ui_mod);
-
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("gpio")),
-        MP_OBJ_FROM_PTR(gpio_mod));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("timer")),
-        MP_OBJ_FROM_PTR(timer_mod));
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("led")),
-        MP_OBJ_FROM_PTR(led_mod));
+static const mp_rom_map_elem_t basalt_ssd_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_ssd1306) },
+    { MP_ROM_QSTR(MP_QSTR_ready),   MP_ROM_PTR(&basalt_ssd_ready_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_width),   MP_ROM_PTR(&basalt_ssd_width_fun_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_height),  MP_ROM_PTR(&basalt_ssd_height_fun_obj) },
+    { MP_ROM_QSTR(MP_QSTR_show),    MP_ROM_PTR(&basalt_ssd_show_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_clear),   MP_ROM_PTR(&basalt_ssd_clear_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_color),   MP_ROM_PTR(&basalt_ssd_color_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_pixel),   MP_ROM_PTR(&basalt_ssd_pixel_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_line),    MP_ROM_PTR(&basalt_ssd_line_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_rect),    MP_ROM_PTR(&basalt_ssd_rect_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_circle),  MP_ROM_PTR(&basalt_ssd_circle_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_ellipse), MP_ROM_PTR(&basalt_ssd_ellipse_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_text_at), MP_ROM_PTR(&basalt_ssd_text_at_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_text),    MP_ROM_PTR(&basalt_ssd_text_obj)       },
+};
+static MP_DEFINE_CONST_DICT(basalt_ssd_globals, basalt_ssd_globals_table);
+
+static const mp_obj_module_t basalt_ssd_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_ssd_globals,
+};
+#endif
+
+static const mp_rom_map_elem_t basalt_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt) },
+    { MP_ROM_QSTR(MP_QSTR_gpio),  MP_ROM_PTR(&basalt_gpio_module)  },
+    { MP_ROM_QSTR(MP_QSTR_timer), MP_ROM_PTR(&basalt_timer_module) },
+    { MP_ROM_QSTR(MP_QSTR_events), MP_ROM_PTR(&basalt_events_module) },
+    { MP_ROM_QSTR(MP_QSTR_sys),   MP_ROM_PTR(&basalt_sys_module)   },
+    { MP_ROM_QSTR(MP_QSTR_kv),    MP_ROM_PTR(&basalt_kv_module)    },
+    { MP_ROM_QSTR(MP_QSTR_led),   MP_ROM_PTR(&basalt_led_module)   },
+#if BASALT_ENABLE_ADC
+    { MP_ROM_QSTR(MP_QSTR_adc),   MP_ROM_PTR(&basalt_adc_module)   },
+#endif
+#if BASALT_STREAM_ENABLED
+    { MP_ROM_QSTR(MP_QSTR_stream), MP_ROM_PTR(&basalt_stream_module) },
+#endif
 #if BASALT_ENABLE_RTC
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("rtc")),
-        MP_OBJ_FROM_PTR(rtc_mod));
+    { MP_ROM_QSTR(MP_QSTR_rtc),   MP_ROM_PTR(&basalt_rtc_module)   },
 #endif
 #if BASALT_ENABLE_DISPLAY_SSD1306
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ssd1306")),
-        MP_OBJ_FROM_PTR(ssd_mod));
+    { MP_ROM_QSTR(MP_QSTR_ssd1306), MP_ROM_PTR(&basalt_ssd_module) },
 #endif
-    mp_obj_dict_store(MP_OBJ_FROM_PTR(mod->globals), MP_OBJ_NEW_QSTR(qstr_from_str("ui")),
-        MP_OBJ_FROM_PTR(ui_mod));
+    { MP_ROM_QSTR(MP_QSTR_ui),    MP_ROM_PTR(&basalt_ui_module)    },
+};
+static MP_DEFINE_CONST_DICT(basalt_globals, basalt_globals_table);
+
+const mp_obj_module_t mp_module_basalt = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_basalt, mp_module_basalt);
+
+void basalt_module_init(void) {
+    // Per-launch state only; the module itself is const.
+    basalt_ui_init();
+#if BASALT_STREAM_ENABLED
+    basalt_stream_stop_all();
+#endif
+    // Drop events queued while no loop was polling (e.g. the previous app's).
+    rt_event_t stale;
+    while (rt_event_poll(&stale, 0) > 0) {
+    }
 
-    mp_store_global(q_basalt, MP_OBJ_FROM_PTR(mod));
+    // Older scripts use `basalt` without importing it.
+    mp_store_global(MP_QSTR_basalt, MP_OBJ_FROM_PTR(&mp_module_basalt));
 }
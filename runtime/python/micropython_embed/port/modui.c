@@ -2,9 +2,11 @@
 #include "py/runtime.h"
 #include "py/qstr.h"
 #include "py/misc.h"
+#include "py/mperrno.h"
 #include <string.h>
 
 #include "modui.h"
+#include "basalt_res.h"
 #include "tft_console.h"
 
 #ifndef STATIC
@@ -390,6 +392,28 @@ STATIC mp_obj_t basalt_ui_pixel(mp_obj_t x_obj, mp_obj_t y_obj, mp_obj_t color_o
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(basalt_ui_pixel_obj, basalt_ui_pixel);
 
+// pixels(buf[, color]): buf is int16 memory (array('h'), bytearray, memoryview)
+// holding x, y pairs drawn in color, or x, y, rgb565 triples without it.
+STATIC mp_obj_t basalt_ui_pixels(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(args[0], &info, MP_BUFFER_READ);
+    if (((uintptr_t)info.buf & 1U) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("point buffer must be 2-byte aligned"));
+    }
+    bool has_color = n_args < 2;
+    uint16_t color = 0;
+    if (!has_color) {
+        int c = mp_obj_get_int(args[1]);
+        if (c < 0) c = 0;
+        if (c > 0xFFFF) c = 0xFFFF;
+        color = (uint16_t)c;
+    }
+    size_t count = info.len / (has_color ? 6 : 4);
+    tft_console_draw_pixels((const int16_t *)info.buf, count, has_color, color);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_pixels_obj, 1, 2, basalt_ui_pixels);
+
 STATIC mp_obj_t basalt_ui_line(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
     int x0 = mp_obj_get_int(args[0]);
@@ -463,31 +487,284 @@ STATIC mp_obj_t basalt_ui_touch(void) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(basalt_ui_touch_obj, basalt_ui_touch);
 
+// Longest single wait in touch_event: the touch queue doesn't see the stop
+// request's task notification, so pending exceptions are checked this often.
+#ifndef BASALT_UI_TOUCH_WAIT_SLICE_MS
+#define BASALT_UI_TOUCH_WAIT_SLICE_MS 50
+#endif
+
+// touch_event([timeout_ms]) -> (kind, x, y, ms) or None. kind: 1 press,
+// 2 move, 3 release. Default timeout 0 (poll); negative waits forever.
+STATIC mp_obj_t basalt_ui_touch_event(size_t n_args, const mp_obj_t *args) {
+    mp_int_t timeout = (n_args >= 1) ? mp_obj_get_int(args[0]) : 0;
+    tft_touch_event_t ev;
+    for (;;) {
+        uint32_t wait = BASALT_UI_TOUCH_WAIT_SLICE_MS;
+        if (timeout >= 0 && (mp_uint_t)timeout < wait) wait = (uint32_t)timeout;
+        bool got = tft_console_touch_next_event(&ev, wait);
+        mp_handle_pending(true);
+        if (got) break;
+        if (timeout >= 0) {
+            timeout -= wait;
+            if (timeout <= 0) return mp_const_none;
+        }
+    }
+    mp_obj_t items[4];
+    items[0] = MP_OBJ_NEW_SMALL_INT(ev.type);
+    items[1] = MP_OBJ_NEW_SMALL_INT(ev.x);
+    items[2] = MP_OBJ_NEW_SMALL_INT(ev.y);
+    items[3] = mp_obj_new_int_from_uint(ev.ms);
+    return mp_obj_new_tuple(4, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_touch_event_obj, 0, 1, basalt_ui_touch_event);
+
+// touch_calibrate([x_min, x_max, y_min, y_max[, invert_x, invert_y]]):
+// returns the active calibration tuple, after applying new values if given.
+STATIC mp_obj_t basalt_ui_touch_calibrate(size_t n_args, const mp_obj_t *args) {
+    tft_touch_cal_t cal;
+    tft_console_touch_get_calibration(&cal);
+    if (n_args >= 4) {
+        cal.x_min = (int16_t)mp_obj_get_int(args[0]);
+        cal.x_max = (int16_t)mp_obj_get_int(args[1]);
+        cal.y_min = (int16_t)mp_obj_get_int(args[2]);
+        cal.y_max = (int16_t)mp_obj_get_int(args[3]);
+        if (n_args >= 6) {
+            cal.invert_x = mp_obj_is_true(args[4]);
+            cal.invert_y = mp_obj_is_true(args[5]);
+        }
+        if (!tft_console_touch_set_calibration(&cal)) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid touch calibration"));
+        }
+    } else if (n_args != 0) {
+        mp_raise_TypeError(MP_ERROR_TEXT("expected 0, 4 or 6 arguments"));
+    }
+    mp_obj_t items[6];
+    items[0] = MP_OBJ_NEW_SMALL_INT(cal.x_min);
+    items[1] = MP_OBJ_NEW_SMALL_INT(cal.x_max);
+    items[2] = MP_OBJ_NEW_SMALL_INT(cal.y_min);
+    items[3] = MP_OBJ_NEW_SMALL_INT(cal.y_max);
+    items[4] = mp_obj_new_bool(cal.invert_x);
+    items[5] = mp_obj_new_bool(cal.invert_y);
+    return mp_obj_new_tuple(6, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_touch_calibrate_obj, 0, 6, basalt_ui_touch_calibrate);
+
 // ------------------------
-// Export into module dict
+// Bitmap blits (buffer protocol, no copies)
 // ------------------------
-void basalt_ui_init(mp_obj_module_t *ui_mod) {
-    mp_obj_t g = MP_OBJ_FROM_PTR(ui_mod->globals);
+STATIC const uint16_t *basalt_ui_rgb565_buf(mp_obj_t obj, size_t *count) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(obj, &info, MP_BUFFER_READ);
+    if (((uintptr_t)info.buf & 1U) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("RGB565 buffer must be 2-byte aligned"));
+    }
+    *count = info.len / 2;
+    return (const uint16_t *)info.buf;
+}
+
+// blit(x, y, w, h, buf): buf holds w*h RGB565 pixels.
+STATIC mp_obj_t basalt_ui_blit(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    int w = mp_obj_get_int(args[2]);
+    int h = mp_obj_get_int(args[3]);
+    size_t count = 0;
+    const uint16_t *px = basalt_ui_rgb565_buf(args[4], &count);
+    if (w <= 0 || h <= 0) return mp_const_none;
+    if (count < (size_t)w * (size_t)h) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    }
+    tft_console_blit(x, y, w, h, px);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_blit_obj, 5, 5, basalt_ui_blit);
+
+// blit_indexed(x, y, w, h, buf, bpp, palette[, key]): bpp is 1/2/4/8, rows
+// packed MSB-first and byte-padded; palette holds RGB565 entries.
+STATIC mp_obj_t basalt_ui_blit_indexed(size_t n_args, const mp_obj_t *args) {
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    int w = mp_obj_get_int(args[2]);
+    int h = mp_obj_get_int(args[3]);
+    mp_buffer_info_t data;
+    mp_get_buffer_raise(args[4], &data, MP_BUFFER_READ);
+    int bpp = mp_obj_get_int(args[5]);
+    size_t pal_len = 0;
+    const uint16_t *pal = basalt_ui_rgb565_buf(args[6], &pal_len);
+    int key = (n_args >= 8) ? mp_obj_get_int(args[7]) : -1;
+    if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bpp must be 1, 2, 4 or 8"));
+    }
+    if (pal_len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("empty palette"));
+    }
+    if (w <= 0 || h <= 0) return mp_const_none;
+    size_t stride = ((size_t)w * (size_t)bpp + 7U) / 8U;
+    if (data.len < stride * (size_t)h) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    }
+    tft_console_blit_indexed(x, y, w, h, (const uint8_t *)data.buf, bpp, pal, (int)pal_len, key);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_blit_indexed_obj, 7, 8, basalt_ui_blit_indexed);
+
+// blit_rle(x, y, w, h, buf[, key]): see tft_console_blit_rle for the format.
+STATIC mp_obj_t basalt_ui_blit_rle(size_t n_args, const mp_obj_t *args) {
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    int w = mp_obj_get_int(args[2]);
+    int h = mp_obj_get_int(args[3]);
+    mp_buffer_info_t data;
+    mp_get_buffer_raise(args[4], &data, MP_BUFFER_READ);
+    int key = (n_args >= 6) ? mp_obj_get_int(args[5]) : -1;
+    tft_console_blit_rle(x, y, w, h, (const uint8_t *)data.buf, data.len, key);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_blit_rle_obj, 5, 6, basalt_ui_blit_rle);
+
+// ------------------------
+// Off-screen canvas
+// ------------------------
+// canvas([on]): compose draws off-screen until flush(); returns whether a
+// canvas is active (False when the board has no memory budget for one).
+STATIC mp_obj_t basalt_ui_canvas(size_t n_args, const mp_obj_t *args) {
+    bool on = (n_args >= 1) ? mp_obj_is_true(args[0]) : true;
+    if (!on) {
+        tft_console_canvas_end();
+        return mp_const_false;
+    }
+    return mp_obj_new_bool(tft_console_canvas_begin());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_canvas_obj, 0, 1, basalt_ui_canvas);
+
+STATIC mp_obj_t basalt_ui_flush(void) {
+    tft_console_canvas_flush();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(basalt_ui_flush_obj, basalt_ui_flush);
+
+// ------------------------
+// Proportional fonts
+// ------------------------
+static const tft_font_t *s_ui_font;
+static tft_font_t *s_ui_font_file; // owned; closed when replaced or at app exit
+static int s_ui_font_res = -1;
+static int s_ui_font_scale = 1;
+
+static void basalt_ui_font_close(void *handle) {
+    if (handle == s_ui_font_file) {
+        s_ui_font_file = NULL;
+        s_ui_font = NULL;
+        s_ui_font_res = -1;
+    }
+    tft_font_close(handle);
+}
+
+static void basalt_ui_font_release(void) {
+    basalt_res_untrack(s_ui_font_res);
+    basalt_ui_font_close(s_ui_font_file);
+    s_ui_font = NULL;
+}
+
+// font([name_or_path[, scale]]): "small", "medium", "large" or a .bfnt path;
+// returns the line height in pixels.
+STATIC mp_obj_t basalt_ui_font(size_t n_args, const mp_obj_t *args) {
+    const char *name = (n_args >= 1 && args[0] != mp_const_none) ? mp_obj_str_get_str(args[0]) : NULL;
+    int scale = (n_args >= 2) ? mp_obj_get_int(args[1]) : 1;
+    if (scale < 1 || scale > 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("scale must be 1..8"));
+    }
+    const tft_font_t *font = tft_font_builtin(name);
+    tft_font_t *file = NULL;
+    if (!font) {
+        file = tft_font_open(name);
+        if (!file) {
+            mp_raise_OSError(MP_ENOENT);
+        }
+        font = file;
+    }
+    basalt_ui_font_release();
+    s_ui_font = font;
+    s_ui_font_file = file;
+    if (file) {
+        s_ui_font_res = basalt_res_track(basalt_ui_font_close, file);
+    }
+    s_ui_font_scale = scale;
+    return mp_obj_new_int(tft_font_height(font) * scale);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_font_obj, 0, 2, basalt_ui_font);
+
+// draw_text(x, y, text[, color[, bg]]): bg of -1 (default) is transparent;
+// returns the drawn width.
+STATIC mp_obj_t basalt_ui_draw_text(size_t n_args, const mp_obj_t *args) {
+    int x = mp_obj_get_int(args[0]);
+    int y = mp_obj_get_int(args[1]);
+    const char *text = mp_obj_str_get_str(args[2]);
+    int c = (n_args >= 4) ? mp_obj_get_int(args[3]) : 0xFFFF;
+    int bg = (n_args >= 5) ? mp_obj_get_int(args[4]) : -1;
+    if (c < 0) c = 0;
+    if (c > 0xFFFF) c = 0xFFFF;
+    if (bg > 0xFFFF) bg = 0xFFFF;
+    int w = tft_console_draw_text(x, y, text, s_ui_font, s_ui_font_scale, (uint16_t)c, bg);
+    return mp_obj_new_int(w);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_ui_draw_text_obj, 3, 5, basalt_ui_draw_text);
+
+STATIC mp_obj_t basalt_ui_text_width(mp_obj_t text_obj) {
+    const tft_font_t *font = s_ui_font ? s_ui_font : tft_font_builtin(NULL);
+    return mp_obj_new_int(tft_font_text_width(font, mp_obj_str_get_str(text_obj)) * s_ui_font_scale);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(basalt_ui_text_width_obj, basalt_ui_text_width);
+
+// ------------------------
+// Module table (ROM)
+// ------------------------
+STATIC const mp_rom_map_elem_t basalt_ui_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_ui) },
 
     // Factory functions (lowercase)
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_screen),    MP_OBJ_FROM_PTR(&basalt_ui_screen_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_button),    MP_OBJ_FROM_PTR(&basalt_ui_button_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_label),     MP_OBJ_FROM_PTR(&basalt_ui_label_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_set_title), MP_OBJ_FROM_PTR(&basalt_ui_set_title_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("ready")),   MP_OBJ_FROM_PTR(&basalt_ui_ready_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("clear")),   MP_OBJ_FROM_PTR(&basalt_ui_clear_fn_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("text")),    MP_OBJ_FROM_PTR(&basalt_ui_text_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("text_at")), MP_OBJ_FROM_PTR(&basalt_ui_text_at_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("color")),   MP_OBJ_FROM_PTR(&basalt_ui_color_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("pixel")),   MP_OBJ_FROM_PTR(&basalt_ui_pixel_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("line")),    MP_OBJ_FROM_PTR(&basalt_ui_line_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("rect")),    MP_OBJ_FROM_PTR(&basalt_ui_rect_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("circle")),  MP_OBJ_FROM_PTR(&basalt_ui_circle_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("ellipse")), MP_OBJ_FROM_PTR(&basalt_ui_ellipse_obj));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(qstr_from_str("touch")),   MP_OBJ_FROM_PTR(&basalt_ui_touch_obj));
+    { MP_ROM_QSTR(MP_QSTR_screen),          MP_ROM_PTR(&basalt_ui_screen_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_button),          MP_ROM_PTR(&basalt_ui_button_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_label),           MP_ROM_PTR(&basalt_ui_label_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_set_title),       MP_ROM_PTR(&basalt_ui_set_title_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_ready),           MP_ROM_PTR(&basalt_ui_ready_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_clear),           MP_ROM_PTR(&basalt_ui_clear_fn_obj)        },
+    { MP_ROM_QSTR(MP_QSTR_text),            MP_ROM_PTR(&basalt_ui_text_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_text_at),         MP_ROM_PTR(&basalt_ui_text_at_obj)         },
+    { MP_ROM_QSTR(MP_QSTR_color),           MP_ROM_PTR(&basalt_ui_color_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_pixel),           MP_ROM_PTR(&basalt_ui_pixel_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_pixels),          MP_ROM_PTR(&basalt_ui_pixels_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_line),            MP_ROM_PTR(&basalt_ui_line_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_rect),            MP_ROM_PTR(&basalt_ui_rect_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_circle),          MP_ROM_PTR(&basalt_ui_circle_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_ellipse),         MP_ROM_PTR(&basalt_ui_ellipse_obj)         },
+    { MP_ROM_QSTR(MP_QSTR_touch),           MP_ROM_PTR(&basalt_ui_touch_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_touch_event),     MP_ROM_PTR(&basalt_ui_touch_event_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_touch_calibrate), MP_ROM_PTR(&basalt_ui_touch_calibrate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit),            MP_ROM_PTR(&basalt_ui_blit_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_blit_indexed),    MP_ROM_PTR(&basalt_ui_blit_indexed_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_blit_rle),        MP_ROM_PTR(&basalt_ui_blit_rle_obj)        },
+    { MP_ROM_QSTR(MP_QSTR_canvas),          MP_ROM_PTR(&basalt_ui_canvas_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_flush),           MP_ROM_PTR(&basalt_ui_flush_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_font),            MP_ROM_PTR(&basalt_ui_font_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_draw_text),       MP_ROM_PTR(&basalt_ui_draw_text_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_text_width),      MP_ROM_PTR(&basalt_ui_text_width_obj)      },
 
     // Types (uppercase)
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_Screen), MP_OBJ_FROM_PTR(&basalt_ui_screen_type));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_Button), MP_OBJ_FROM_PTR(&basalt_ui_button_type));
-    mp_obj_dict_store(g, MP_OBJ_NEW_QSTR(MP_QSTR_Label),  MP_OBJ_FROM_PTR(&basalt_ui_label_type));
+    { MP_ROM_QSTR(MP_QSTR_Screen), MP_ROM_PTR(&basalt_ui_screen_type) },
+    { MP_ROM_QSTR(MP_QSTR_Button), MP_ROM_PTR(&basalt_ui_button_type) },
+    { MP_ROM_QSTR(MP_QSTR_Label),  MP_ROM_PTR(&basalt_ui_label_type)  },
+};
+STATIC MP_DEFINE_CONST_DICT(basalt_ui_globals, basalt_ui_globals_table);
+
+const mp_obj_module_t basalt_ui_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_ui_globals,
+};
+
+// Reset per-launch UI state (loaded font, text scale).
+void basalt_ui_init(void) {
+    basalt_ui_font_release();
+    s_ui_font_scale = 1;
 }
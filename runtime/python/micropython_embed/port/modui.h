@@ -2,5 +2,7 @@
 
 #include "py/obj.h"
 
-void basalt_ui_init(mp_obj_module_t *ui_mod);
+extern const mp_obj_module_t basalt_ui_module;
+
+void basalt_ui_init(void);
 
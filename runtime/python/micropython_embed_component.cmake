@@ -2,11 +2,80 @@ file(GLOB_RECURSE MPY_SRCS
     "${CMAKE_CURRENT_LIST_DIR}/*.c"
 )
 
+list(APPEND MPY_SRCS
+    "${CMAKE_CURRENT_LIST_DIR}/port/modui.c"
+)
+
 idf_component_register(
     SRCS ${MPY_SRCS}
-    INCLUDE_DIRS "." "port" "py" "extmod" "shared/runtime" "genhdr"
-    REQUIRES driver freertos
+    INCLUDE_DIRS "." "port" "py" "extmod" "shared/runtime" "genhdr" "${PROJECT_DIR}/config/generated"
+    REQUIRES driver freertos esp_timer
+    PRIV_REQUIRES main
 )
 
+# Frozen modules and apps (runtime/python/frozen/manifest.json), compiled to
+# ROM bytecode by tools/freeze_mpy.py at build time. Needs the micropython
+# submodule for tools/mpy-tool.py; mpy-cross comes from PATH or is built from
+# the submodule.
+if(BASALT_MPY_FROZEN)
+    get_filename_component(_basalt_root "${CMAKE_CURRENT_LIST_DIR}/../../.." ABSOLUTE)
+    set(_mpy_dir "${_basalt_root}/runtime/python/micropython")
+    set(_freeze "${_basalt_root}/tools/freeze_mpy.py")
+    set(_manifest "${_basalt_root}/runtime/python/frozen/manifest.json")
+    idf_build_get_property(_python PYTHON)
+    if(NOT EXISTS "${_mpy_dir}/tools/mpy-tool.py" OR NOT EXISTS "${_mpy_dir}/mpy-cross/Makefile")
+        message(FATAL_ERROR
+            "BASALT_MPY_FROZEN needs the micropython submodule (mpy-tool.py, mpy-cross): "
+            "run `git submodule update --init runtime/python/micropython`, "
+            "or configure with -DBASALT_MPY_FROZEN=OFF to build without frozen modules")
+    endif()
+
+    find_program(BASALT_MPY_CROSS mpy-cross)
+    if(BASALT_MPY_CROSS)
+        set(_mpy_cross "${BASALT_MPY_CROSS}")
+        set(_mpy_cross_dep "")
+    else()
+        set(_mpy_cross "${_mpy_dir}/mpy-cross/build/mpy-cross")
+        set(_mpy_cross_dep "${_mpy_cross}")
+        add_custom_command(
+            OUTPUT "${_mpy_cross}"
+            COMMAND make -C "${_mpy_dir}/mpy-cross"
+            COMMENT "Building mpy-cross from the micropython submodule"
+            VERBATIM
+        )
+    endif()
+
+    execute_process(
+        COMMAND "${_python}" "${_freeze}" --manifest "${_manifest}" --list-inputs
+        OUTPUT_VARIABLE _frozen_inputs
+        ERROR_VARIABLE _frozen_err
+        RESULT_VARIABLE _frozen_rc
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+    )
+    if(NOT _frozen_rc EQUAL 0)
+        message(FATAL_ERROR "freeze_mpy.py: ${_frozen_err}")
+    endif()
+    string(REPLACE "\n" ";" _frozen_inputs "${_frozen_inputs}")
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${_frozen_inputs})
+
+    set(_frozen_c "${CMAKE_CURRENT_BINARY_DIR}/frozen_content.c")
+    add_custom_command(
+        OUTPUT "${_frozen_c}"
+        COMMAND "${_python}" "${_freeze}" --manifest "${_manifest}" --mpy-cross "${_mpy_cross}"
+                --mpy-tool "${_mpy_dir}/tools/mpy-tool.py" --out "${_frozen_c}"
+        DEPENDS ${_frozen_inputs} ${_mpy_cross_dep} "${_freeze}"
+                "${CMAKE_CURRENT_LIST_DIR}/genhdr/qstrdefs.generated.h" "${CMAKE_CURRENT_LIST_DIR}/mpconfigport.h"
+        COMMENT "Freezing MicroPython modules and apps"
+        VERBATIM
+    )
+    target_sources(${COMPONENT_LIB} PRIVATE "${_frozen_c}")
+    set_source_files_properties("${_frozen_c}" PROPERTIES COMPILE_FLAGS "-Wno-error -Wno-unused-parameter")
+    target_compile_definitions(${COMPONENT_LIB} PUBLIC BASALT_MPY_FROZEN=1)
+endif()
+
+if(BASALT_MPY_NATIVE_EMIT)
+    target_compile_definitions(${COMPONENT_LIB} PUBLIC BASALT_MPY_NATIVE=1)
+endif()
+
 # Reduce warnings from upstream MicroPython sources
 set_source_files_properties(${MPY_SRCS} PROPERTIES COMPILE_FLAGS "-Wno-error -Wno-unused-parameter -Wno-unused-function")
@@ -15,6 +15,7 @@ extern "C" {
 
 typedef enum {
     RUNTIME_OK = 0,
+    RUNTIME_ENOENT = -2,
     RUNTIME_EINVAL = -22,
     RUNTIME_ENOSYS = -38,
     RUNTIME_EIO = -5,
@@ -103,8 +104,15 @@ int rt_fs_rename(const char *old_path, const char *new_path);
 // -----------------------------
 // Key/Value (optional; maps to NVS, flash kv, etc.)
 // -----------------------------
+// Sets and deletes land in a RAM cache; rt_kv_commit writes everything
+// changed since the last flash write in one go. Commits closer together than
+// the coalescing window are deferred and merged, so a burst costs one write.
+// The cache holds BASALT_KV_CACHE_ENTRIES keys; once all of them carry
+// uncommitted changes, touching another key fails with RUNTIME_ENOMEM until
+// the next commit.
 int rt_kv_init(void);
 int rt_kv_get(const char *key, void *buf, size_t *len_inout);    // if buf==NULL -> returns required len in *len_inout
+                                                                  // RUNTIME_ENOENT if absent, EINVAL if buf too small
 int rt_kv_set(const char *key, const void *buf, size_t len);
 int rt_kv_del(const char *key);
 int rt_kv_commit(void);
@@ -117,6 +125,9 @@ typedef enum {
     RT_EVT_KEY,         // keyboard/console keypress events (optional)
     RT_EVT_TIMER,       // periodic runtime timer callback tick
     RT_EVT_USER,        // generic user/system event
+    RT_EVT_TOUCH,       // touch panel: code=press/move/release, a=x, b=y
+    RT_EVT_DIAG,        // diagnostics/benchmark traffic; not in the default subscription
+    RT_EVT_TYPE_COUNT,  // types are < 32 so they fit a subscription mask
 } rt_event_type_t;
 
 typedef struct {
@@ -126,12 +137,31 @@ typedef struct {
     void *ptr;
 } rt_event_t;
 
-// Post an event into the OS event queue (thread-safe if enabled).
+// Create the event bus and its default subscriber; post/poll return
+// RUNTIME_ENOSYS before this.
+int rt_event_init(void);
+
+// Post an event to every subscriber whose mask has its type. Lock-free and
+// callable from tasks and ISRs, including IRAM (ESP_INTR_FLAG_IRAM) ones.
+// Input types (KEY, TOUCH) use a priority lane that is drained first. A full
+// lane drops its oldest event.
 int rt_event_post(const rt_event_t *evt);
 
 // Poll next event; returns 1 if event, 0 if timeout, negative error.
+// A task notification to the polling task (e.g. a stop request) also ends the
+// wait early with 0, so callers re-check their own deadline.
+#define RT_EVENT_WAIT_FOREVER UINT32_MAX
 int rt_event_poll(rt_event_t *evt, uint32_t timeout_ms);
 
+// Fan-out: each subscriber has its own lanes, so the shell, the runtime and
+// drivers each see every event they subscribed to. rt_event_poll reads the
+// default subscriber (all types but RT_EVT_DIAG). Block in poll from one task
+// per subscriber at a time.
+#define RT_EVENT_MASK(type) (1u << (type))
+int rt_event_subscribe(uint32_t type_mask);   // subscriber id, or negative error
+int rt_event_unsubscribe(int sub);
+int rt_event_poll_sub(int sub, rt_event_t *evt, uint32_t timeout_ms);
+
 // -----------------------------
 // Runtime registration / command surface
 // -----------------------------
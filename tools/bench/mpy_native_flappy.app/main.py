@@ -0,0 +1,148 @@
+# Interpreted vs native vs viper timing of the flappy_bird.app frame step
+# (physics, pipe scroll, scoring, collisions) with drawing left out, since
+# drawing runs in C either way.
+#
+# Needs firmware built with -DBASALT_MPY_NATIVE_EMIT=ON; without the native
+# emitters the decorators below are a compile error.
+
+import basalt
+
+FRAMES = 5000
+ROUNDS = 3
+
+
+# The three step functions share one body; only the decorator and, for viper,
+# the annotations differ. Constants are inlined from the flappy_bird.app TFT
+# layout (Y0 32, H 180, floor 14, bird x 65 r 5, pipe 18 wide, gap 54, speed
+# 3, flap -7) because viper treats globals as objects. Randomness is a 16-bit
+# LCG so every variant plays the same game and returns the same result.
+def step_py(frames, seed):
+    bird_y = 122
+    bird_vy = 0
+    pipe_x = 234
+    gap = 100
+    passed = 0
+    score = 0
+    hits = 0
+    for _ in range(frames):
+        seed = (seed * 75 + 74) & 0xFFFF
+        if bird_y > gap + 1 and (seed & 7) == 0:
+            bird_vy = -7
+        bird_vy += 1
+        bird_y += bird_vy
+        pipe_x -= 3
+        if pipe_x + 18 < 10:
+            pipe_x = 238 + (seed & 15)
+            gap = 40 + (seed & 127)
+            passed = 0
+        gap_top = gap - 27
+        gap_bottom = gap + 27
+        if passed == 0 and pipe_x + 18 < 65:
+            passed = 1
+            score += 1
+        hit = bird_y - 5 <= 32 or bird_y + 5 >= 198
+        if 70 >= pipe_x and 60 <= pipe_x + 18:
+            if bird_y - 5 <= gap_top or bird_y + 5 >= gap_bottom:
+                hit = True
+        if hit:
+            hits += 1
+            bird_y = gap
+            bird_vy = 0
+    return score * 10000 + hits
+
+
+@micropython.native
+def step_native(frames, seed):
+    bird_y = 122
+    bird_vy = 0
+    pipe_x = 234
+    gap = 100
+    passed = 0
+    score = 0
+    hits = 0
+    for _ in range(frames):
+        seed = (seed * 75 + 74) & 0xFFFF
+        if bird_y > gap + 1 and (seed & 7) == 0:
+            bird_vy = -7
+        bird_vy += 1
+        bird_y += bird_vy
+        pipe_x -= 3
+        if pipe_x + 18 < 10:
+            pipe_x = 238 + (seed & 15)
+            gap = 40 + (seed & 127)
+            passed = 0
+        gap_top = gap - 27
+        gap_bottom = gap + 27
+        if passed == 0 and pipe_x + 18 < 65:
+            passed = 1
+            score += 1
+        hit = bird_y - 5 <= 32 or bird_y + 5 >= 198
+        if 70 >= pipe_x and 60 <= pipe_x + 18:
+            if bird_y - 5 <= gap_top or bird_y + 5 >= gap_bottom:
+                hit = True
+        if hit:
+            hits += 1
+            bird_y = gap
+            bird_vy = 0
+    return score * 10000 + hits
+
+
+@micropython.viper
+def step_viper(frames: int, seed: int) -> int:
+    bird_y = 122
+    bird_vy = 0
+    pipe_x = 234
+    gap = 100
+    passed = 0
+    score = 0
+    hits = 0
+    for _ in range(frames):
+        seed = (seed * 75 + 74) & 0xFFFF
+        if bird_y > gap + 1 and (seed & 7) == 0:
+            bird_vy = -7
+        bird_vy += 1
+        bird_y += bird_vy
+        pipe_x -= 3
+        if pipe_x + 18 < 10:
+            pipe_x = 238 + (seed & 15)
+            gap = 40 + (seed & 127)
+            passed = 0
+        gap_top = gap - 27
+        gap_bottom = gap + 27
+        if passed == 0 and pipe_x + 18 < 65:
+            passed = 1
+            score += 1
+        hit = 0
+        if bird_y - 5 <= 32 or bird_y + 5 >= 198:
+            hit = 1
+        if 70 >= pipe_x and 60 <= pipe_x + 18:
+            if bird_y - 5 <= gap_top or bird_y + 5 >= gap_bottom:
+                hit = 1
+        if hit:
+            hits += 1
+            bird_y = gap
+            bird_vy = 0
+    return score * 10000 + hits
+
+
+def bench(name, fn, base_us):
+    best = 0
+    result = 0
+    for _ in range(ROUNDS):
+        t0 = basalt.timer.ticks_us()
+        result = fn(FRAMES, 1)
+        us = basalt.timer.ticks_diff(basalt.timer.ticks_us(), t0)
+        if best == 0 or us < best:
+            best = us
+    line = name + ": " + str(best) + " us, " + str(best * 1000 // FRAMES) + " ns/frame"
+    if base_us:
+        line += ", x" + str(base_us * 10 // best // 10) + "." + str(base_us * 10 // best % 10)
+    print(line, "result", result)
+    return best
+
+
+print("[mpy_native_flappy] " + str(FRAMES) + " frames, best of " + str(ROUNDS))
+base = bench("interpreted", step_py, 0)
+bench("native", step_native, base)
+bench("viper", step_viper, base)
+print("[mpy_native_flappy] done")
@@ -1206,6 +1206,10 @@ def emit_basalt_config_h(
             led_active_low = bool(board_data.get("led_active_low"))
             board_setting_lines.append(f"#define BASALT_LED_ACTIVE_LOW {1 if led_active_low else 0}")
 
+        mpy_heap_kb = board_data.get("mpy_heap_kb")
+        if isinstance(mpy_heap_kb, int) and not isinstance(mpy_heap_kb, bool) and mpy_heap_kb > 0:
+            board_setting_lines.append(f"#define BASALT_MPY_HEAP_KB {mpy_heap_kb}")
+
         if board_setting_lines:
             lines.append("/* Board-level settings */")
             lines.extend(board_setting_lines)
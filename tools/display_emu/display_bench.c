@@ -0,0 +1,549 @@
+// Drives main/tft_console.c against the panel model and reports SPI traffic
+// per drawing operation.
+//
+//   display_bench [--png-dir DIR] [--baseline FILE] [--write-baseline FILE]
+//
+// --baseline fails (exit 1) when any operation's transactions, bytes or
+// window commands grow more than 10% over the recorded value, or when a pixel
+// check fails. Timing columns are host wall clock and never compared.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_heap_caps.h"
+#include "emu_runtime.h"
+#include "panel_model.h"
+#include "tft_console.h"
+
+#if defined(DISPLAY_EMU_BOARD_M5STICKC_PLUS2)
+#define BENCH_BOARD "m5stickc_plus2"
+#define BENCH_PANEL "st7789"
+#define BENCH_GRAM_W 240
+#define BENCH_GRAM_H 320
+#define BENCH_VIS_X 52
+#define BENCH_VIS_Y 40
+#define BENCH_W 135
+#define BENCH_H 240
+#else
+#define BENCH_BOARD "cyd_3248s035r"
+#define BENCH_PANEL "st7796"
+#define BENCH_GRAM_W 320
+#define BENCH_GRAM_H 480
+#define BENCH_VIS_X 0
+#define BENCH_VIS_Y 0
+#define BENCH_W 320
+#define BENCH_H 480
+#endif
+
+#define BENCH_SPI_HZ 10000000.0  // BASALT_TFT_CLK_HZ
+#define BENCH_MAX_OPS 32
+#define BENCH_TOLERANCE 1.10
+
+#define RED 0xF800
+#define GREEN 0x07E0
+#define BLUE 0x001F
+#define WHITE 0xFFFF
+#define BLACK 0x0000
+
+typedef struct {
+    const char *name;
+    panel_counters_t count;
+    double host_us;
+} bench_result_t;
+
+static panel_model_t s_panel;
+static bench_result_t s_results[BENCH_MAX_OPS];
+static int s_result_count = 0;
+static int s_failures = 0;
+static const char *s_png_dir = NULL;
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// The driver streams native little-endian uint16 buffers, so the panel sees
+// the low byte first.
+static uint16_t wire(uint16_t color) {
+    return (uint16_t)((color << 8) | (color >> 8));
+}
+
+static void expect_pixel(const char *op, int x, int y, uint16_t color) {
+    uint16_t got = panel_model_pixel(&s_panel, x, y);
+    if (got != wire(color)) {
+        fprintf(stderr, "FAIL %s: pixel (%d,%d) wire=0x%04x want 0x%04x\n", op, x, y, got, wire(color));
+        s_failures++;
+    }
+}
+
+static void expect(const char *op, int cond, const char *what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL %s: %s\n", op, what);
+        s_failures++;
+    }
+}
+
+static void snapshot(const char *op) {
+    if (!s_png_dir) return;
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s_%s.png", s_png_dir, BENCH_BOARD, op);
+    if (!panel_model_write_png(&s_panel, path)) {
+        fprintf(stderr, "FAIL %s: cannot write %s\n", op, path);
+        s_failures++;
+    }
+}
+
+typedef void (*bench_fn_t)(const char *op);
+
+static void run_op(const char *op, bench_fn_t fn) {
+    memset(&s_panel.count, 0, sizeof(s_panel.count));
+    double t0 = now_us();
+    fn(op);
+    tft_console_flush();
+    double t1 = now_us();
+    if (s_result_count < BENCH_MAX_OPS) {
+        bench_result_t *r = &s_results[s_result_count++];
+        r->name = op;
+        r->count = s_panel.count;
+        r->host_us = t1 - t0;
+    }
+    snapshot(op);
+}
+
+// --- Operations -----------------------------------------------------------
+
+static void op_init(const char *op) {
+    expect(op, tft_console_init(), "tft_console_init failed");
+    expect(op, s_panel.display_on, "display not switched on");
+}
+
+static void op_clear(const char *op) {
+    tft_console_clear();
+    expect_pixel(op, 0, 0, BLACK);
+    expect_pixel(op, BENCH_W - 1, BENCH_H - 1, BLACK);
+}
+
+static void op_console_text(const char *op) {
+    char line[64];
+    // Enough lines to scroll the console a few times over.
+    for (int i = 0; i < BENCH_H / 8 + 4; ++i) {
+        snprintf(line, sizeof(line), "line %02d: the quick brown fox\n", i);
+        tft_console_write(line);
+    }
+    (void)op;
+}
+
+static void op_scrollback_page(const char *op) {
+    expect(op, tft_console_scrollback_capacity() > 0, "scrollback not allocated");
+    tft_console_view_page(1);
+    expect(op, tft_console_view_offset() > 0, "view did not scroll back");
+    // Output while scrolled back must not reach the panel.
+    uint16_t before = panel_model_pixel(&s_panel, 0, BENCH_H - 8);
+    tft_console_write("hidden\n");
+    expect(op, panel_model_pixel(&s_panel, 0, BENCH_H - 8) == before, "live output painted over history");
+    tft_console_view_live();
+    expect(op, tft_console_view_offset() == 0, "view did not return to live");
+}
+
+static void expect_cell_blank(const char *op, int col, int row) {
+    for (int y = row * 8; y < row * 8 + 8; ++y) {
+        for (int x = col * 6; x < col * 6 + 6; ++x) {
+            if (panel_model_pixel(&s_panel, x, y) != wire(BLACK)) {
+                fprintf(stderr, "FAIL %s: cell (%d,%d) not blank\n", op, col, row);
+                s_failures++;
+                return;
+            }
+        }
+    }
+}
+
+static void op_console_ansi(const char *op) {
+    // 'H' lights the whole first glyph column, so x = col * 6 samples the colour.
+    tft_console_write("\x1b[2J\x1b[3;5H\x1b[31mH\x1b[1mH\x1b[38;5;21mH\x1b[0mH");
+    tft_console_write("\x1b[4;1H\x1b[3");
+    tft_console_write("2mH\x1b[0m");  // sequence split across writes
+    tft_console_write("\x1b[5;1Hgone\r\x1b[K\n");
+    tft_console_flush();
+    expect_cell_blank(op, 0, 0);
+    expect_cell_blank(op, 0, 4);
+    expect_pixel(op, 4 * 6, 2 * 8 + 4, RED);
+    expect_pixel(op, 5 * 6, 2 * 8 + 4, 0xFB2C);
+    expect_pixel(op, 6 * 6, 2 * 8 + 4, BLUE);
+    expect_pixel(op, 7 * 6, 2 * 8 + 4, WHITE);
+    expect_pixel(op, 0, 3 * 8 + 4, GREEN);
+}
+
+static void op_fill_rect(const char *op) {
+    tft_console_draw_rect(10, 10, 60, 40, RED, true);
+    expect_pixel(op, 10, 10, RED);
+    expect_pixel(op, 69, 49, RED);
+}
+
+static void op_rect_outline(const char *op) {
+    tft_console_draw_rect(10, 60, 60, 40, GREEN, false);
+    expect_pixel(op, 10, 60, GREEN);
+    expect_pixel(op, 69, 99, GREEN);
+}
+
+static void op_lines(const char *op) {
+    for (int i = 0; i < 8; ++i) {
+        tft_console_draw_line(0, 110 + i * 4, BENCH_W - 1, 130 + i * 4, BLUE);
+    }
+    tft_console_draw_line(5, 110, 5, 150, WHITE);
+    expect_pixel(op, 0, 110, BLUE);
+    expect_pixel(op, 5, 150, WHITE);
+}
+
+static void op_circle(const char *op) {
+    tft_console_draw_circle(BENCH_W / 2, 180, 25, WHITE, false);
+    expect_pixel(op, BENCH_W / 2, 155, WHITE);
+}
+
+static void op_circle_fill(const char *op) {
+    tft_console_draw_circle(BENCH_W / 2, 180, 20, RED, true);
+    expect_pixel(op, BENCH_W / 2, 180, RED);
+}
+
+static void op_ellipse_fill(const char *op) {
+    tft_console_draw_ellipse(BENCH_W / 2, 225, BENCH_W / 3, 12, GREEN, true);
+    expect_pixel(op, BENCH_W / 2, 225, GREEN);
+}
+
+static void op_blit(const char *op) {
+    static uint16_t img[32 * 32];
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            img[y * 32 + x] = (uint16_t)(((x & 31) << 11) | ((y * 2) << 5));
+        }
+    }
+    tft_console_blit(4, 4, 32, 32, img);
+    expect_pixel(op, 4 + 31, 4 + 17, img[17 * 32 + 31]);
+}
+
+static void op_pixels(const char *op) {
+    // A 24-pixel row run and a scatter of coloured points in one batch.
+    static int16_t run[24 * 2];
+    for (int i = 0; i < 24; ++i) {
+        run[i * 2] = (int16_t)(100 + i);
+        run[i * 2 + 1] = 4;
+    }
+    tft_console_draw_pixels(run, 24, false, WHITE);
+    static int16_t dots[64 * 3];
+    for (int i = 0; i < 64; ++i) {
+        dots[i * 3] = (int16_t)(100 + (i * 7) % 40);
+        dots[i * 3 + 1] = (int16_t)(8 + (i * 5) % 20);
+        dots[i * 3 + 2] = (int16_t)((i & 1) ? RED : GREEN);
+    }
+    tft_console_draw_pixels(dots, 64, true, 0);
+    expect_pixel(op, 100, 4, WHITE);
+    expect_pixel(op, 123, 4, WHITE);
+    expect_pixel(op, 107, 13, RED);
+}
+
+static void op_blit_indexed(const char *op) {
+    static const uint16_t pal[4] = {BLACK, RED, GREEN, BLUE};
+    uint8_t data[16 * 8 / 4];
+    for (int i = 0; i < (int)sizeof(data); ++i) data[i] = 0x1B;  // 0,1,2,3
+    // Index 0 is the colour key and leaves the panel untouched.
+    tft_console_draw_rect(40, 4, 16, 8, WHITE, true);
+    tft_console_blit_indexed(40, 4, 16, 8, data, 2, pal, 4, 0);
+    expect_pixel(op, 40, 4, WHITE);
+    expect_pixel(op, 41, 4, RED);
+    expect_pixel(op, 43, 11, BLUE);
+}
+
+static void op_blit_rle(const char *op) {
+    // 40 red, 8 literals (alternating green/blue), 40 red, per 88-pixel row.
+    uint8_t data[6 * 24];
+    size_t n = 0;
+    for (int row = 0; row < 6; ++row) {
+        data[n++] = 0x80 | 39;
+        data[n++] = RED & 0xFF;
+        data[n++] = RED >> 8;
+        data[n++] = 7;
+        for (int i = 0; i < 8; ++i) {
+            uint16_t c = (i & 1) ? BLUE : GREEN;
+            data[n++] = c & 0xFF;
+            data[n++] = c >> 8;
+        }
+        data[n++] = 0x80 | 39;
+        data[n++] = RED & 0xFF;
+        data[n++] = RED >> 8;
+    }
+    tft_console_blit_rle(0, 40, 88, 6, data, n, -1);
+    expect_pixel(op, 0, 40, RED);
+    expect_pixel(op, 41, 45, BLUE);
+    expect_pixel(op, 87, 45, RED);
+}
+
+static void op_text_opaque(const char *op) {
+    const tft_font_t *small = tft_font_builtin("small");
+    expect(op, small && tft_font_height(small) == 8, "small font missing");
+    const int y = BENCH_H - 180;
+    int w = tft_console_draw_text(20, y, "Hello, BasaltOS 0123", small, 1, RED, BLUE);
+    expect(op, w == tft_font_text_width(small, "Hello, BasaltOS 0123"), "width mismatch");
+    // 'H': both outer columns lit, the middle one only on the bar row.
+    expect_pixel(op, 20, y + 3, RED);
+    expect_pixel(op, 22, y + 1, BLUE);
+    expect_pixel(op, 22, y + 3, RED);
+}
+
+static void op_text_transparent(const char *op) {
+    const tft_font_t *large = tft_font_builtin("large");
+    expect(op, large && tft_font_height(large) == 24, "large font missing");
+    const int y = BENCH_H - 160;
+    uint16_t gap = panel_model_pixel(&s_panel, 20 + 6, y + 3);
+    tft_console_draw_text(20, y, "Hi", large, 1, GREEN, -1);
+    expect_pixel(op, 20, y + 10, GREEN);
+    expect(op, panel_model_pixel(&s_panel, 20 + 6, y + 3) == gap, "transparent text painted background");
+}
+
+static void op_text_file(const char *op) {
+    // Round-trip the medium font through a file to cover the on-demand path.
+    char path[] = "/tmp/display_bench_fontXXXXXX";
+    int fd = mkstemp(path);
+    expect(op, fd >= 0, "mkstemp failed");
+    if (fd < 0) return;
+    FILE *f = fdopen(fd, "wb");
+    for (int i = 0; i < tft_font_builtin_count; ++i) {
+        if (strcmp(tft_font_builtins[i].name, "medium") == 0) {
+            fwrite(tft_font_builtins[i].data, 1, tft_font_builtins[i].len, f);
+        }
+    }
+    fclose(f);
+    tft_font_t *font = tft_font_open(path);
+    expect(op, font != NULL, "tft_font_open failed");
+    if (font) {
+        tft_console_draw_text(0, BENCH_H - 120, "Scale 2x", font, 2, WHITE, BLACK);
+        expect_pixel(op, 0, BENCH_H - 120 + 4, WHITE);
+        tft_font_close(font);
+    }
+    remove(path);
+}
+
+static void canvas_scene(const char *op, const char *want_mode) {
+    expect(op, tft_console_canvas_begin(), "canvas_begin failed");
+    expect(op, strcmp(tft_console_canvas_mode(), want_mode) == 0, "unexpected canvas mode");
+    uint16_t before = panel_model_pixel(&s_panel, BENCH_W / 2, BENCH_H / 2 + 10);
+    for (int i = 0; i < 6; ++i) {
+        tft_console_draw_rect(8 + i * 12, BENCH_H / 2 - 30 + i * 6, 40, 40, (uint16_t)(BLUE << i), true);
+    }
+    tft_console_draw_circle(BENCH_W / 2, BENCH_H / 2, 20, RED, true);
+    tft_console_draw_line(0, BENCH_H / 2 + 30, BENCH_W - 1, BENCH_H / 2 - 30, WHITE);
+    expect(op, panel_model_pixel(&s_panel, BENCH_W / 2, BENCH_H / 2 + 10) == before,
+           "canvas drawing reached the panel before flush");
+    tft_console_canvas_flush();
+    expect_pixel(op, BENCH_W / 2, BENCH_H / 2 + 10, RED);
+    tft_console_canvas_end();
+}
+
+static void op_canvas_full(const char *op) {
+    emu_set_psram(1);
+    canvas_scene(op, "full");
+}
+
+static void op_canvas_band(const char *op) {
+    emu_set_psram(0);
+    canvas_scene(op, "band");
+    emu_set_psram(1);
+}
+
+// More ops and pixel data than the band display list starts with: it has to
+// grow rather than send part of the frame early.
+static void op_canvas_band_large(const char *op) {
+    enum { SPRITE = 96 };
+    static uint16_t sprite[SPRITE * SPRITE];
+    for (int i = 0; i < SPRITE * SPRITE; ++i) sprite[i] = (i & 1) ? GREEN : RED;
+    emu_set_psram(0);
+    expect(op, tft_console_canvas_begin(), "canvas_begin failed");
+    expect(op, strcmp(tft_console_canvas_mode(), "band") == 0, "unexpected canvas mode");
+    uint64_t before = s_panel.count.bytes;
+    for (int i = 0; i < 600; ++i) {
+        tft_console_draw_rect((i * 7) % (BENCH_W - 4), (i * 13) % (BENCH_H - 4), 4, 4, (uint16_t)i, true);
+    }
+    tft_console_blit(1, 1, SPRITE, SPRITE, sprite);
+    expect(op, s_panel.count.bytes == before, "band list was sent before flush");
+    tft_console_canvas_flush();
+    expect_pixel(op, 1, 1, RED);
+    expect_pixel(op, 2, 1, GREEN);
+    tft_console_canvas_end();
+    emu_set_psram(1);
+}
+
+// Enough ops that the band list spills mid-frame while a keyed indexed blit
+// is sending rows out of the driver's line buffer. The frame must match the
+// same scene drawn without a canvas.
+static void spill_scene(void) {
+    static const uint16_t pal[4] = {BLACK, RED, GREEN, WHITE};
+    static uint8_t stripes[64 * 64 / 4];
+    // 2 px runs of index 1/2 between 2 px of key 0: 16 ops per row.
+    for (int i = 0; i < (int)sizeof(stripes); ++i) stripes[i] = (i & 1) ? 0x0A : 0x05;
+    for (int i = 0; i < 2600; ++i) {
+        tft_console_draw_rect(1 + (i * 6) % (BENCH_W - 72), (i * 13) % (BENCH_H - 4), 65, 2, (uint16_t)(i * 97), true);
+    }
+    tft_console_blit_indexed(31, 21, 64, 64, stripes, 2, pal, 4, 0);
+}
+
+static void op_canvas_band_spill(const char *op) {
+    tft_console_clear();
+    spill_scene();
+    tft_console_flush();
+    uint16_t *want = malloc(sizeof(uint16_t) * BENCH_W * BENCH_H);
+    if (!want) return;
+    for (int y = 0; y < BENCH_H; ++y) {
+        for (int x = 0; x < BENCH_W; ++x) want[y * BENCH_W + x] = panel_model_pixel(&s_panel, x, y);
+    }
+    tft_console_clear();
+    tft_console_flush();
+    emu_set_psram(0);
+    expect(op, tft_console_canvas_begin(), "canvas_begin failed");
+    uint64_t before = s_panel.count.bytes;
+    spill_scene();
+    expect(op, s_panel.count.bytes != before, "scene did not spill the band list");
+    tft_console_canvas_end();
+    emu_set_psram(1);
+    int bad = 0;
+    for (int y = 0; y < BENCH_H; ++y) {
+        for (int x = 0; x < BENCH_W; ++x) {
+            if (panel_model_pixel(&s_panel, x, y) != want[y * BENCH_W + x] && bad++ == 0) {
+                fprintf(stderr, "FAIL %s: first mismatch at (%d,%d)\n", op, x, y);
+            }
+        }
+    }
+    expect(op, bad == 0, "spilled frame differs from direct drawing");
+    free(want);
+}
+
+// --- Reporting ------------------------------------------------------------
+
+static void print_table(void) {
+    printf("board %s (%s %dx%d)\n", BENCH_BOARD, BENCH_PANEL, BENCH_W, BENCH_H);
+    printf("%-16s %8s %10s %7s %7s %9s %9s %9s\n",
+           "op", "trans", "bytes", "window", "ramwr", "pixels", "spi_ms", "host_us");
+    for (int i = 0; i < s_result_count; ++i) {
+        const bench_result_t *r = &s_results[i];
+        double spi_ms = (double)r->count.bytes * 8.0 / BENCH_SPI_HZ * 1000.0;
+        printf("%-16s %8llu %10llu %7llu %7llu %9llu %9.2f %9.0f\n", r->name,
+               (unsigned long long)r->count.transactions, (unsigned long long)r->count.bytes,
+               (unsigned long long)r->count.window_cmds, (unsigned long long)r->count.ramwr,
+               (unsigned long long)r->count.pixels, spi_ms, r->host_us);
+    }
+}
+
+static bool write_baseline(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "# display_bench baseline: op transactions bytes window_cmds (%s)\n", BENCH_BOARD);
+    for (int i = 0; i < s_result_count; ++i) {
+        const bench_result_t *r = &s_results[i];
+        fprintf(f, "%s %llu %llu %llu\n", r->name, (unsigned long long)r->count.transactions,
+                (unsigned long long)r->count.bytes, (unsigned long long)r->count.window_cmds);
+    }
+    return fclose(f) == 0;
+}
+
+static const bench_result_t *find_result(const char *name) {
+    for (int i = 0; i < s_result_count; ++i) {
+        if (strcmp(s_results[i].name, name) == 0) return &s_results[i];
+    }
+    return NULL;
+}
+
+static void check_metric(const char *op, const char *metric, unsigned long long got, unsigned long long base) {
+    if ((double)got > (double)base * BENCH_TOLERANCE) {
+        fprintf(stderr, "REGRESSION %s: %s %llu > baseline %llu (+10%%)\n", op, metric, got, base);
+        s_failures++;
+    }
+}
+
+static bool compare_baseline(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        char name[64];
+        unsigned long long trans, bytes, win;
+        if (sscanf(line, "%63s %llu %llu %llu", name, &trans, &bytes, &win) != 4) continue;
+        const bench_result_t *r = find_result(name);
+        if (!r) {
+            fprintf(stderr, "REGRESSION %s: operation missing from run\n", name);
+            s_failures++;
+            continue;
+        }
+        check_metric(name, "transactions", r->count.transactions, trans);
+        check_metric(name, "bytes", r->count.bytes, bytes);
+        check_metric(name, "window_cmds", r->count.window_cmds, win);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *baseline = NULL;
+    const char *write_path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--png-dir") == 0 && i + 1 < argc) {
+            s_png_dir = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline = argv[++i];
+        } else if (strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+            write_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--png-dir DIR] [--baseline FILE] [--write-baseline FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (!panel_model_init(&s_panel, BENCH_PANEL, BENCH_GRAM_W, BENCH_GRAM_H,
+                          BENCH_VIS_X, BENCH_VIS_Y, BENCH_W, BENCH_H)) {
+        fprintf(stderr, "panel model allocation failed\n");
+        return 2;
+    }
+    emu_attach_panel(&s_panel);
+
+    run_op("init", op_init);
+    run_op("clear", op_clear);
+    run_op("console_text", op_console_text);
+    run_op("scrollback_page", op_scrollback_page);
+    run_op("console_ansi", op_console_ansi);
+    run_op("fill_rect", op_fill_rect);
+    run_op("rect_outline", op_rect_outline);
+    run_op("lines", op_lines);
+    run_op("circle", op_circle);
+    run_op("circle_fill", op_circle_fill);
+    run_op("ellipse_fill", op_ellipse_fill);
+    run_op("blit", op_blit);
+    run_op("pixels", op_pixels);
+    run_op("blit_indexed", op_blit_indexed);
+    run_op("blit_rle", op_blit_rle);
+    run_op("text_opaque", op_text_opaque);
+    run_op("text_transparent", op_text_transparent);
+    run_op("text_file", op_text_file);
+    run_op("canvas_full", op_canvas_full);
+    run_op("canvas_band", op_canvas_band);
+    run_op("canvas_band_large", op_canvas_band_large);
+    run_op("canvas_band_spill", op_canvas_band_spill);
+
+    print_table();
+
+    if (write_path && !write_baseline(write_path)) {
+        fprintf(stderr, "cannot write %s\n", write_path);
+        s_failures++;
+    }
+    if (baseline && !compare_baseline(baseline)) {
+        fprintf(stderr, "cannot read %s\n", baseline);
+        s_failures++;
+    }
+
+    emu_attach_panel(NULL);
+    panel_model_free(&s_panel);
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,290 @@
+// Host implementations of the ESP-IDF / FreeRTOS calls made by
+// main/tft_console.c. SPI traffic to the TFT chip select is decoded by the
+// active panel model; everything else is inert.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "basalt_config.h"
+#include "bus_manager.h"
+#include "emu_runtime.h"
+
+#define EMU_MAX_GPIO 64
+#define EMU_QUEUE_DEPTH 16
+
+struct emu_spi_device {
+    int cs;
+    bool panel;
+    spi_transaction_t *done[EMU_QUEUE_DEPTH];
+    int head;
+    int count;
+};
+
+static panel_model_t *s_panel = NULL;
+static int s_gpio_level[EMU_MAX_GPIO];
+static int s_psram = 1;
+static int s_verbose = -1;
+static TickType_t s_ticks = 0;
+
+void emu_attach_panel(panel_model_t *panel) {
+    s_panel = panel;
+}
+
+void emu_set_psram(int available) {
+    s_psram = available;
+}
+
+void emu_log(char level, const char *tag, const char *fmt, ...) {
+    if (s_verbose < 0) s_verbose = getenv("DISPLAY_EMU_VERBOSE") != NULL;
+    if (!s_verbose) return;
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%c (%s) ", level, tag);
+    vfprintf(stderr, fmt, ap);
+    fputc('\n', stderr);
+    va_end(ap);
+}
+
+const char *esp_err_to_name(esp_err_t err) {
+    return err == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void *heap_caps_malloc(size_t size, unsigned caps) {
+    if ((caps & MALLOC_CAP_SPIRAM) && !s_psram) return NULL;
+    return malloc(size);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, unsigned caps) {
+    if ((caps & MALLOC_CAP_SPIRAM) && !s_psram) return NULL;
+    return realloc(ptr, size);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(unsigned caps) {
+    // Reports a 4 MB PSRAM part when enabled; internal RAM is not modelled.
+    if (caps & MALLOC_CAP_SPIRAM) return s_psram ? 4u * 1024 * 1024 : 0;
+    return 256u * 1024;
+}
+
+size_t heap_caps_get_largest_free_block(unsigned caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+// --- FreeRTOS -------------------------------------------------------------
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *out) {
+    (void)fn;
+    (void)name;
+    (void)stack;
+    (void)arg;
+    (void)prio;
+    if (out) *out = NULL;
+    return pdFAIL;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    s_ticks += ticks;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return s_ticks;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return NULL;
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+    (void)task;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    (void)task;
+    if (woken) *woken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    (void)clear;
+    (void)ticks;
+    return 0;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    static int token;
+    return &token;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    (void)sem;
+    (void)ticks;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    (void)sem;
+    return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item_size) {
+    (void)len;
+    (void)item_size;
+    static int token;
+    return &token;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    (void)q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+    (void)q;
+    (void)item;
+    (void)ticks;
+    return pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+    (void)q;
+    (void)item;
+    (void)ticks;
+    return pdFALSE;
+}
+
+// --- GPIO -----------------------------------------------------------------
+
+esp_err_t gpio_config(const gpio_config_t *cfg) {
+    (void)cfg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level) {
+    if (pin >= 0 && pin < EMU_MAX_GPIO) s_gpio_level[pin] = level ? 1 : 0;
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin) {
+    // Inputs idle high (PENIRQ released).
+    if (pin < 0 || pin >= EMU_MAX_GPIO) return 1;
+    return s_gpio_level[pin];
+}
+
+esp_err_t gpio_install_isr_service(int flags) {
+    (void)flags;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t pin, gpio_isr_t fn, void *arg) {
+    (void)pin;
+    (void)fn;
+    (void)arg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t pin) {
+    (void)pin;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t pin) {
+    (void)pin;
+    return ESP_OK;
+}
+
+// --- SPI ------------------------------------------------------------------
+
+bool basalt_bus_spi_ensure(spi_host_device_t host, const spi_bus_config_t *cfg, int dma_chan,
+                           const char *owner, char *err, size_t err_len) {
+    (void)host;
+    (void)cfg;
+    (void)dma_chan;
+    (void)owner;
+    if (err && err_len) err[0] = '\0';
+    return true;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *cfg,
+                             spi_device_handle_t *out) {
+    (void)host;
+    struct emu_spi_device *dev = calloc(1, sizeof(*dev));
+    if (!dev) return ESP_ERR_NO_MEM;
+    dev->cs = cfg->spics_io_num;
+    dev->panel = cfg->spics_io_num == BASALT_PIN_TFT_CS;
+    *out = dev;
+    return ESP_OK;
+}
+
+static void emu_spi_exec(struct emu_spi_device *dev, spi_transaction_t *t) {
+    size_t nbytes = t->length / 8;
+    if (!dev->panel) {
+        // Touch controller: no pressure, all conversions read zero.
+        if (t->rx_buffer) memset(t->rx_buffer, 0, nbytes);
+        return;
+    }
+    if (!s_panel || !t->tx_buffer || nbytes == 0) return;
+    const uint8_t *tx = t->tx_buffer;
+    panel_model_begin_transaction(s_panel);
+    if (s_gpio_level[BASALT_PIN_TFT_DC] == 0) {
+        for (size_t i = 0; i < nbytes; i++) panel_model_command(s_panel, tx[i]);
+    } else {
+        panel_model_data(s_panel, tx, nbytes);
+    }
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t dev, spi_transaction_t *t) {
+    emu_spi_exec(dev, t);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t dev, spi_transaction_t *t) {
+    emu_spi_exec(dev, t);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t dev, spi_transaction_t *t, uint32_t ticks) {
+    (void)ticks;
+    if (dev->count == EMU_QUEUE_DEPTH) return ESP_FAIL;
+    // Completes immediately; DC is sampled at queue time as on hardware,
+    // where it is set before the transaction is handed to DMA.
+    emu_spi_exec(dev, t);
+    dev->done[(dev->head + dev->count) % EMU_QUEUE_DEPTH] = t;
+    dev->count++;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t dev, spi_transaction_t **t, uint32_t ticks) {
+    (void)ticks;
+    if (dev->count == 0) return ESP_FAIL;
+    if (t) *t = dev->done[dev->head];
+    dev->head = (dev->head + 1) % EMU_QUEUE_DEPTH;
+    dev->count--;
+    return ESP_OK;
+}
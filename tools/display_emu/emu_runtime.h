@@ -0,0 +1,7 @@
+#pragma once
+
+#include "panel_model.h"
+
+// Route TFT chip-select traffic into `panel` (NULL detaches). PSRAM
+// availability is toggled with emu_set_psram() from esp_heap_caps.h.
+void emu_attach_panel(panel_model_t *panel);
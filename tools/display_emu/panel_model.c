@@ -0,0 +1,168 @@
+#include "panel_model.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "png_writer.h"
+
+#define CMD_SWRESET 0x01
+#define CMD_DISPON  0x29
+#define CMD_CASET   0x2A
+#define CMD_RASET   0x2B
+#define CMD_RAMWR   0x2C
+#define CMD_MADCTL  0x36
+#define CMD_VSCRSADD 0x37
+#define CMD_COLMOD  0x3A
+
+#define MADCTL_BGR 0x08
+
+bool panel_model_init(panel_model_t *p, const char *name, int gram_w, int gram_h,
+                      int vis_x, int vis_y, int vis_w, int vis_h) {
+    memset(p, 0, sizeof(*p));
+    p->gram = calloc((size_t)gram_w * (size_t)gram_h, sizeof(uint16_t));
+    if (!p->gram) return false;
+    p->name = name;
+    p->gram_w = gram_w;
+    p->gram_h = gram_h;
+    p->vis_x = vis_x;
+    p->vis_y = vis_y;
+    p->vis_w = vis_w;
+    p->vis_h = vis_h;
+    p->xe = gram_w - 1;
+    p->ye = gram_h - 1;
+    p->pending_hi = -1;
+    return true;
+}
+
+void panel_model_free(panel_model_t *p) {
+    free(p->gram);
+    p->gram = NULL;
+}
+
+void panel_model_begin_transaction(panel_model_t *p) {
+    p->count.transactions++;
+}
+
+void panel_model_command(panel_model_t *p, uint8_t cmd) {
+    p->count.bytes++;
+    p->count.commands++;
+    p->cmd = cmd;
+    p->nparams = 0;
+    p->pending_hi = -1;
+    switch (cmd) {
+        case CMD_SWRESET:
+            p->madctl = 0;
+            p->vsa = 0;
+            p->display_on = false;
+            break;
+        case CMD_DISPON:
+            p->display_on = true;
+            break;
+        case CMD_CASET:
+        case CMD_RASET:
+            p->count.window_cmds++;
+            break;
+        case CMD_RAMWR:
+            p->count.ramwr++;
+            p->cx = p->xs;
+            p->cy = p->ys;
+            break;
+        case CMD_VSCRSADD:
+            p->count.vscroll++;
+            break;
+        default:
+            break;
+    }
+}
+
+static void put_pixel(panel_model_t *p, uint16_t v) {
+    if (p->cx >= 0 && p->cx < p->gram_w && p->cy >= 0 && p->cy < p->gram_h) {
+        p->gram[(size_t)p->cy * (size_t)p->gram_w + (size_t)p->cx] = v;
+    }
+    p->count.pixels++;
+    if (++p->cx > p->xe) {
+        p->cx = p->xs;
+        if (++p->cy > p->ye) {
+            p->cy = p->ys;
+        }
+    }
+}
+
+static void apply_params(panel_model_t *p) {
+    const uint8_t *v = p->params;
+    switch (p->cmd) {
+        case CMD_CASET:
+            if (p->nparams == 4) {
+                p->xs = (v[0] << 8) | v[1];
+                p->xe = (v[2] << 8) | v[3];
+            }
+            break;
+        case CMD_RASET:
+            if (p->nparams == 4) {
+                p->ys = (v[0] << 8) | v[1];
+                p->ye = (v[2] << 8) | v[3];
+            }
+            break;
+        case CMD_MADCTL:
+            if (p->nparams == 1) p->madctl = v[0];
+            break;
+        case CMD_COLMOD:
+            if (p->nparams == 1) p->colmod = v[0];
+            break;
+        case CMD_VSCRSADD:
+            if (p->nparams == 2) p->vsa = (uint16_t)((v[0] << 8) | v[1]);
+            break;
+        default:
+            break;
+    }
+}
+
+void panel_model_data(panel_model_t *p, const uint8_t *data, size_t len) {
+    p->count.bytes += len;
+    if (p->cmd == CMD_RAMWR) {
+        for (size_t i = 0; i < len; i++) {
+            if (p->pending_hi < 0) {
+                p->pending_hi = data[i];
+            } else {
+                put_pixel(p, (uint16_t)((p->pending_hi << 8) | data[i]));
+                p->pending_hi = -1;
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < len && p->nparams < (int)sizeof(p->params); i++) {
+        p->params[p->nparams++] = data[i];
+        apply_params(p);
+    }
+}
+
+uint16_t panel_model_pixel(const panel_model_t *p, int x, int y) {
+    if (x < 0 || y < 0 || x >= p->vis_w || y >= p->vis_h) return 0;
+    int gy = (p->vis_y + y + p->vsa) % p->gram_h;
+    int gx = p->vis_x + x;
+    return p->gram[(size_t)gy * (size_t)p->gram_w + (size_t)gx];
+}
+
+void panel_model_rgb888(const panel_model_t *p, uint16_t wire, uint8_t rgb[3]) {
+    uint8_t hi5 = (uint8_t)((wire >> 11) & 0x1F);
+    uint8_t g6 = (uint8_t)((wire >> 5) & 0x3F);
+    uint8_t lo5 = (uint8_t)(wire & 0x1F);
+    uint8_t r5 = (p->madctl & MADCTL_BGR) ? lo5 : hi5;
+    uint8_t b5 = (p->madctl & MADCTL_BGR) ? hi5 : lo5;
+    rgb[0] = (uint8_t)((r5 << 3) | (r5 >> 2));
+    rgb[1] = (uint8_t)((g6 << 2) | (g6 >> 4));
+    rgb[2] = (uint8_t)((b5 << 3) | (b5 >> 2));
+}
+
+bool panel_model_write_png(const panel_model_t *p, const char *path) {
+    uint8_t *rgb = malloc((size_t)p->vis_w * (size_t)p->vis_h * 3U);
+    if (!rgb) return false;
+    for (int y = 0; y < p->vis_h; y++) {
+        for (int x = 0; x < p->vis_w; x++) {
+            panel_model_rgb888(p, panel_model_pixel(p, x, y), rgb + ((size_t)y * (size_t)p->vis_w + (size_t)x) * 3U);
+        }
+    }
+    bool ok = png_write_rgb(path, p->vis_w, p->vis_h, rgb);
+    free(rgb);
+    return ok;
+}
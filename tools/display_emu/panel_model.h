@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host-side model of an ST7796/ST7789 MIPI-DBI panel fed by the raw SPI
+// command stream (DC low = command byte, DC high = parameters / pixel data).
+//
+// GRAM holds 16-bit pixels exactly as received on the wire (first byte is the
+// high byte). Rotation bits of MADCTL are recorded but not applied, so
+// snapshots are in driver address space; the BGR bit is honoured when
+// converting to RGB.
+
+typedef struct {
+    uint64_t transactions;   // SPI transactions addressed to the panel
+    uint64_t bytes;          // command + data bytes
+    uint64_t commands;       // command bytes
+    uint64_t window_cmds;    // CASET + RASET
+    uint64_t ramwr;          // RAMWR (0x2C)
+    uint64_t pixels;         // pixels written into GRAM
+    uint64_t vscroll;        // VSCRSADD (0x37)
+} panel_counters_t;
+
+typedef struct {
+    const char *name;
+    int gram_w;
+    int gram_h;
+    int vis_x;               // visible window inside GRAM
+    int vis_y;
+    int vis_w;
+    int vis_h;
+
+    uint16_t *gram;
+    uint8_t cmd;
+    uint8_t params[16];
+    int nparams;
+    int xs, xe, ys, ye;
+    int cx, cy;
+    int pending_hi;          // first byte of a pixel, -1 when none
+    uint8_t madctl;
+    uint8_t colmod;
+    uint16_t vsa;            // vertical scroll start address
+    bool display_on;
+
+    panel_counters_t count;
+} panel_model_t;
+
+bool panel_model_init(panel_model_t *p, const char *name, int gram_w, int gram_h,
+                      int vis_x, int vis_y, int vis_w, int vis_h);
+void panel_model_free(panel_model_t *p);
+
+void panel_model_begin_transaction(panel_model_t *p);
+void panel_model_command(panel_model_t *p, uint8_t cmd);
+void panel_model_data(panel_model_t *p, const uint8_t *data, size_t len);
+
+// Wire value at a visible-area coordinate (vertical scroll applied).
+uint16_t panel_model_pixel(const panel_model_t *p, int x, int y);
+void panel_model_rgb888(const panel_model_t *p, uint16_t wire, uint8_t rgb[3]);
+bool panel_model_write_png(const panel_model_t *p, const char *path);
@@ -0,0 +1,115 @@
+#include "png_writer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t s_crc_table[256];
+static int s_crc_ready = 0;
+
+static void crc_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+        }
+        s_crc_table[n] = c;
+    }
+    s_crc_ready = 1;
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *buf, size_t len) {
+    if (!s_crc_ready) crc_init();
+    for (size_t i = 0; i < len; i++) {
+        crc = s_crc_table[(crc ^ buf[i]) & 0xFFU] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void put_u32be(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static bool write_chunk(FILE *f, const char *type, const uint8_t *data, size_t len) {
+    uint8_t hdr[8];
+    put_u32be(hdr, (uint32_t)len);
+    memcpy(hdr + 4, type, 4);
+    uint32_t crc = crc_update(0xFFFFFFFFU, hdr + 4, 4);
+    if (len) crc = crc_update(crc, data, len);
+    crc ^= 0xFFFFFFFFU;
+    uint8_t tail[4];
+    put_u32be(tail, crc);
+    return fwrite(hdr, 1, 8, f) == 8 &&
+           (len == 0 || fwrite(data, 1, len, f) == len) &&
+           fwrite(tail, 1, 4, f) == 4;
+}
+
+bool png_write_rgb(const char *path, int width, int height, const uint8_t *rgb) {
+    if (!path || width <= 0 || height <= 0 || !rgb) return false;
+
+    // Raw scanlines: filter byte 0 + RGB row.
+    size_t row_len = (size_t)width * 3U + 1U;
+    size_t raw_len = row_len * (size_t)height;
+    uint8_t *raw = malloc(raw_len);
+    if (!raw) return false;
+    for (int y = 0; y < height; y++) {
+        raw[(size_t)y * row_len] = 0;
+        memcpy(raw + (size_t)y * row_len + 1, rgb + (size_t)y * (size_t)width * 3U, (size_t)width * 3U);
+    }
+
+    // zlib stream made of stored blocks.
+    size_t nblocks = (raw_len + 65534U) / 65535U;
+    size_t z_len = 2 + nblocks * 5 + raw_len + 4;
+    uint8_t *z = malloc(z_len);
+    if (!z) {
+        free(raw);
+        return false;
+    }
+    size_t o = 0;
+    z[o++] = 0x78;
+    z[o++] = 0x01;
+    uint32_t a = 1, b = 0;
+    for (size_t off = 0; off < raw_len; off += 65535U) {
+        size_t n = raw_len - off;
+        if (n > 65535U) n = 65535U;
+        z[o++] = (off + n >= raw_len) ? 1 : 0;
+        z[o++] = (uint8_t)(n & 0xFF);
+        z[o++] = (uint8_t)(n >> 8);
+        z[o++] = (uint8_t)(~n & 0xFF);
+        z[o++] = (uint8_t)((~n >> 8) & 0xFF);
+        memcpy(z + o, raw + off, n);
+        o += n;
+        for (size_t i = 0; i < n; i++) {
+            a = (a + raw[off + i]) % 65521U;
+            b = (b + a) % 65521U;
+        }
+    }
+    put_u32be(z + o, (b << 16) | a);
+    o += 4;
+    free(raw);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        free(z);
+        return false;
+    }
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+    uint8_t ihdr[13];
+    put_u32be(ihdr, (uint32_t)width);
+    put_u32be(ihdr + 4, (uint32_t)height);
+    ihdr[8] = 8;   // bit depth
+    ihdr[9] = 2;   // truecolour
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+    bool ok = fwrite(sig, 1, 8, f) == 8 &&
+              write_chunk(f, "IHDR", ihdr, sizeof(ihdr)) &&
+              write_chunk(f, "IDAT", z, o) &&
+              write_chunk(f, "IEND", NULL, 0);
+    free(z);
+    if (fclose(f) != 0) ok = false;
+    return ok;
+}
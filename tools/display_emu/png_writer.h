@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Minimal RGB8 PNG encoder (stored deflate blocks, no compression).
+bool png_write_rgb(const char *path, int width, int height, const uint8_t *rgb);
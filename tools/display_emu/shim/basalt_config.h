@@ -0,0 +1,26 @@
+#pragma once
+// Stand-in for the configure.py output; pick the board with
+// -DDISPLAY_EMU_BOARD_M5STICKC_PLUS2 (default: CYD 3.5").
+
+#define BASALT_ENABLE_TFT 1
+
+#if defined(DISPLAY_EMU_BOARD_M5STICKC_PLUS2)
+#define BASALT_BOARD_M5STICKC_PLUS2 1
+#define BASALT_PIN_TFT_MOSI 15
+#define BASALT_PIN_TFT_SCLK 13
+#define BASALT_PIN_TFT_CS 5
+#define BASALT_PIN_TFT_DC 14
+#define BASALT_PIN_TFT_RST 12
+#define BASALT_PIN_TFT_BL 27
+#else
+#define BASALT_BOARD_CYD_3248S035R 1
+#define BASALT_PIN_TFT_MOSI 13
+#define BASALT_PIN_TFT_MISO 12
+#define BASALT_PIN_TFT_SCLK 14
+#define BASALT_PIN_TFT_CS 15
+#define BASALT_PIN_TFT_DC 2
+#define BASALT_PIN_TFT_RST -1
+#define BASALT_PIN_TFT_BL 27
+#define BASALT_PIN_TOUCH_CS 33
+#define BASALT_PIN_TOUCH_IRQ -1
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+// Only the types main/bus_manager.h names.
+typedef int i2c_port_t;
+typedef struct {
+    int mode;
+} i2c_config_t;
@@ -0,0 +1,48 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum { SPI1_HOST = 0, SPI2_HOST = 1, SPI3_HOST = 2 } spi_host_device_t;
+typedef struct emu_spi_device *spi_device_handle_t;
+
+#define SPI_DMA_CH_AUTO 3
+#define SPI_DEVICE_HALFDUPLEX (1U << 4)
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+} spi_bus_config_t;
+
+typedef struct {
+    uint8_t command_bits;
+    uint8_t address_bits;
+    uint8_t dummy_bits;
+    uint8_t mode;
+    int clock_speed_hz;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    void (*pre_cb)(void *);
+    void (*post_cb)(void *);
+} spi_device_interface_config_t;
+
+typedef struct {
+    uint32_t flags;
+    size_t length;      // bits
+    size_t rxlength;    // bits
+    void *user;
+    const void *tx_buffer;
+    void *rx_buffer;
+} spi_transaction_t;
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *cfg,
+                             spi_device_handle_t *out);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t dev, spi_transaction_t *t);
+esp_err_t spi_device_transmit(spi_device_handle_t dev, spi_transaction_t *t);
+esp_err_t spi_device_queue_trans(spi_device_handle_t dev, spi_transaction_t *t, uint32_t ticks);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t dev, spi_transaction_t **t, uint32_t ticks);
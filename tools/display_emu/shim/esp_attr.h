@@ -0,0 +1,3 @@
+#pragma once
+// Host shim: no separate instruction RAM.
+#define IRAM_ATTR
@@ -0,0 +1,17 @@
+#pragma once
+#include <stddef.h>
+
+#define MALLOC_CAP_EXEC (1U << 0)
+#define MALLOC_CAP_32BIT (1U << 1)
+#define MALLOC_CAP_8BIT (1U << 2)
+#define MALLOC_CAP_DMA (1U << 3)
+#define MALLOC_CAP_SPIRAM (1U << 10)
+#define MALLOC_CAP_INTERNAL (1U << 11)
+
+// MALLOC_CAP_SPIRAM requests fail while emu_set_psram(false).
+void *heap_caps_malloc(size_t size, unsigned caps);
+void *heap_caps_realloc(void *ptr, size_t size, unsigned caps);
+void heap_caps_free(void *ptr);
+size_t heap_caps_get_free_size(unsigned caps);
+size_t heap_caps_get_largest_free_block(unsigned caps);
+void emu_set_psram(int available);
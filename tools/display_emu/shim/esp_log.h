@@ -0,0 +1,8 @@
+#pragma once
+// Driver logs go to stderr only when DISPLAY_EMU_VERBOSE is set.
+void emu_log(char level, const char *tag, const char *fmt, ...);
+
+#define ESP_LOGE(tag, ...) emu_log('E', tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) emu_log('W', tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) emu_log('I', tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) emu_log('D', tag, __VA_ARGS__)
@@ -0,0 +1,66 @@
+// Host run of the event bus benchmark (main/rt_events_bench.c) over pthreads.
+// Exits non-zero if any event is lost, duplicated or reordered.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "rt_events.h"
+
+static void usage(const char *argv0) {
+    fprintf(stderr, "usage: %s [--events N] [--producers N] [--subscribers N] [--runs N] [--isr 0|1]\n", argv0);
+}
+
+int main(int argc, char **argv) {
+    rt_event_bench_cfg_t cfg = {.events = 200000, .producers = 2, .subscribers = 2};
+    int runs = 1;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 2;
+        }
+        long v = strtol(argv[++i], NULL, 10);
+        if (strcmp(arg, "--events") == 0) {
+            cfg.events = (uint32_t)v;
+        } else if (strcmp(arg, "--producers") == 0) {
+            cfg.producers = (int)v;
+        } else if (strcmp(arg, "--subscribers") == 0) {
+            cfg.subscribers = (int)v;
+        } else if (strcmp(arg, "--runs") == 0) {
+            runs = (int)v;
+        } else if (strcmp(arg, "--isr") == 0) {
+            // Producers post as interrupt handlers would (FromISR wake-ups).
+            host_rtos_isr_tasks(v ? "evb_tx" : NULL);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (rt_event_init() != RUNTIME_OK) {
+        fprintf(stderr, "FAIL: rt_event_init\n");
+        return 1;
+    }
+    printf("%-4s %9s %10s %9s %5s %5s %10s %8s %8s %8s\n", "run", "posted", "received", "dropped", "lost",
+           "order", "ev/s", "p50_us", "p99_us", "max_us");
+    int failed = 0;
+    for (int run = 1; run <= runs; ++run) {
+        rt_event_bench_result_t r;
+        int rc = rt_event_bench_run(&cfg, &r);
+        if (rc != RUNTIME_OK) {
+            fprintf(stderr, "FAIL: bench run %d: %d\n", run, rc);
+            return 1;
+        }
+        double secs = r.elapsed_us ? (double)r.elapsed_us / 1e6 : 1e-6;
+        printf("%-4d %9u %10u %9u %5u %5u %10.0f %8u %8u %8u\n", run, r.posted, r.received, r.dropped, r.lost,
+               r.misordered, (double)r.received / secs, r.lat_p50_us, r.lat_p99_us, r.lat_max_us);
+        if (r.lost || r.misordered) failed = 1;
+    }
+    if (failed) {
+        fprintf(stderr, "FAIL: events lost or out of order\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+// pthread implementation of the shim FreeRTOS/IDF calls. Task notifications
+// are a counter under a per-task mutex and condvar, which is enough to give
+// the bus the same wake-up semantics as on target.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+struct host_task {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify;
+    TaskFunction_t fn;
+    void *arg;
+    bool isr;
+};
+
+static _Thread_local struct host_task *t_self;
+static const char *s_isr_name;
+
+static struct host_task *task_new(void) {
+    struct host_task *t = calloc(1, sizeof(*t));
+    if (!t) return NULL;
+    pthread_mutex_init(&t->lock, NULL);
+    pthread_cond_init(&t->cond, NULL);
+    return t;
+}
+
+static void *task_entry(void *p) {
+    t_self = p;
+    t_self->fn(t_self->arg);
+    return NULL;
+}
+
+// Tasks created under this name stand in for interrupt handlers.
+void host_rtos_isr_tasks(const char *name) {
+    s_isr_name = name;
+}
+
+BaseType_t host_rtos_in_isr(void) {
+    return t_self && t_self->isr ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *out) {
+    (void)stack;
+    (void)prio;
+    struct host_task *t = task_new();
+    if (!t) return pdFAIL;
+    t->fn = fn;
+    t->arg = arg;
+    t->isr = s_isr_name && name && strcmp(name, s_isr_name) == 0;
+    pthread_t th;
+    if (pthread_create(&th, NULL, task_entry, t) != 0) {
+        free(t);
+        return pdFAIL;
+    }
+    pthread_detach(th);
+    if (out) *out = t;
+    return pdPASS;
+}
+
+// The handle stays allocated: a late notify from the bus may still hold it.
+void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {.tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000L};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+void taskYIELD(void) {
+    sched_yield();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    if (!t_self) t_self = task_new();
+    return t_self;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t t) {
+    pthread_mutex_lock(&t->lock);
+    t->notify++;
+    pthread_cond_signal(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t t, BaseType_t *woken) {
+    xTaskNotifyGive(t);
+    if (woken) *woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    struct host_task *t = xTaskGetCurrentTaskHandle();
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += ticks / 1000;
+    until.tv_nsec += (long)(ticks % 1000) * 1000000L;
+    if (until.tv_nsec >= 1000000000L) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+    pthread_mutex_lock(&t->lock);
+    while (t->notify == 0) {
+        int rc = ticks == portMAX_DELAY ? pthread_cond_wait(&t->cond, &t->lock)
+                                        : pthread_cond_timedwait(&t->cond, &t->lock, &until);
+        if (rc == ETIMEDOUT) break;
+    }
+    uint32_t n = t->notify;
+    if (n) t->notify = clear ? 0 : n - 1;
+    pthread_mutex_unlock(&t->lock);
+    return n;
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void *heap_caps_malloc(size_t size, unsigned caps) {
+    (void)caps;
+    return malloc(size);
+}
@@ -0,0 +1,7 @@
+#pragma once
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT (1U << 2)
+#define MALLOC_CAP_INTERNAL (1U << 11)
+
+void *heap_caps_malloc(size_t size, unsigned caps);
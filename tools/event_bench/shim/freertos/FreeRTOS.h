@@ -0,0 +1,23 @@
+#pragma once
+// Host shim: the FreeRTOS surface main/rt_events*.c use, backed by pthreads
+// in host_rtos.c. Tasks named with host_rtos_isr_tasks() report ISR context,
+// so the bus takes its FromISR path for them.
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(x) ((void)(x))
+#define xPortInIsrContext() host_rtos_in_isr()
+
+BaseType_t host_rtos_in_isr(void);
+void host_rtos_isr_tasks(const char *name);
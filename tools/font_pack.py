@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""Convert BDF bitmap fonts into BasaltOS BFN1 fonts for the TFT font engine.
+
+BFN1 layout (little-endian), as read by main/tft_font.c:
+
+    0   4  magic "BFN1"
+    4   1  height      rows per glyph (every glyph is full height)
+    5   1  ascent      baseline, in rows from the top
+    6   1  first       first character code
+    7   1  count       number of glyphs
+    8   1  flags       bit 0: glyph bitmaps are run-length encoded
+    9   3  reserved
+    12  4  data_size   bytes of bitmap data after the glyph table
+    16  8*count glyph table: u32 offset, u16 length, u8 width, u8 advance
+    ..  data_size  bitmap data
+
+A packed bitmap is width*height bits, row-major, MSB first, with no row
+padding. An RLE bitmap is the same bit stream as alternating run lengths,
+starting with background. A byte of 255 continues the current run; any other
+value ends it.
+
+Examples:
+    tools/font_pack.py tools/fonts/basalt-console-5x7.bdf -o app/font.bfnt
+    tools/font_pack.py tools/fonts/basalt-console-5x7.bdf --scale 2 --encoding rle -o f16.bfnt
+    tools/font_pack.py --builtin-c main/tft_font_data.c
+"""
+
+from __future__ import annotations
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parents[1]
+CONSOLE_BDF = ROOT / "tools" / "fonts" / "basalt-console-5x7.bdf"
+
+# Built-in fonts compiled into flash: (name, source, scale).
+BUILTIN_FONTS = [
+    ("small", CONSOLE_BDF, 1),
+    ("medium", CONSOLE_BDF, 2),
+    ("large", CONSOLE_BDF, 3),
+]
+
+FLAG_RLE = 0x01
+
+
+class Glyph:
+    def __init__(self, code: int, advance: int, rows: list[list[int]]):
+        self.code = code
+        self.advance = advance
+        self.rows = rows  # full-height rows of 0/1
+
+    @property
+    def width(self) -> int:
+        return len(self.rows[0]) if self.rows else 0
+
+
+class Font:
+    def __init__(self, height: int, ascent: int, glyphs: dict[int, Glyph]):
+        self.height = height
+        self.ascent = ascent
+        self.glyphs = glyphs
+
+
+def parse_bdf(path: Path) -> Font:
+    ascent = descent = None
+    glyphs: dict[int, Glyph] = {}
+    lines = path.read_text(encoding="ascii", errors="replace").splitlines()
+    i = 0
+    bbox_default = None
+    while i < len(lines):
+        parts = lines[i].split()
+        i += 1
+        if not parts:
+            continue
+        key = parts[0]
+        if key == "FONT_ASCENT":
+            ascent = int(parts[1])
+        elif key == "FONT_DESCENT":
+            descent = int(parts[1])
+        elif key == "FONTBOUNDINGBOX":
+            bbox_default = [int(v) for v in parts[1:5]]
+        elif key == "STARTCHAR":
+            code = -1
+            advance = 0
+            bbx = list(bbox_default or [0, 0, 0, 0])
+            bitmap: list[int] = []
+            while i < len(lines):
+                cparts = lines[i].split()
+                i += 1
+                if not cparts:
+                    continue
+                ckey = cparts[0]
+                if ckey == "ENCODING":
+                    code = int(cparts[1])
+                elif ckey == "DWIDTH":
+                    advance = int(cparts[1])
+                elif ckey == "BBX":
+                    bbx = [int(v) for v in cparts[1:5]]
+                elif ckey == "BITMAP":
+                    while i < len(lines) and lines[i].strip() != "ENDCHAR":
+                        bitmap.append(int(lines[i].strip() or "0", 16))
+                        i += 1
+                elif ckey == "ENDCHAR":
+                    break
+            if code < 0:
+                continue
+            glyphs[code] = (advance, bbx, bitmap)  # type: ignore[assignment]
+    if ascent is None or descent is None:
+        raise ValueError(f"{path}: FONT_ASCENT/FONT_DESCENT missing")
+    height = ascent + descent
+    out: dict[int, Glyph] = {}
+    for code, (advance, bbx, bitmap) in glyphs.items():  # type: ignore[misc]
+        w, h, xoff, yoff = bbx
+        width = max(0, xoff + w)
+        rows = [[0] * width for _ in range(height)]
+        top = ascent - (yoff + h)
+        row_bytes = (w + 7) // 8
+        for r, value in enumerate(bitmap[:h]):
+            y = top + r
+            if not 0 <= y < height:
+                continue
+            for c in range(w):
+                bit = (value >> (row_bytes * 8 - 1 - c)) & 1
+                x = xoff + c
+                if bit and 0 <= x < width:
+                    rows[y][x] = 1
+        out[code] = Glyph(code, advance, rows)
+    return Font(height, ascent, out)
+
+
+def _px(rows: list[list[int]], x: int, y: int) -> int:
+    if 0 <= y < len(rows) and 0 <= x < len(rows[0]):
+        return rows[y][x]
+    return 0
+
+
+def scale_rows(rows: list[list[int]], factor: int) -> list[list[int]]:
+    """Scale2x (EPX) / Scale3x so enlarged glyphs get smoothed diagonals."""
+    if factor == 1 or not rows or not rows[0]:
+        return [[v for v in row for _ in range(factor)] for row in rows for _ in range(factor)]
+    h, w = len(rows), len(rows[0])
+    out = [[0] * (w * factor) for _ in range(h * factor)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c = _px(rows, x - 1, y - 1), _px(rows, x, y - 1), _px(rows, x + 1, y - 1)
+            d, e, f = _px(rows, x - 1, y), rows[y][x], _px(rows, x + 1, y)
+            g, hh, i = _px(rows, x - 1, y + 1), _px(rows, x, y + 1), _px(rows, x + 1, y + 1)
+            if factor == 2:
+                block = [
+                    d if (d == b and b != f and d != hh) else e,
+                    f if (b == f and b != d and f != hh) else e,
+                    d if (d == hh and d != b and hh != f) else e,
+                    f if (hh == f and d != hh and b != f) else e,
+                ]
+            elif factor == 3:
+                block = [
+                    d if (d == b and d != hh and b != f) else e,
+                    b if ((d == b and d != hh and b != f and e != c) or (b == f and b != d and f != hh and e != a)) else e,
+                    f if (b == f and b != d and f != hh) else e,
+                    d if ((d == b and d != hh and b != f and e != g) or (d == hh and d != b and hh != f and e != a)) else e,
+                    e,
+                    f if ((b == f and b != d and f != hh and e != i) or (hh == f and d != hh and b != f and e != c)) else e,
+                    d if (d == hh and d != b and hh != f) else e,
+                    hh if ((d == hh and d != b and hh != f and e != i) or (hh == f and d != hh and b != f and e != g)) else e,
+                    f if (hh == f and d != hh and b != f) else e,
+                ]
+            else:
+                raise ValueError("scale must be 1, 2 or 3")
+            for k, v in enumerate(block):
+                out[y * factor + k // factor][x * factor + k % factor] = v
+    return out
+
+
+def scale_font(font: Font, factor: int) -> Font:
+    if factor == 1:
+        return font
+    glyphs = {
+        code: Glyph(code, g.advance * factor, scale_rows(g.rows, factor)) for code, g in font.glyphs.items()
+    }
+    return Font(font.height * factor, font.ascent * factor, glyphs)
+
+
+def encode_packed(rows: list[list[int]]) -> bytes:
+    bits = [v for row in rows for v in row]
+    out = bytearray((len(bits) + 7) // 8)
+    for n, v in enumerate(bits):
+        if v:
+            out[n >> 3] |= 0x80 >> (n & 7)
+    return bytes(out)
+
+
+def encode_rle(rows: list[list[int]]) -> bytes:
+    bits = [v for row in rows for v in row]
+    out = bytearray()
+    colour = 0
+    n = 0
+    while n < len(bits):
+        run = 0
+        while n < len(bits) and bits[n] == colour:
+            run += 1
+            n += 1
+        while run >= 255:
+            out.append(255)
+            run -= 255
+        out.append(run)
+        colour ^= 1
+    return bytes(out)
+
+
+def build_bfn1(font: Font, first: int, last: int, rle: bool) -> bytes:
+    if font.height > 255:
+        raise ValueError("font taller than 255 rows")
+    table = bytearray()
+    data = bytearray()
+    for code in range(first, last + 1):
+        g = font.glyphs.get(code)
+        if g is None:
+            table += struct.pack("<IHBB", len(data), 0, 0, 0)
+            continue
+        blob = encode_rle(g.rows) if rle else encode_packed(g.rows)
+        if g.width > 255 or g.advance > 255 or len(blob) > 0xFFFF:
+            raise ValueError(f"glyph {code} too large")
+        table += struct.pack("<IHBB", len(data), len(blob), g.width, g.advance)
+        data += blob
+    header = struct.pack(
+        "<4sBBBBB3xI", b"BFN1", font.height, font.ascent, first, last - first + 1,
+        FLAG_RLE if rle else 0, len(data),
+    )
+    return header + bytes(table) + bytes(data)
+
+
+def smallest_bfn1(font: Font, first: int, last: int) -> bytes:
+    packed = build_bfn1(font, first, last, rle=False)
+    rle = build_bfn1(font, first, last, rle=True)
+    return rle if len(rle) < len(packed) else packed
+
+
+def c_array(name: str, blob: bytes) -> str:
+    lines = [f"const uint8_t {name}[{len(blob)}] = {{"]
+    for off in range(0, len(blob), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in blob[off:off + 16]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def write_builtin_c(path: Path) -> None:
+    parts = [
+        "// Generated by tools/font_pack.py --builtin-c; do not edit.",
+        "// Built-in BFN1 fonts, kept in flash and decoded in place by tft_font.c.",
+        "",
+        "#include <stdint.h>",
+        "",
+        '#include "tft_font.h"',
+        "",
+    ]
+    entries = []
+    for name, src, scale in BUILTIN_FONTS:
+        font = scale_font(parse_bdf(src), scale)
+        blob = smallest_bfn1(font, 32, 126)
+        sym = f"tft_font_{name}_data"
+        parts.append(c_array(sym, blob))
+        parts.append("")
+        entries.append((name, sym))
+    parts.append("const tft_font_builtin_t tft_font_builtins[] = {")
+    for name, sym in entries:
+        parts.append(f'    {{"{name}", {sym}, sizeof({sym})}},')
+    parts.append("};")
+    parts.append("const int tft_font_builtin_count = sizeof(tft_font_builtins) / sizeof(tft_font_builtins[0]);")
+    path.write_text("\n".join(parts) + "\n", encoding="utf-8")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Convert BDF fonts to BasaltOS BFN1 fonts.")
+    parser.add_argument("bdf", nargs="?", help="Input BDF font")
+    parser.add_argument("-o", "--out", help="Output .bfnt path")
+    parser.add_argument("--scale", type=int, default=1, choices=(1, 2, 3),
+                        help="Enlarge with Scale2x/Scale3x smoothing")
+    parser.add_argument("--encoding", choices=("auto", "packed", "rle"), default="auto",
+                        help="Glyph bitmap encoding (default: whichever is smaller)")
+    parser.add_argument("--first", type=int, default=32, help="First character code (default 32)")
+    parser.add_argument("--last", type=int, default=126, help="Last character code (default 126)")
+    parser.add_argument("--builtin-c", metavar="PATH",
+                        help="Regenerate the built-in font table (main/tft_font_data.c)")
+    args = parser.parse_args()
+
+    if args.builtin_c:
+        write_builtin_c(Path(args.builtin_c))
+        print(f"wrote {args.builtin_c}")
+        return 0
+    if not args.bdf or not args.out:
+        parser.error("bdf and --out are required unless --builtin-c is given")
+    if not 0 <= args.first <= args.last <= 255:
+        parser.error("--first/--last must satisfy 0 <= first <= last <= 255")
+
+    font = scale_font(parse_bdf(Path(args.bdf)), args.scale)
+    if args.encoding == "auto":
+        blob = smallest_bfn1(font, args.first, args.last)
+    else:
+        blob = build_bfn1(font, args.first, args.last, rle=args.encoding == "rle")
+    Path(args.out).write_bytes(blob)
+    print(f"wrote {args.out}: {len(blob)} bytes, height {font.height}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
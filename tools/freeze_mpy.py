@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Freeze Python modules and bundled apps into the MicroPython embed package.
+
+Reads runtime/python/frozen/manifest.json:
+
+    "lib"   .py modules made importable from ROM (`import basalt_util`)
+    "apps"  app folders whose Python entry script is frozen as
+            "<folder>/<entry>" and run from ROM when an installed copy is
+            byte-identical (matched by the same length + FNV-1a digest the
+            on-device bytecode cache uses)
+
+Each script is compiled with mpy-cross, then upstream tools/mpy-tool.py turns
+the .mpy files into C: const code objects plus a qstr pool chained after the
+firmware's own (MICROPY_QSTR_EXTRA_POOL).
+
+The micropython_embed component runs this at build time (BASALT_MPY_FROZEN,
+on by default) and compiles the output from its build directory. By hand:
+    tools/freeze_mpy.py --out /tmp/frozen_content.c
+    tools/freeze_mpy.py --out /tmp/frozen_content.c --mpy-cross ~/micropython/mpy-cross/build/mpy-cross
+    tools/freeze_mpy.py --list-inputs
+"""
+
+from __future__ import annotations
+
+import argparse
+import ast
+import json
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+from app_validation import validate_app_dir
+
+ROOT = Path(__file__).resolve().parents[1]
+MPY_DIR = ROOT / "runtime" / "python" / "micropython"
+EMBED_DIR = ROOT / "runtime" / "python" / "micropython_embed"
+DEFAULT_MANIFEST = ROOT / "runtime" / "python" / "frozen" / "manifest.json"
+PORT_CONFIG = EMBED_DIR / "mpconfigport.h"
+
+# Must match mpconfigport.h (ROM_LEVEL_MINIMUM: no long ints, 31-bit small ints).
+MPY_CROSS_FLAGS = ["-msmall-int-bits=31"]
+MPY_TOOL_FLAGS = ["-mlongint-impl=none"]
+
+# Machine code can't be frozen as portable bytecode (see pack_app.py).
+NATIVE_MARKERS = (b"@micropython.native", b"@micropython.viper", b"@micropython.asm_")
+
+
+def _fnv1a32(data: bytes) -> int:
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def _mpy_cross_cmd(explicit: str | None) -> list[str] | None:
+    if explicit:
+        return [explicit]
+    built = MPY_DIR / "mpy-cross" / "build" / "mpy-cross"
+    if built.is_file():
+        return [str(built)]
+    found = shutil.which("mpy-cross")
+    if found:
+        return [found]
+    try:
+        import mpy_cross  # noqa: F401  (pip package ships the binary)
+    except ImportError:
+        return None
+    return [sys.executable, "-m", "mpy_cross"]
+
+
+def port_qstr_config(path: Path = PORT_CONFIG) -> dict[str, int]:
+    """MICROPY_QSTR_BYTES_IN_LEN/_HASH as pinned in mpconfigport.h. The frozen
+    pool's layout (hashes array or not) has to match the firmware's."""
+    text = path.read_text(encoding="utf-8")
+    cfg: dict[str, int] = {}
+    for name in ("BYTES_IN_LEN", "BYTES_IN_HASH"):
+        m = re.search(rf"^#define\s+MICROPY_QSTR_{name}\s+\(?(\d+)\)?", text, re.MULTILINE)
+        if not m:
+            raise ValueError(f"{path}: MICROPY_QSTR_{name} is not pinned")
+        cfg[name] = int(m.group(1))
+    return cfg
+
+
+def firmware_qstr_header(generated: Path, out: Path, port_config: Path = PORT_CONFIG) -> None:
+    """Rewrite genhdr/qstrdefs.generated.h as the Q()/QCFG() list mpy-tool reads,
+    so frozen code refers to firmware qstrs instead of duplicating them."""
+    lines = [f"QCFG({name}, ({value}))" for name, value in port_qstr_config(port_config).items()]
+    for raw in generated.read_text(encoding="utf-8").splitlines():
+        if not raw.startswith(("QDEF0(", "QDEF1(")):
+            continue
+        literal = raw[raw.index('"'):raw.rindex('"') + 1]
+        value = ast.literal_eval(literal)
+        # mpy-tool's static table already covers the odd ones ("", "\n").
+        if value and value.isprintable() and ")" not in value:
+            lines.append(f"Q({value})")
+    out.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+
+def collect(manifest: dict) -> list[tuple[str, Path, bool]]:
+    """(frozen name, source path, is_app) for every entry in the manifest."""
+    items: list[tuple[str, Path, bool]] = []
+    for rel in manifest.get("lib", []):
+        src = ROOT / rel
+        if src.suffix != ".py":
+            raise ValueError(f"lib entry is not a .py file: {rel}")
+        items.append((src.name, src, False))
+    for rel in manifest.get("apps", []):
+        app_dir = ROOT / rel
+        meta = validate_app_dir(app_dir)
+        if meta["runtime"] != "python" or not meta["entry"].endswith(".py"):
+            print(f"note: {rel} is not a Python app; skipped", file=sys.stderr)
+            continue
+        items.append((f"{app_dir.name}/{meta['entry']}", app_dir / meta["entry"], True))
+    names = [name for name, _src, _app in items]
+    dupes = sorted({n for n in names if names.count(n) > 1})
+    if dupes:
+        raise ValueError(f"duplicate frozen names: {', '.join(dupes)}")
+    return items
+
+
+def freeze(items, mpy_cross: list[str], mpy_tool: Path, qstr_generated: Path) -> str:
+    apps: list[tuple[str, int, int]] = []
+    with tempfile.TemporaryDirectory() as td:
+        tmp = Path(td)
+        mpy_files: list[str] = []
+        for n, (name, src, is_app) in enumerate(items):
+            data = src.read_bytes()
+            if any(marker in data for marker in NATIVE_MARKERS):
+                print(f"note: {name} uses native/viper code; not frozen")
+                continue
+            out = tmp / f"{n}.mpy"
+            proc = subprocess.run(
+                mpy_cross + ["-s", name] + MPY_CROSS_FLAGS + ["-o", str(out), str(src)],
+                capture_output=True, text=True,
+            )
+            if proc.returncode != 0:
+                raise ValueError(f"mpy-cross failed for {name}: {proc.stderr.strip()}")
+            mpy_files.append(str(out))
+            if is_app:
+                apps.append((name, len(data), _fnv1a32(data)))
+            print(f"frozen {name} ({len(data)} bytes source)")
+        if not mpy_files:
+            raise ValueError("nothing to freeze")
+
+        qhdr = tmp / "qstrdefs.preprocessed.h"
+        firmware_qstr_header(qstr_generated, qhdr)
+        proc = subprocess.run(
+            [sys.executable, str(mpy_tool), "-f", "-q", str(qhdr)] + MPY_TOOL_FLAGS + mpy_files,
+            capture_output=True, text=True,
+        )
+        if proc.returncode != 0:
+            raise ValueError(f"mpy-tool failed: {proc.stderr.strip()}")
+        frozen_c = proc.stdout
+
+    parts = [
+        "// Generated by tools/freeze_mpy.py from runtime/python/frozen/manifest.json; do not edit.",
+        "",
+        frozen_c.rstrip(),
+        "",
+        '#include "port/micropython_embed.h"',
+        "",
+        "const mp_embed_frozen_app_t mp_embed_frozen_apps[] = {",
+    ]
+    for name, length, digest in apps:
+        parts.append(f'    {{"{name}", {length}u, 0x{digest:08x}u}},')
+    parts.append("    {NULL, 0, 0},")
+    parts.append("};")
+    return "\n".join(parts) + "\n"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Freeze Python modules and apps into the MicroPython embed package.")
+    parser.add_argument("--manifest", default=str(DEFAULT_MANIFEST), help="Freeze manifest (JSON)")
+    parser.add_argument("--out", help="Generated C file")
+    parser.add_argument("--list-inputs", action="store_true",
+                        help="Print the manifest and every source it freezes, one per line, and exit")
+    parser.add_argument("--mpy-cross", help="mpy-cross executable (default: submodule build, PATH, then the mpy_cross package)")
+    parser.add_argument("--mpy-tool", default=str(MPY_DIR / "tools" / "mpy-tool.py"),
+                        help="mpy-tool.py from the MicroPython tree the embed package was built from")
+    parser.add_argument("--qstr-header", default=str(EMBED_DIR / "genhdr" / "qstrdefs.generated.h"),
+                        help="Firmware qstr table to freeze against")
+    args = parser.parse_args()
+
+    if args.list_inputs:
+        try:
+            manifest = json.loads(Path(args.manifest).read_text(encoding="utf-8"))
+            items = collect(manifest)
+        except (OSError, ValueError) as e:
+            print(f"error: {e}", file=sys.stderr)
+            return 1
+        print(Path(args.manifest).resolve())
+        for _name, src, _is_app in items:
+            print(src.resolve())
+        return 0
+    if not args.out:
+        parser.error("--out is required")
+
+    mpy_cross = _mpy_cross_cmd(args.mpy_cross)
+    if not mpy_cross:
+        print("error: mpy-cross not found (build runtime/python/micropython/mpy-cross or pass --mpy-cross)",
+              file=sys.stderr)
+        return 1
+    mpy_tool = Path(args.mpy_tool)
+    if not mpy_tool.is_file():
+        print(f"error: mpy-tool not found: {mpy_tool} (check out the micropython submodule)", file=sys.stderr)
+        return 1
+
+    try:
+        manifest = json.loads(Path(args.manifest).read_text(encoding="utf-8"))
+        text = freeze(collect(manifest), mpy_cross, mpy_tool, Path(args.qstr_header))
+    except (OSError, ValueError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+    out = Path(args.out)
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_text(text, encoding="utf-8")
+    print(f"wrote {out}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,114 @@
+// File-backed NOR flash simulation with crash injection; see flash_sim.h.
+// Also provides kv_log_partition_flash(), so the kv_log backend runs
+// unchanged on the host.
+
+#include "flash_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t *s_mem;
+static char s_path[256];
+static int64_t s_budget = -1;
+static bool s_crashed;
+static uint32_t s_violations;
+static kv_log_flash_t s_flash;
+
+// Spends up to n bytes of the crash budget; returns how many may proceed.
+static size_t sim_spend(size_t n) {
+    if (s_budget < 0) return n;
+    if ((int64_t)n <= s_budget) {
+        s_budget -= (int64_t)n;
+        return n;
+    }
+    size_t ok = (size_t)s_budget;
+    s_budget = 0;
+    s_crashed = true;
+    return ok;
+}
+
+static int sim_read(uint32_t off, void *buf, size_t len) {
+    if (s_crashed || off + len > s_flash.size) return RUNTIME_EIO;
+    memcpy(buf, s_mem + off, len);
+    return RUNTIME_OK;
+}
+
+static int sim_write(uint32_t off, const void *buf, size_t len) {
+    if (s_crashed || off + len > s_flash.size) return RUNTIME_EIO;
+    const uint8_t *src = buf;
+    size_t n = sim_spend(len);
+    for (size_t i = 0; i < n; ++i) {
+        if (src[i] & ~s_mem[off + i]) s_violations++;
+        s_mem[off + i] &= src[i];
+    }
+    if (n == len) return RUNTIME_OK;
+    // The byte being programmed when power went gets only some of its bits.
+    s_mem[off + n] &= src[n] | 0xF0;
+    return RUNTIME_EIO;
+}
+
+static int sim_erase(uint32_t off) {
+    if (s_crashed || off % s_flash.sector_size || off >= s_flash.size) return RUNTIME_EIO;
+    size_t n = sim_spend(s_flash.sector_size);
+    memset(s_mem + off, 0xFF, n);
+    return n == s_flash.sector_size ? RUNTIME_OK : RUNTIME_EIO;
+}
+
+static void sim_load(void) {
+    memset(s_mem, 0xFF, s_flash.size);
+    FILE *f = fopen(s_path, "rb");
+    if (!f) return;
+    size_t n = fread(s_mem, 1, s_flash.size, f);
+    (void)n;
+    fclose(f);
+}
+
+static void sim_save(void) {
+    FILE *f = fopen(s_path, "wb");
+    if (!f) {
+        fprintf(stderr, "flash_sim: cannot write %s\n", s_path);
+        exit(1);
+    }
+    fwrite(s_mem, 1, s_flash.size, f);
+    fclose(f);
+}
+
+void flash_sim_init(const char *path, uint32_t size, uint32_t sector_size) {
+    free(s_mem);
+    s_mem = malloc(size);
+    if (!s_mem) exit(1);
+    snprintf(s_path, sizeof(s_path), "%s", path);
+    s_flash = (kv_log_flash_t){size, sector_size, sim_read, sim_write, sim_erase};
+    s_budget = -1;
+    s_crashed = false;
+    s_violations = 0;
+    sim_load();
+}
+
+const kv_log_flash_t *flash_sim(void) {
+    return &s_flash;
+}
+
+void flash_sim_power_cycle(void) {
+    sim_save();
+    sim_load();
+    s_budget = -1;
+    s_crashed = false;
+}
+
+void flash_sim_crash_after(int64_t budget) {
+    s_budget = budget;
+}
+
+bool flash_sim_crashed(void) {
+    return s_crashed;
+}
+
+uint32_t flash_sim_violations(void) {
+    return s_violations;
+}
+
+const kv_log_flash_t *kv_log_partition_flash(void) {
+    return s_mem ? &s_flash : NULL;
+}
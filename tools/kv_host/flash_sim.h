@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kv_log.h"
+
+// NOR flash in RAM, backed by a file, for kv_log host tests. Writes can only
+// clear bits; a write that would set one is counted as a violation. The image
+// is saved to and reloaded from the file on a power cycle.
+void flash_sim_init(const char *path, uint32_t size, uint32_t sector_size);
+const kv_log_flash_t *flash_sim(void);
+
+// Saves the image, drops all RAM state and reloads it from the file.
+// Disarms any pending crash.
+void flash_sim_power_cycle(void);
+
+// After budget more bytes programmed (an erase costs a sector), the write or
+// erase in progress stops partway and every later call fails with
+// RUNTIME_EIO until the next power cycle. A negative budget disarms.
+void flash_sim_crash_after(int64_t budget);
+bool flash_sim_crashed(void);
+
+uint32_t flash_sim_violations(void);
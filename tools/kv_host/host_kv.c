@@ -0,0 +1,161 @@
+// Host implementations of the shim FreeRTOS/IDF calls: tasks are threads,
+// esp_timer runs on a simulated clock. Only one thread runs at a time: a
+// notification hands control to the task and waits until it blocks again, so
+// a deferred commit has finished by the time host_clock_advance_us() returns.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define HOST_TIMERS 4
+
+struct host_task {
+    pthread_t thread;
+    void (*fn)(void *);
+    void *arg;
+    uint32_t notify;
+    bool blocked; // waiting in ulTaskNotifyTake
+};
+
+struct esp_timer {
+    esp_timer_cb_t cb;
+    void *arg;
+    int64_t due_us; // 0: stopped
+};
+
+static struct esp_timer s_timers[HOST_TIMERS];
+static int s_ntimers;
+static int64_t s_now_us = 1000000;
+
+static pthread_mutex_t s_sched = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_sched_cond = PTHREAD_COND_INITIALIZER;
+static __thread struct host_task *s_self;
+static int s_ntasks;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    pthread_mutex_t *m = malloc(sizeof(*m));
+    if (m) pthread_mutex_init(m, NULL);
+    return m;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    (void)ticks;
+    pthread_mutex_lock(sem);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    pthread_mutex_unlock(sem);
+    return pdTRUE;
+}
+
+static void *host_task_main(void *arg) {
+    struct host_task *t = arg;
+    s_self = t;
+    t->fn(t->arg);
+    return NULL;
+}
+
+// Waits with s_sched held until the task is parked with nothing to take.
+static void host_task_wait_idle(struct host_task *t) {
+    while (!t->blocked || t->notify) pthread_cond_wait(&s_sched_cond, &s_sched);
+}
+
+BaseType_t xTaskCreate(void (*fn)(void *), const char *name, uint32_t stack, void *arg, uint32_t prio,
+                       TaskHandle_t *out) {
+    (void)name;
+    (void)stack;
+    (void)prio;
+    struct host_task *t = calloc(1, sizeof(*t));
+    if (!t) return pdFAIL;
+    t->fn = fn;
+    t->arg = arg;
+    if (pthread_create(&t->thread, NULL, host_task_main, t) != 0) {
+        free(t);
+        return pdFAIL;
+    }
+    pthread_detach(t->thread);
+    pthread_mutex_lock(&s_sched);
+    host_task_wait_idle(t);
+    pthread_mutex_unlock(&s_sched);
+    s_ntasks++;
+    *out = t;
+    return pdPASS;
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+    struct host_task *t = task;
+    pthread_mutex_lock(&s_sched);
+    t->notify++;
+    pthread_cond_broadcast(&s_sched_cond);
+    host_task_wait_idle(t);
+    pthread_mutex_unlock(&s_sched);
+}
+
+// Tasks only block here with portMAX_DELAY; timed waits on the simulated
+// clock are not modelled.
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    (void)ticks;
+    struct host_task *t = s_self;
+    if (!t) return 0;
+    pthread_mutex_lock(&s_sched);
+    t->blocked = true;
+    pthread_cond_broadcast(&s_sched_cond);
+    while (!t->notify) pthread_cond_wait(&s_sched_cond, &s_sched);
+    uint32_t v = t->notify;
+    t->notify = clear ? 0 : v - 1;
+    t->blocked = false;
+    pthread_mutex_unlock(&s_sched);
+    return v;
+}
+
+int host_task_count(void) {
+    return s_ntasks;
+}
+
+int64_t esp_timer_get_time(void) {
+    return s_now_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out) {
+    if (s_ntimers == HOST_TIMERS) return ESP_ERR_NO_MEM;
+    struct esp_timer *t = &s_timers[s_ntimers++];
+    t->cb = args->callback;
+    t->arg = args->arg;
+    t->due_us = 0;
+    *out = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t timeout_us) {
+    if (t->due_us) return ESP_ERR_INVALID_STATE;
+    t->due_us = s_now_us + (int64_t)timeout_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+    if (!t->due_us) return ESP_ERR_INVALID_STATE;
+    t->due_us = 0;
+    return ESP_OK;
+}
+
+void host_clock_advance_us(int64_t us) {
+    int64_t until = s_now_us + us;
+    for (;;) {
+        struct esp_timer *next = NULL;
+        for (int i = 0; i < s_ntimers; ++i) {
+            struct esp_timer *t = &s_timers[i];
+            if (t->due_us && t->due_us <= until && (!next || t->due_us < next->due_us)) next = t;
+        }
+        if (!next) break;
+        s_now_us = next->due_us;
+        next->due_us = 0;
+        next->cb(next->arg);
+    }
+    s_now_us = until;
+}
@@ -0,0 +1,151 @@
+// Host file storage for rt_kv. The whole key set lives in memory and each
+// flush rewrites the file atomically, which makes the file write count the
+// host equivalent of NVS page writes.
+//
+// File: "BKV1", then per key: u8 key length, key, u16 value length, value.
+
+#include "kv_file_backend.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KV_FILE_MAX_KEYS 256
+
+typedef struct {
+    char key[RT_KV_KEY_MAX + 1];
+    uint8_t *val;
+    uint16_t len;
+} kv_file_entry_t;
+
+static kv_file_entry_t s_entries[KV_FILE_MAX_KEYS];
+static int s_count;
+static char s_path[256] = "kv_store.bin";
+static uint32_t s_writes;
+static int s_fail_flushes;
+
+void kv_file_set_path(const char *path) {
+    snprintf(s_path, sizeof(s_path), "%s", path);
+}
+
+void kv_file_fail_flushes(int n) {
+    s_fail_flushes = n;
+}
+
+uint32_t kv_file_writes(void) {
+    return s_writes;
+}
+
+static kv_file_entry_t *kv_file_find(const char *key) {
+    for (int i = 0; i < s_count; ++i) {
+        if (strcmp(s_entries[i].key, key) == 0) return &s_entries[i];
+    }
+    return NULL;
+}
+
+static int kv_file_open(void) {
+    for (int i = 0; i < s_count; ++i) free(s_entries[i].val);
+    s_count = 0;
+    FILE *f = fopen(s_path, "rb");
+    if (!f) return RUNTIME_OK; // first run
+    char magic[4];
+    int rc = RUNTIME_OK;
+    if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "BKV1", 4) != 0) rc = RUNTIME_EIO;
+    while (rc == RUNTIME_OK) {
+        uint8_t klen;
+        uint8_t vlen[2];
+        if (fread(&klen, 1, 1, f) != 1) break;
+        kv_file_entry_t *e = &s_entries[s_count];
+        if (klen == 0 || klen > RT_KV_KEY_MAX || s_count == KV_FILE_MAX_KEYS ||
+            fread(e->key, 1, klen, f) != klen || fread(vlen, 1, 2, f) != 2) {
+            rc = RUNTIME_EIO;
+            break;
+        }
+        e->key[klen] = '\0';
+        e->len = (uint16_t)(vlen[0] | vlen[1] << 8);
+        e->val = malloc(e->len ? e->len : 1);
+        if (!e->val || fread(e->val, 1, e->len, f) != e->len) {
+            free(e->val);
+            rc = RUNTIME_EIO;
+            break;
+        }
+        s_count++;
+    }
+    fclose(f);
+    return rc;
+}
+
+static int kv_file_load(const char *key, void *buf, size_t *len_inout) {
+    kv_file_entry_t *e = kv_file_find(key);
+    if (!e) return RUNTIME_ENOENT;
+    if (buf) {
+        if (*len_inout < e->len) return RUNTIME_EINVAL;
+        memcpy(buf, e->val, e->len);
+    }
+    *len_inout = e->len;
+    return RUNTIME_OK;
+}
+
+static int kv_file_store(const char *key, const void *buf, size_t len) {
+    kv_file_entry_t *e = kv_file_find(key);
+    if (!e) {
+        if (s_count == KV_FILE_MAX_KEYS) return RUNTIME_ENOMEM;
+        e = &s_entries[s_count++];
+        snprintf(e->key, sizeof(e->key), "%s", key);
+        e->val = NULL;
+    }
+    uint8_t *val = malloc(len ? len : 1);
+    if (!val) return RUNTIME_ENOMEM;
+    if (len) memcpy(val, buf, len);
+    free(e->val);
+    e->val = val;
+    e->len = (uint16_t)len;
+    return RUNTIME_OK;
+}
+
+static int kv_file_erase(const char *key) {
+    kv_file_entry_t *e = kv_file_find(key);
+    if (!e) return RUNTIME_OK;
+    free(e->val);
+    *e = s_entries[--s_count];
+    return RUNTIME_OK;
+}
+
+static int kv_file_flush(void) {
+    if (s_fail_flushes > 0) {
+        s_fail_flushes--;
+        return RUNTIME_EIO;
+    }
+    char tmp[272];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", s_path);
+    FILE *f = fopen(tmp, "wb");
+    if (!f) return RUNTIME_EIO;
+    bool ok = fwrite("BKV1", 1, 4, f) == 4;
+    for (int i = 0; ok && i < s_count; ++i) {
+        kv_file_entry_t *e = &s_entries[i];
+        uint8_t klen = (uint8_t)strlen(e->key);
+        uint8_t vlen[2] = {(uint8_t)e->len, (uint8_t)(e->len >> 8)};
+        ok = fwrite(&klen, 1, 1, f) == 1 && fwrite(e->key, 1, klen, f) == klen && fwrite(vlen, 1, 2, f) == 2 &&
+             fwrite(e->val, 1, e->len, f) == e->len;
+    }
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmp, s_path) != 0) {
+        remove(tmp);
+        return RUNTIME_EIO;
+    }
+    s_writes++;
+    return RUNTIME_OK;
+}
+
+static const rt_kv_backend_t s_kv_file_backend = {
+    .name = "file",
+    .open = kv_file_open,
+    .load = kv_file_load,
+    .store = kv_file_store,
+    .erase = kv_file_erase,
+    .flush = kv_file_flush,
+};
+
+const rt_kv_backend_t *rt_kv_file_backend(void) {
+    return &s_kv_file_backend;
+}
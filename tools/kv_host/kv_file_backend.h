@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "rt_kv.h"
+
+// rt_kv storage in one host file, rewritten (temp file + rename) on every
+// flush, standing in for NVS. file_writes counts those rewrites.
+const rt_kv_backend_t *rt_kv_file_backend(void);
+void kv_file_set_path(const char *path);
+uint32_t kv_file_writes(void);
+// The next n flushes fail with RUNTIME_EIO and write nothing.
+void kv_file_fail_flushes(int n);
@@ -0,0 +1,285 @@
+// Host test of the log-structured KV store (main/kv_log.c) on simulated NOR
+// flash: persistence, compaction under sustained updates, and power cuts
+// injected at every point of a batch, checked against a model.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+#include "flash_sim.h"
+#include "kv_log.h"
+
+#define SIM_SECTOR 4096
+#define SIM_SECTORS 8
+#define MODEL_KEYS 24
+#define MODEL_VAL_MAX 300
+
+static int s_failed;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            s_failed = 1;                                                   \
+        }                                                                   \
+    } while (0)
+
+typedef struct {
+    bool present;
+    uint16_t len;
+    uint8_t val[MODEL_VAL_MAX];
+} model_val_t;
+
+typedef struct {
+    model_val_t v[MODEL_KEYS];
+} model_t;
+
+static uint32_t s_rng = 12345;
+
+static uint32_t rnd(void) {
+    s_rng = s_rng * 1103515245u + 12345u;
+    return s_rng >> 8;
+}
+
+static void model_key(int i, char *key) {
+    snprintf(key, RT_KV_KEY_MAX + 1, "key%02d", i);
+}
+
+static void remount(void) {
+    flash_sim_power_cycle();
+    CHECK(kv_log_mount(flash_sim()) == RUNTIME_OK);
+}
+
+static bool model_matches(const model_t *m) {
+    char key[RT_KV_KEY_MAX + 1];
+    uint8_t buf[MODEL_VAL_MAX];
+    for (int i = 0; i < MODEL_KEYS; ++i) {
+        model_key(i, key);
+        size_t len = sizeof(buf);
+        int rc = kv_log_get(key, buf, &len);
+        if (!m->v[i].present) {
+            if (rc != RUNTIME_ENOENT) return false;
+        } else if (rc != RUNTIME_OK || len != m->v[i].len || memcmp(buf, m->v[i].val, len) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t get_u32(const char *key) {
+    uint32_t v = 0;
+    size_t len = sizeof(v);
+    CHECK(kv_log_get(key, &v, &len) == RUNTIME_OK && len == sizeof(v));
+    return v;
+}
+
+static void test_basics(const char *path) {
+    remove(path);
+    flash_sim_init(path, SIM_SECTORS * SIM_SECTOR, SIM_SECTOR);
+    CHECK(kv_log_mount(flash_sim()) == RUNTIME_OK);
+
+    size_t len = 0;
+    CHECK(kv_log_get("missing", NULL, &len) == RUNTIME_ENOENT);
+    CHECK(kv_log_put("this_key_is_too_long", "x", 1) == RUNTIME_EINVAL);
+    CHECK(kv_log_del("") == RUNTIME_EINVAL);
+
+    CHECK(kv_log_put("greeting", "hello", 5) == RUNTIME_OK);
+    CHECK(kv_log_put("empty", "", 0) == RUNTIME_OK);
+    CHECK(kv_log_commit() == RUNTIME_OK);
+    // Staged but never committed: gone after a power cut.
+    CHECK(kv_log_put("greeting", "bye", 3) == RUNTIME_OK);
+    CHECK(kv_log_put("other", "x", 1) == RUNTIME_OK);
+    remount();
+
+    kv_log_stats_t st;
+    kv_log_get_stats(&st);
+    CHECK(st.keys == 2 && st.torn == 1);
+    char buf[8];
+    len = 2;
+    CHECK(kv_log_get("greeting", buf, &len) == RUNTIME_EINVAL && len == 5);
+    len = sizeof(buf);
+    CHECK(kv_log_get("greeting", buf, &len) == RUNTIME_OK && len == 5 && memcmp(buf, "hello", 5) == 0);
+    len = sizeof(buf);
+    CHECK(kv_log_get("empty", buf, &len) == RUNTIME_OK && len == 0);
+    CHECK(kv_log_get("other", NULL, &len) == RUNTIME_ENOENT);
+
+    // The aborted batch must not ride along with the next commit.
+    CHECK(kv_log_del("empty") == RUNTIME_OK);
+    CHECK(kv_log_commit() == RUNTIME_OK);
+    remount();
+    CHECK(kv_log_get("empty", NULL, &len) == RUNTIME_ENOENT);
+    CHECK(kv_log_get("other", NULL, &len) == RUNTIME_ENOENT);
+    CHECK(kv_log_get("greeting", NULL, &len) == RUNTIME_OK && len == 5);
+}
+
+// Counters updated and committed one at a time, far past the partition size.
+static void test_gc(const char *path) {
+    remove(path);
+    flash_sim_init(path, SIM_SECTORS * SIM_SECTOR, SIM_SECTOR);
+    CHECK(kv_log_mount(flash_sim()) == RUNTIME_OK);
+    char key[24];
+    uint32_t counts[16] = {0};
+    for (int i = 0; i < 6; ++i) {
+        snprintf(key, sizeof(key), "gone%d", i);
+        CHECK(kv_log_put(key, "x", 1) == RUNTIME_OK);
+    }
+    CHECK(kv_log_commit() == RUNTIME_OK);
+    for (int i = 0; i < 6; ++i) {
+        snprintf(key, sizeof(key), "gone%d", i);
+        CHECK(kv_log_del(key) == RUNTIME_OK);
+    }
+    CHECK(kv_log_commit() == RUNTIME_OK);
+    for (uint32_t n = 0; n < 20000; ++n) {
+        int k = (int)(rnd() % 16);
+        counts[k]++;
+        snprintf(key, sizeof(key), "count%d", k);
+        CHECK(kv_log_put(key, &counts[k], sizeof(counts[k])) == RUNTIME_OK);
+        CHECK(kv_log_commit() == RUNTIME_OK);
+    }
+    kv_log_stats_t st;
+    kv_log_get_stats(&st);
+    printf("kv_log: 20000 commits -> %u GC runs, %u erases, worst op %u erase(s) / %u bytes\n", (unsigned)st.gc_runs,
+           (unsigned)st.erases, (unsigned)st.max_op_erases, (unsigned)st.max_op_bytes);
+    CHECK(st.gc_runs > 0);
+    CHECK(st.max_op_erases <= 2);
+    CHECK(st.max_op_bytes <= 2 * SIM_SECTOR);
+    CHECK(st.keys == 16);
+    CHECK(flash_sim_violations() == 0);
+
+    remount();
+    for (int k = 0; k < 16; ++k) {
+        snprintf(key, sizeof(key), "count%d", k);
+        CHECK(get_u32(key) == counts[k]);
+    }
+    size_t len;
+    for (int i = 0; i < 6; ++i) {
+        snprintf(key, sizeof(key), "gone%d", i);
+        CHECK(kv_log_get(key, NULL, &len) == RUNTIME_ENOENT);
+    }
+    kv_log_get_stats(&st);
+    CHECK(st.keys == 16 && st.torn == 0);
+
+    // Filling up fails cleanly, and existing keys can still be rewritten.
+    static uint8_t big[BASALT_KV_VALUE_MAX];
+    int rc = RUNTIME_OK;
+    int filled = 0;
+    for (; filled < 200 && rc == RUNTIME_OK; ++filled) {
+        snprintf(key, sizeof(key), "big%d", filled);
+        rc = kv_log_put(key, big, sizeof(big));
+        if (rc == RUNTIME_OK) rc = kv_log_commit();
+    }
+    CHECK(rc == RUNTIME_ENOMEM && filled > 10);
+    for (int n = 0; n < 200; ++n) {
+        CHECK(kv_log_put("big0", big, sizeof(big)) == RUNTIME_OK);
+        CHECK(kv_log_commit() == RUNTIME_OK);
+    }
+    CHECK(flash_sim_violations() == 0);
+}
+
+static void random_batch(model_t *m) {
+    int ops = 1 + (int)(rnd() % 6);
+    char key[RT_KV_KEY_MAX + 1];
+    for (int i = 0; i < ops; ++i) {
+        int k = (int)(rnd() % MODEL_KEYS);
+        model_key(k, key);
+        model_val_t *v = &m->v[k];
+        if (rnd() % 5 == 0) {
+            v->present = false;
+            if (kv_log_del(key) != RUNTIME_OK) return;
+            continue;
+        }
+        v->present = true;
+        v->len = (uint16_t)(rnd() % 8 == 0 ? rnd() % MODEL_VAL_MAX : rnd() % 24);
+        for (int b = 0; b < v->len; ++b) v->val[b] = (uint8_t)rnd();
+        if (kv_log_put(key, v->val, v->len) != RUNTIME_OK) return;
+    }
+    kv_log_commit();
+}
+
+// Each batch runs with a power cut armed at a random point. After the
+// reboot the store must hold exactly the state before or after the batch,
+// and keep working from there.
+static void test_crashes(const char *path) {
+    remove(path);
+    flash_sim_init(path, SIM_SECTORS * SIM_SECTOR, SIM_SECTOR);
+    CHECK(kv_log_mount(flash_sim()) == RUNTIME_OK);
+    static model_t before, after;
+    memset(&before, 0, sizeof(before));
+    int crashes = 0, landed = 0, mount_crashes = 0;
+    uint32_t gc_runs = 0;
+    kv_log_stats_t st;
+    for (int round = 0; round < 4000 && !s_failed; ++round) {
+        after = before;
+        // Mostly within the batch's own writes, sometimes deep into a GC.
+        flash_sim_crash_after((int64_t)(rnd() % 4 ? rnd() % 300 : rnd() % (3 * SIM_SECTOR)));
+        random_batch(&after);
+        if (!flash_sim_crashed()) {
+            flash_sim_crash_after(-1);
+            CHECK(model_matches(&after));
+            before = after;
+            if (round % 50 == 0) {
+                kv_log_get_stats(&st);
+                gc_runs += st.gc_runs;
+                remount();
+                CHECK(model_matches(&before));
+            }
+            continue;
+        }
+        crashes++;
+        kv_log_get_stats(&st);
+        gc_runs += st.gc_runs;
+        flash_sim_power_cycle();
+        // Sometimes lose power again while recovering.
+        if (rnd() % 4 == 0) {
+            flash_sim_crash_after((int64_t)(rnd() % SIM_SECTOR));
+            if (kv_log_mount(flash_sim()) != RUNTIME_OK) mount_crashes++;
+            flash_sim_power_cycle();
+        }
+        CHECK(kv_log_mount(flash_sim()) == RUNTIME_OK);
+        if (model_matches(&after)) {
+            landed++;
+            before = after;
+        } else {
+            CHECK(model_matches(&before));
+        }
+    }
+    kv_log_get_stats(&st);
+    gc_runs += st.gc_runs;
+    printf("kv_log: %d power cuts (%d after commit landed, %d during recovery), %u GC runs\n", crashes, landed,
+           mount_crashes, (unsigned)gc_runs);
+    CHECK(crashes > 1000);
+    CHECK(gc_runs > 50);
+    CHECK(flash_sim_violations() == 0);
+}
+
+// rt_kv_init() picks the log backend when the partition exists.
+static void test_rt_kv(const char *path) {
+    remove(path);
+    flash_sim_init(path, SIM_SECTORS * SIM_SECTOR, SIM_SECTOR);
+    CHECK(rt_kv_init() == RUNTIME_OK);
+    rt_kv_stats_t st;
+    rt_kv_get_stats(&st);
+    CHECK(st.backend && strcmp(st.backend, "kvlog") == 0);
+    uint32_t v = 7;
+    CHECK(rt_kv_set("boots", &v, sizeof(v)) == RUNTIME_OK);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    host_clock_advance_us(1000 * 1000);
+    flash_sim_power_cycle();
+    CHECK(rt_kv_init() == RUNTIME_OK);
+    v = 0;
+    size_t len = sizeof(v);
+    CHECK(rt_kv_get("boots", &v, &len) == RUNTIME_OK && v == 7);
+}
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "kv_log_test.bin";
+    test_basics(path);
+    test_gc(path);
+    test_crashes(path);
+    test_rt_kv(path);
+    remove(path);
+    if (s_failed) return 1;
+    printf("kv_log: ok\n");
+    return 0;
+}
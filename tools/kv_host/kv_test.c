@@ -0,0 +1,168 @@
+// Host test of the rt_kv cache (main/rt_kv.c) over the file backend: values
+// survive a simulated reboot, bursts of sets and commits coalesce into the
+// expected number of flash writes, and deferred commits run on the rt_kv task.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "kv_file_backend.h"
+
+// rt_kv.c's default cache size.
+#ifndef BASALT_KV_CACHE_ENTRIES
+#define BASALT_KV_CACHE_ENTRIES 32
+#endif
+
+static int s_failed;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            s_failed = 1;                                                   \
+        }                                                                   \
+    } while (0)
+
+static void reboot(void) {
+    CHECK(rt_kv_init_backend(rt_kv_file_backend()) == RUNTIME_OK);
+}
+
+static uint32_t get_u32(const char *key) {
+    uint32_t v = 0;
+    size_t len = sizeof(v);
+    CHECK(rt_kv_get(key, &v, &len) == RUNTIME_OK && len == sizeof(v));
+    return v;
+}
+
+static void set_u32(const char *key, uint32_t v) {
+    CHECK(rt_kv_set(key, &v, sizeof(v)) == RUNTIME_OK);
+}
+
+static void quiet(void) {
+    host_clock_advance_us(2 * 1000 * 1000);
+}
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "kv_test.bin";
+    remove(path);
+    kv_file_set_path(path);
+    reboot();
+    CHECK(host_task_count() == 1);
+    rt_kv_stats_t st;
+
+    // Missing keys, bad arguments.
+    size_t len = 0;
+    CHECK(rt_kv_get("missing", NULL, &len) == RUNTIME_ENOENT);
+    CHECK(rt_kv_set("this_key_is_too_long", "x", 1) == RUNTIME_EINVAL);
+    CHECK(rt_kv_set("", "x", 1) == RUNTIME_EINVAL);
+
+    // A burst of sets across ten keys is one write.
+    char key[16];
+    for (uint32_t i = 0; i < 200; ++i) {
+        snprintf(key, sizeof(key), "k%u", (unsigned)(i % 10));
+        set_u32(key, i);
+    }
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    rt_kv_get_stats(&st);
+    CHECK(st.flash_commits == 1 && st.flash_ops == 10 && kv_file_writes() == 1);
+    CHECK(get_u32("k3") == 193);
+
+    // Set + commit every millisecond for 100 ms: the first commit writes at
+    // once, the rest merge into one deferred write.
+    quiet();
+    for (uint32_t i = 0; i < 100; ++i) {
+        set_u32("counter", i);
+        CHECK(rt_kv_commit() == RUNTIME_OK);
+        host_clock_advance_us(1000);
+    }
+    rt_kv_get_stats(&st);
+    CHECK(st.flash_commits == 2 && st.commit_pending);
+    quiet();
+    rt_kv_get_stats(&st);
+    CHECK(st.flash_commits == 3 && !st.commit_pending && st.dirty == 0);
+    uint32_t burst_sets = st.sets, burst_writes = st.flash_commits;
+
+    // Rewriting the same value writes nothing.
+    set_u32("counter", 99);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    rt_kv_get_stats(&st);
+    CHECK(st.sets_unchanged == 1 && st.flash_commits == 3);
+
+    // Deletes, short buffers, and values surviving a reboot.
+    CHECK(rt_kv_del("k0") == RUNTIME_OK);
+    CHECK(rt_kv_set("name", "basalt", 6) == RUNTIME_OK);
+    quiet();
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    reboot();
+    CHECK(rt_kv_get("k0", NULL, &len) == RUNTIME_ENOENT);
+    char name[8] = {0};
+    len = 3;
+    CHECK(rt_kv_get("name", name, &len) == RUNTIME_EINVAL && len == 6);
+    len = sizeof(name);
+    CHECK(rt_kv_get("name", name, &len) == RUNTIME_OK && len == 6 && memcmp(name, "basalt", 6) == 0);
+    CHECK(get_u32("counter") == 99 && get_u32("k9") == 199);
+
+    // A deferred commit is lost on reboot unless synced first.
+    set_u32("counter", 500);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    set_u32("counter", 501);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    CHECK(rt_kv_sync() == RUNTIME_OK);
+    reboot();
+    CHECK(get_u32("counter") == 501);
+
+    // A deferred write that fails stays pending and is retried a window
+    // later, on the task.
+    quiet();
+    set_u32("counter", 600);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    set_u32("counter", 601);
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    uint32_t writes = kv_file_writes();
+    kv_file_fail_flushes(1);
+    host_clock_advance_us(1000 * 1000);
+    rt_kv_get_stats(&st);
+    CHECK(st.commit_pending && st.dirty == 1 && kv_file_writes() == writes);
+    quiet();
+    rt_kv_get_stats(&st);
+    CHECK(!st.commit_pending && st.dirty == 0 && kv_file_writes() == writes + 1);
+    reboot();
+    CHECK(get_u32("counter") == 601);
+
+    // More dirty keys than cache entries: the cache never writes uncommitted
+    // changes to make room, so the set that needs one fails until a commit.
+    writes = kv_file_writes();
+    uint32_t fit = 0;
+    for (uint32_t i = 0; i < 48; ++i) {
+        snprintf(key, sizeof(key), "e%u", (unsigned)i);
+        uint32_t v = i * 3;
+        int rc = rt_kv_set(key, &v, sizeof(v));
+        if (rc != RUNTIME_OK) {
+            CHECK(rc == RUNTIME_ENOMEM);
+            break;
+        }
+        fit++;
+    }
+    CHECK(fit == BASALT_KV_CACHE_ENTRIES && kv_file_writes() == writes);
+    quiet();
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    for (uint32_t i = fit; i < 48; ++i) {
+        snprintf(key, sizeof(key), "e%u", (unsigned)i);
+        set_u32(key, i * 3);
+    }
+    quiet();
+    CHECK(rt_kv_commit() == RUNTIME_OK);
+    reboot();
+    for (uint32_t i = 0; i < 48; ++i) {
+        snprintf(key, sizeof(key), "e%u", (unsigned)i);
+        CHECK(get_u32(key) == i * 3);
+    }
+
+    printf("kv: %u sets with commits -> %u flash writes\n", (unsigned)burst_sets, (unsigned)burst_writes);
+    remove(path);
+    if (s_failed) return 1;
+    printf("kv: all checks passed\n");
+    return 0;
+}
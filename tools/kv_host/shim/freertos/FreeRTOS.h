@@ -0,0 +1,14 @@
+#pragma once
+// Host shim: the FreeRTOS surface main/rt_kv*.c use; host_kv.c implements it
+// on pthreads.
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY 0xFFFFFFFFu
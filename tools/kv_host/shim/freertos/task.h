@@ -0,0 +1,14 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+// Tasks are threads that run one at a time: xTaskNotifyGive returns once the
+// notified task has blocked again (see host_kv.c).
+BaseType_t xTaskCreate(void (*fn)(void *), const char *name, uint32_t stack, void *arg, uint32_t prio,
+                       TaskHandle_t *out);
+void xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+// Tasks created so far.
+int host_task_count(void);
@@ -0,0 +1,110 @@
+# lib/asyncio.py on the host VM: import, sleeps, event waits, gather and
+# cancellation. Run by tools/tests/mpy_asyncio_smoke.sh.
+
+import asyncio
+from basalt import events, timer
+
+
+async def sleeper(ms):
+    t0 = timer.ticks_us()
+    await asyncio.sleep_ms(ms)
+    return timer.ticks_diff(timer.ticks_us(), t0)
+
+
+# A sleep lasts at least its delay, and the loop idles in poll() meanwhile.
+took = asyncio.run(sleeper(30))
+assert 30000 <= took < 1000000, took
+
+
+# A waiter parks until another task posts its event type.
+async def poster(delay, kind, code, a, b):
+    await asyncio.sleep_ms(delay)
+    events.post(kind, code, a, b)
+
+
+async def wait_user():
+    asyncio.create_task(poster(10, events.USER, 7, 1, 2))
+    return await asyncio.wait_event(events.USER)
+
+
+assert asyncio.run(wait_user()) == (events.USER, 7, 1, 2)
+
+
+# Events posted before anyone waits are kept in the backlog.
+async def touch_backlog():
+    events.post(events.TOUCH, 1, 10, 20)
+    await asyncio.sleep_ms(1)
+    return await asyncio.touch()
+
+
+assert asyncio.run(touch_backlog()) == (1, 10, 20)
+
+
+# gather runs its tasks concurrently: two 20 ms sleeps take ~20 ms.
+async def both():
+    t0 = timer.ticks_us()
+    results = await asyncio.gather(sleeper(20), sleeper(20))
+    return results, timer.ticks_diff(timer.ticks_us(), t0)
+
+
+results, took = asyncio.run(both())
+assert len(results) == 2 and results[0] >= 20000 and results[1] >= 20000, results
+assert took < 35000, took
+
+
+# A task cancelled while awaiting another is unlinked from it: when that one
+# ends later, the cancelled task (now sleeping) is not woken early.
+log = []
+
+
+async def slow():
+    await asyncio.sleep_ms(20)
+    log.append("slow")
+
+
+async def joiner(task):
+    try:
+        await task
+        log.append("joiner resumed")
+    except asyncio.CancelledError:
+        t0 = timer.ticks_us()
+        await asyncio.sleep_ms(40)
+        log.append(timer.ticks_diff(timer.ticks_us(), t0) >= 40000)
+
+
+async def cancel_joiner():
+    task = asyncio.create_task(slow())
+    j = asyncio.create_task(joiner(task))
+    await asyncio.sleep_ms(5)
+    j.cancel()
+    await j
+
+
+asyncio.run(cancel_joiner())
+assert log == ["slow", True], log
+
+
+# A cancelled event waiter leaves no empty waiter list behind, so tasks that
+# only wait on each other are reported as a deadlock instead of blocking.
+async def join(box):
+    await box[0]
+
+
+async def cycle():
+    w = asyncio.create_task(asyncio.wait_event(events.KEY))
+    await asyncio.sleep_ms(1)
+    w.cancel()
+    box = []
+    t = asyncio.create_task(join(box))
+    box.append(asyncio.create_task(join([t])))
+    await t
+
+
+try:
+    asyncio.run(cycle())
+    assert False, "no deadlock reported"
+except RuntimeError as e:
+    assert "deadlock" in str(e), e
+
+print("asyncio: ok")
+passed = True
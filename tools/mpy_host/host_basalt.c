@@ -0,0 +1,136 @@
+// Host stand-in for the `basalt` module (port/modbasalt.c): `timer` and
+// `events` only, with the same names, constants and return shapes. Events go
+// through an in-memory queue in this process, so only posts from the script
+// itself arrive; poll() sleeps out its timeout and an endless poll on an empty
+// queue raises instead of hanging the test.
+
+#include <errno.h>
+#include <time.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/smallint.h"
+
+#include "esp_timer.h"
+#include "runtime_api.h"
+
+#define HOST_EVENT_QUEUE 32
+
+static rt_event_t s_queue[HOST_EVENT_QUEUE];
+static size_t s_head;
+static size_t s_count;
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void host_sleep_ms(int ms) {
+    struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+static mp_obj_t basalt_timer_sleep_ms(mp_obj_t ms_obj) {
+    int ms = mp_obj_get_int(ms_obj);
+    if (ms > 0) host_sleep_ms(ms);
+    mp_handle_pending(true);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(basalt_timer_sleep_ms_obj, basalt_timer_sleep_ms);
+
+#define BASALT_TICKS_MASK MP_SMALL_INT_POSITIVE_MASK
+static mp_obj_t basalt_timer_ticks_us(void) {
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)(esp_timer_get_time() & BASALT_TICKS_MASK));
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(basalt_timer_ticks_us_obj, basalt_timer_ticks_us);
+
+static mp_obj_t basalt_timer_ticks_diff(mp_obj_t end_obj, mp_obj_t start_obj) {
+    mp_uint_t diff = ((mp_uint_t)mp_obj_get_int(end_obj) - (mp_uint_t)mp_obj_get_int(start_obj)) & BASALT_TICKS_MASK;
+    mp_int_t half = (BASALT_TICKS_MASK >> 1) + 1;
+    return MP_OBJ_NEW_SMALL_INT(((mp_int_t)diff ^ half) - half);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(basalt_timer_ticks_diff_obj, basalt_timer_ticks_diff);
+
+// basalt.events.poll([timeout_ms]) -> (type, code, a, b) or None on timeout.
+static mp_obj_t basalt_events_poll(size_t n_args, const mp_obj_t *args) {
+    int timeout = n_args > 0 ? mp_obj_get_int(args[0]) : -1;
+    if (s_count == 0) {
+        if (timeout < 0) mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("poll(-1) on an empty queue never returns"));
+        if (timeout > 0) host_sleep_ms(timeout);
+        mp_handle_pending(true);
+        if (s_count == 0) return mp_const_none;
+    }
+    rt_event_t ev = s_queue[s_head];
+    s_head = (s_head + 1) % HOST_EVENT_QUEUE;
+    s_count--;
+    mp_obj_t items[4] = {
+        MP_OBJ_NEW_SMALL_INT(ev.type),
+        mp_obj_new_int((int32_t)ev.code),
+        mp_obj_new_int((int32_t)ev.a),
+        mp_obj_new_int((int32_t)ev.b),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_poll_obj, 0, 1, basalt_events_poll);
+
+// basalt.events.post(type[, code, a, b]); a full queue drops its oldest entry.
+static mp_obj_t basalt_events_post(size_t n_args, const mp_obj_t *args) {
+    rt_event_t ev = {
+        .type = (rt_event_type_t)mp_obj_get_int(args[0]),
+        .code = n_args > 1 ? (uint32_t)mp_obj_get_int(args[1]) : 0,
+        .a = n_args > 2 ? (uint32_t)mp_obj_get_int(args[2]) : 0,
+        .b = n_args > 3 ? (uint32_t)mp_obj_get_int(args[3]) : 0,
+    };
+    if (ev.type <= RT_EVT_NONE || ev.type >= RT_EVT_TYPE_COUNT) mp_raise_ValueError(MP_ERROR_TEXT("invalid event type"));
+    if (s_count == HOST_EVENT_QUEUE) {
+        s_head = (s_head + 1) % HOST_EVENT_QUEUE;
+        s_count--;
+    }
+    s_queue[(s_head + s_count) % HOST_EVENT_QUEUE] = ev;
+    s_count++;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(basalt_events_post_obj, 1, 4, basalt_events_post);
+
+static const mp_rom_map_elem_t basalt_timer_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),   MP_ROM_QSTR(MP_QSTR_basalt_timer) },
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms),   MP_ROM_PTR(&basalt_timer_sleep_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_us),   MP_ROM_PTR(&basalt_timer_ticks_us_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff), MP_ROM_PTR(&basalt_timer_ticks_diff_obj) },
+};
+static MP_DEFINE_CONST_DICT(basalt_timer_globals, basalt_timer_globals_table);
+
+static const mp_obj_module_t basalt_timer_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_timer_globals,
+};
+
+static const mp_rom_map_elem_t basalt_events_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt_events) },
+    { MP_ROM_QSTR(MP_QSTR_poll),     MP_ROM_PTR(&basalt_events_poll_obj) },
+    { MP_ROM_QSTR(MP_QSTR_post),     MP_ROM_PTR(&basalt_events_post_obj) },
+    { MP_ROM_QSTR(MP_QSTR_KEY),      MP_ROM_INT(RT_EVT_KEY)   },
+    { MP_ROM_QSTR(MP_QSTR_TIMER),    MP_ROM_INT(RT_EVT_TIMER) },
+    { MP_ROM_QSTR(MP_QSTR_USER),     MP_ROM_INT(RT_EVT_USER)  },
+    { MP_ROM_QSTR(MP_QSTR_TOUCH),    MP_ROM_INT(RT_EVT_TOUCH) },
+};
+static MP_DEFINE_CONST_DICT(basalt_events_globals, basalt_events_globals_table);
+
+static const mp_obj_module_t basalt_events_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_events_globals,
+};
+
+static const mp_rom_map_elem_t basalt_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_basalt) },
+    { MP_ROM_QSTR(MP_QSTR_timer),    MP_ROM_PTR(&basalt_timer_module) },
+    { MP_ROM_QSTR(MP_QSTR_events),   MP_ROM_PTR(&basalt_events_module) },
+};
+static MP_DEFINE_CONST_DICT(basalt_module_globals, basalt_module_globals_table);
+
+const mp_obj_module_t mp_module_basalt = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&basalt_module_globals,
+};
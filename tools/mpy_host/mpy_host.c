@@ -0,0 +1,74 @@
+// Runs a Python script on the host build of the embedded VM, with
+// runtime/python/lib on sys.path. The script passes by setting a global
+// `passed` to True; anything else, including an uncaught exception, exits 1.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "py/gc.h"
+#include "py/objstr.h"
+#include "py/runtime.h"
+
+#include "micropython_embed.h"
+
+#define MPY_HOST_HEAP (256 * 1024)
+
+static char s_heap[MPY_HOST_HEAP];
+
+void *mp_embed_heap_alloc(size_t size) {
+    return malloc(size);
+}
+
+void mp_embed_heap_free(void *ptr) {
+    free(ptr);
+}
+
+// One fixed area, as on a board without room to grow into.
+size_t gc_get_max_new_split(void) {
+    return 0;
+}
+
+static char *read_file(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *src = len >= 0 ? malloc((size_t)len + 1) : NULL;
+    if (src && fread(src, 1, (size_t)len, f) != (size_t)len) {
+        free(src);
+        src = NULL;
+    }
+    if (src) src[len] = '\0';
+    fclose(f);
+    return src;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s script.py\n", argv[0]);
+        return 2;
+    }
+    char *src = read_file(argv[1]);
+    if (!src) {
+        fprintf(stderr, "cannot read %s\n", argv[1]);
+        return 2;
+    }
+
+    int stack_top;
+    mp_embed_init(s_heap, sizeof(s_heap), &stack_top);
+    mp_obj_list_append(mp_sys_path, mp_obj_new_str(BASALT_LIB_DIR, strlen(BASALT_LIB_DIR)));
+    mp_embed_exec_str(src);
+
+    mp_map_elem_t *elem = mp_map_lookup(&mp_globals_get()->map,
+                                        MP_OBJ_NEW_QSTR(qstr_from_str("passed")), MP_MAP_LOOKUP);
+    int ok = elem && elem->value == mp_const_true;
+    mp_embed_deinit();
+    free(src);
+    if (!ok) {
+        fprintf(stderr, "FAIL: %s did not pass\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
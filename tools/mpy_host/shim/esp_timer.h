@@ -0,0 +1,5 @@
+#pragma once
+// Host shim: esp_timer_get_time() on CLOCK_MONOTONIC.
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
@@ -5,7 +5,11 @@ from __future__ import annotations
 
 import argparse
 import os
+import shutil
+import struct
+import subprocess
 import sys
+import tempfile
 import time
 import zipfile
 from pathlib import Path
@@ -28,6 +32,59 @@ def _file_zipinfo(src_path: str, arc_path: str) -> zipfile.ZipInfo:
     return zi
 
 
+# Bytecode cache header read by main/mpy_runtime.c: magic, source length and
+# FNV-1a hash of the source, followed by the .mpy image.
+MPC_MAGIC = b"BMC1"
+
+
+# Scripts using these decorators compile to machine code on the device and are
+# never cached there (see MPY_NATIVE_MARKERS in main/mpy_runtime.c).
+NATIVE_MARKERS = (b"@micropython.native", b"@micropython.viper", b"@micropython.asm_")
+
+
+def _uses_native(src_path: str) -> bool:
+    data = Path(src_path).read_bytes()
+    return any(marker in data for marker in NATIVE_MARKERS)
+
+
+def _fnv1a32(data: bytes) -> int:
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def _mpy_cross_cmd(explicit: str | None) -> list[str] | None:
+    if explicit:
+        return [explicit]
+    found = shutil.which("mpy-cross")
+    if found:
+        return [found]
+    try:
+        import mpy_cross  # noqa: F401  (pip package ships the binary)
+    except ImportError:
+        return None
+    return [sys.executable, "-m", "mpy_cross"]
+
+
+def _precompile(src_path: str, source_name: str, mpy_cross: list[str]) -> bytes:
+    """Compile one script to the on-device "<stem>.mpc" cache format."""
+    with open(src_path, "rb") as f:
+        source = f.read()
+    with tempfile.TemporaryDirectory() as td:
+        out = os.path.join(td, "out.mpy")
+        proc = subprocess.run(
+            mpy_cross + ["-s", source_name, "-msmall-int-bits=31", "-o", out, src_path],
+            capture_output=True,
+            text=True,
+        )
+        if proc.returncode != 0:
+            raise ValueError(f"mpy-cross failed for {source_name}: {proc.stderr.strip()}")
+        with open(out, "rb") as f:
+            mpy = f.read()
+    return MPC_MAGIC + struct.pack("<II", len(source), _fnv1a32(source)) + mpy
+
+
 def main() -> int:
     parser = argparse.ArgumentParser(
         description="Pack a Basalt OS app into a store-only zip."
@@ -44,6 +101,16 @@ def main() -> int:
         action="store_true",
         help="Run CPython syntax checks on .py files before packing (best-effort)",
     )
+    parser.add_argument(
+        "--precompile",
+        action="store_true",
+        help="Ship bytecode for the Python entry script (<stem>.mpc) so the device skips compiling",
+    )
+    parser.add_argument(
+        "--mpy-cross",
+        default=None,
+        help="mpy-cross executable for --precompile (default: PATH, then the mpy_cross package)",
+    )
     args = parser.parse_args()
 
     app_dir = os.path.abspath(args.app_dir)
@@ -57,7 +124,7 @@ def main() -> int:
         return 1
 
     try:
-        validate_app_dir(
+        meta = validate_app_dir(
             Path(app_dir),
             check_py_syntax=args.check_syntax,
         )
@@ -65,8 +132,28 @@ def main() -> int:
         print(f"error: {e}", file=sys.stderr)
         return 1
 
+    generated: dict[str, bytes] = {}
+    entry = _norm_slashes(meta["entry"])
+    if args.precompile and meta["runtime"] == "python" and entry.endswith(".py"):
+        mpy_cross = _mpy_cross_cmd(args.mpy_cross)
+        if not mpy_cross:
+            print("error: mpy-cross not found (install it or pass --mpy-cross)", file=sys.stderr)
+            return 1
+        try:
+            cache = entry[:-3] + ".mpc"
+            if _uses_native(os.path.join(app_dir, entry)):
+                print(f"note: {entry} uses native/viper code; not precompiling")
+            else:
+                generated[_norm_slashes(os.path.join(app_name, cache))] = _precompile(
+                    os.path.join(app_dir, entry), entry, mpy_cross
+                )
+        except (OSError, ValueError) as e:
+            print(f"error: {e}", file=sys.stderr)
+            return 1
+
     files = []
-    for root, _dirs, filenames in os.walk(app_dir):
+    for root, dirs, filenames in os.walk(app_dir):
+        dirs[:] = [d for d in dirs if d != "__pycache__"]  # host interpreter caches
         for name in filenames:
             src = os.path.join(root, name)
             rel = os.path.relpath(src, app_dir)
@@ -75,6 +162,8 @@ def main() -> int:
                 print(f"error: invalid path: {rel}", file=sys.stderr)
                 return 1
             arc = _norm_slashes(os.path.join(app_name, rel))
+            if arc in generated:
+                continue  # replaced by the fresh bytecode cache
             files.append((src, arc))
 
     out_zip = os.path.abspath(args.out_zip)
@@ -86,8 +175,13 @@ def main() -> int:
                 data = f.read()
             zi = _file_zipinfo(src, arc)
             zf.writestr(zi, data, compress_type=zipfile.ZIP_STORED)
+        for arc, data in sorted(generated.items()):
+            zi = zipfile.ZipInfo(filename=arc, date_time=time.localtime()[:6])
+            zi.compress_type = zipfile.ZIP_STORED
+            zi.external_attr = 0o100644 << 16
+            zf.writestr(zi, data, compress_type=zipfile.ZIP_STORED)
 
-    print(f"packed {len(files)} file(s) into {out_zip}")
+    print(f"packed {len(files) + len(generated)} file(s) into {out_zip}")
     return 0
 
 
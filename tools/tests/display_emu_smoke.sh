@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+cd "$ROOT"
+
+if ! command -v cmake >/dev/null 2>&1 || ! command -v cc >/dev/null 2>&1; then
+  echo "SKIP: cmake or host C compiler not found"
+  exit 0
+fi
+
+BUILD_DIR="$(mktemp -d)"
+trap 'rm -rf "$BUILD_DIR"' EXIT
+
+cmake -S tools/display_emu -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release >/dev/null
+cmake --build "$BUILD_DIR" -j >/dev/null
+
+mkdir -p "$BUILD_DIR/png"
+"$BUILD_DIR/display_bench_cyd" --png-dir "$BUILD_DIR/png" \
+  --baseline tools/display_emu/baselines/cyd_3248s035r.txt
+"$BUILD_DIR/display_bench_m5" --png-dir "$BUILD_DIR/png" \
+  --baseline tools/display_emu/baselines/m5stickc_plus2.txt
+
+for png in cyd_3248s035r_canvas_band.png m5stickc_plus2_console_text.png; do
+  if [[ ! -s "$BUILD_DIR/png/$png" ]]; then
+    echo "FAIL: missing snapshot $png"
+    exit 1
+  fi
+done
+
+echo "PASS: display emulator smoke"
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+cd "$ROOT"
+
+if ! command -v cmake >/dev/null 2>&1 || ! command -v cc >/dev/null 2>&1; then
+  echo "SKIP: cmake or host C compiler not found"
+  exit 0
+fi
+
+BUILD_DIR="$(mktemp -d)"
+trap 'rm -rf "$BUILD_DIR"' EXIT
+
+cmake -S tools/event_bench -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release >/dev/null
+cmake --build "$BUILD_DIR" -j >/dev/null
+
+# event_bench exits non-zero on any lost, duplicated or reordered event.
+"$BUILD_DIR/event_bench" --events 50000 --producers 1 --subscribers 1
+"$BUILD_DIR/event_bench" --events 50000 --producers 4 --subscribers 3 --runs 2
+# Same, with the producers in ISR context (rt_event_post's FromISR path).
+"$BUILD_DIR/event_bench" --events 50000 --producers 4 --subscribers 3 --isr 1
+
+echo "PASS: event bench smoke"
@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+cd "$ROOT"
+
+if ! command -v cmake >/dev/null 2>&1 || ! command -v cc >/dev/null 2>&1; then
+  echo "SKIP: cmake or host C compiler not found"
+  exit 0
+fi
+
+BUILD_DIR="$(mktemp -d)"
+trap 'rm -rf "$BUILD_DIR"' EXIT
+
+cmake -S tools/kv_host -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release >/dev/null
+cmake --build "$BUILD_DIR" -j >/dev/null
+
+"$BUILD_DIR/kv_test" "$BUILD_DIR/kv_test.bin"
+"$BUILD_DIR/kv_log_test" "$BUILD_DIR/kv_log_test.bin"
+
+echo "PASS: kv host smoke"